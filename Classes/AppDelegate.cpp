@@ -27,6 +27,12 @@
 #include "./Game/GameManager.h"
 #include "./Resources/ResourceLoader.h"
 #include "./Resources/AudioManager.h"
+#include "./Resources/AssetPipeline.h"
+#include "./Resources/PackFileUtils.h"
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
+#include "./Game/EntityLayers.h"
+#include "./Game/ParticleEffectPool.h"
 
 USING_NS_CC;
 
@@ -36,15 +42,30 @@ static cocos2d::Size mediumResolutionSize = cocos2d::Size(1024, 768);
 static cocos2d::Size largeResolutionSize = cocos2d::Size(2048, 1536);
 
 AppDelegate::AppDelegate()
+    : _updateStartTime(0)
+    , _drawStartTime(0)
+    , _flushStartTime(0)
 {
 }
 
 AppDelegate::~AppDelegate()
 {
-    // ʵ
+    // 清理单例实例
     GameManager::getInstance()->release();
     ResourceLoader::getInstance()->release();
     AudioManager::getInstance()->release();
+
+    // 停止解码线程（在加载场景中途退出时丢弃未上传的图片）
+    AssetPipeline::getInstance()->shutdown();
+
+    // 退出时导出帧分析数据
+    if (FrameProfiler::getInstance()->isEnabled())
+    {
+        dumpProfilerTrace();
+    }
+
+    // 最后停止日志，写完缓冲区里剩余的记录
+    Logger::getInstance()->shutdown();
 }
 
 void AppDelegate::initGLContextAttrs()
@@ -55,12 +76,22 @@ void AppDelegate::initGLContextAttrs()
 
 bool AppDelegate::applicationDidFinishLaunching()
 {
-    // _Iϵyц
-    freopen("debug.log", "w", stdout);  // stdoutضļ
-    freopen("debug.log", "w", stderr);  // stderrضļ
-    log("=== APPLICATION STARTED ===");
+    // 启动异步日志：写二进制日志到可写目录（用pvz_logdecode解码），调试版同时回显到控制台
+    auto logger = Logger::getInstance();
+    std::string logPath = FileUtils::getInstance()->getWritablePath() + "debug.pvzlog";
+    if (logger->start(logPath))
+    {
+        log("Logger: Writing to %s", logPath.c_str());
+    }
+#if COCOS2D_DEBUG > 0
+    logger->setConsoleEcho(true);
+#endif
+    PVZ_LOGI(LogCategory::GENERAL, "=== APPLICATION STARTED ===");
+
+    // 挂载资源包（有assets.pak时），之后的资源读取都从映射内存里取
+    PackFileUtils::mount();
 
-    // ʼ
+    // 初始化导演类
     auto director = Director::getInstance();
     auto glview = director->getOpenGLView();
 
@@ -74,19 +105,19 @@ bool AppDelegate::applicationDidFinishLaunching()
         director->setOpenGLView(glview);
     }
 
-    // FPSʾ
+    // 设置FPS显示
     director->setDisplayStats(true);
 
-    // FPS
+    // 设置FPS
     director->setAnimationInterval(1.0f / 60);
 
-    // Ʒֱ
+    // 设置设计分辨率
     glview->setDesignResolutionSize(designResolutionSize.width, designResolutionSize.height,
         ResolutionPolicy::SHOW_ALL);
 
     auto frameSize = glview->getFrameSize();
 
-    // 豸ĻߴƷֱ
+    // 根据设备屏幕尺寸调整设计分辨率
     if (frameSize.height > mediumResolutionSize.height)
     {
         director->setContentScaleFactor(MIN(largeResolutionSize.height / designResolutionSize.height,
@@ -103,36 +134,125 @@ bool AppDelegate::applicationDidFinishLaunching()
             smallResolutionSize.width / designResolutionSize.width));
     }
 
-    // ʼϷ
+    // 初始化游戏管理器
     GameManager::getInstance()->retain();
 
-    // ʼԴ
+    // 初始化资源加载器
     ResourceLoader::getInstance()->retain();
 
-    // ʼƵ
+    // 初始化音频管理器
     AudioManager::getInstance()->retain();
     AudioManager::getInstance()->init();
 
-    // в˵
+    // 帧分析（调试版默认开启，发布版按F8开启）
+    initProfiler();
+
+    // 创建并运行菜单场景
     auto scene = MenuScene::createScene();
     director->runWithScene(scene);
 
 #if COCOS2D_DEBUG > 0
-    // _{ԇģʽ
+    // 開啟調試模式
     Director::getInstance()->setDisplayStats(true);
 
-    // Ӄȴ曪©z飨Ҫ
-    // ÿrz
+    // 添加內存洩漏檢查（如果需要）
+    // 可以在每幀更新時檢查
 #endif
 
     return true;
 }
 
+void AppDelegate::initProfiler()
+{
+    _tracePath = FileUtils::getInstance()->getWritablePath() + "frame_trace.json";
+
+#if COCOS2D_DEBUG > 0
+    FrameProfiler::getInstance()->setEnabled(true);
+#endif
+
+    // Scene::render里visit和Renderer::render是按相机交替调用的，只能合成一个区段；
+    // AFTER_VISIT到AFTER_DRAW之间是通知节点、FPS统计和最后一次Renderer::render
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    dispatcher->addCustomEventListener(Director::EVENT_BEFORE_UPDATE, [this](EventCustom*) {
+        _updateStartTime = FrameProfiler::now();
+    });
+    dispatcher->addCustomEventListener(Director::EVENT_AFTER_UPDATE, [this](EventCustom*) {
+        auto profiler = FrameProfiler::getInstance();
+        if (profiler->isEnabled() && _updateStartTime != 0)
+        {
+            profiler->record("Director::update", _updateStartTime, FrameProfiler::now());
+        }
+    });
+    dispatcher->addCustomEventListener(Director::EVENT_BEFORE_DRAW, [this](EventCustom*) {
+        _drawStartTime = FrameProfiler::now();
+    });
+    dispatcher->addCustomEventListener(Director::EVENT_AFTER_VISIT, [this](EventCustom*) {
+        _flushStartTime = FrameProfiler::now();
+        auto profiler = FrameProfiler::getInstance();
+        if (profiler->isEnabled() && _drawStartTime != 0)
+        {
+            profiler->record("Scene::render", _drawStartTime, _flushStartTime);
+        }
+    });
+    dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW, [this](EventCustom*) {
+        auto profiler = FrameProfiler::getInstance();
+        if (profiler->isEnabled() && _flushStartTime != 0)
+        {
+            profiler->record("Renderer::render", _flushStartTime, FrameProfiler::now());
+        }
+        profiler->beginFrame();
+    });
+
+    auto keyListener = EventListenerKeyboard::create();
+    keyListener->onKeyReleased = [this](EventKeyboard::KeyCode keyCode, Event*) {
+        auto profiler = FrameProfiler::getInstance();
+        if (keyCode == EventKeyboard::KeyCode::KEY_F8)
+        {
+            profiler->setEnabled(!profiler->isEnabled());
+            PVZ_LOGI(LogCategory::GENERAL, "FrameProfiler: %s", profiler->isEnabled() ? "enabled" : "disabled");
+        }
+        else if (keyCode == EventKeyboard::KeyCode::KEY_F9)
+        {
+            dumpProfilerTrace();
+        }
+        else if (keyCode == EventKeyboard::KeyCode::KEY_F10)
+        {
+            ResourceLoader::getInstance()->reportTextureMemory();
+            AudioManager::getInstance()->logVoiceStats();
+            if (auto layers = EntityLayers::getActive())
+            {
+                layers->logBatchStats();
+            }
+            ParticleEffectPool::getInstance()->logStats();
+        }
+    };
+    dispatcher->addEventListenerWithFixedPriority(keyListener, 1);
+}
+
+void AppDelegate::dumpProfilerTrace()
+{
+    if (_tracePath.empty())
+    {
+        return;
+    }
+
+    auto profiler = FrameProfiler::getInstance();
+    if (profiler->writeChromeTrace(_tracePath))
+    {
+        PVZ_LOGI(LogCategory::GENERAL, "FrameProfiler: %d events written to %s",
+            profiler->getEventCount(), _tracePath.c_str());
+    }
+    else
+    {
+        PVZ_LOGE(LogCategory::GENERAL, "FrameProfiler: Failed to write %s", _tracePath.c_str());
+    }
+}
+
 void  AppDelegate::applicationDidEnterBackground() 
 {
     Director::getInstance()->stopAnimation();
 
-    // ͣ
+    // 暂停背景音乐
     AudioManager::getInstance()->pauseBackgroundMusic();
 }
 
@@ -140,6 +260,6 @@ void AppDelegate::applicationWillEnterForeground()
 {
     Director::getInstance()->startAnimation();
 
-    // ָ
+    // 恢复背景音乐
     AudioManager::getInstance()->resumeBackgroundMusic();
 }
\ No newline at end of file
@@ -58,6 +58,17 @@ public:
     @param  the pointer of the application
     */
     virtual void applicationWillEnterForeground();
+
+private:
+    // 帧分析器：挂Director的更新/绘制事件并注册F8（开关）、F9（导出trace）、F10（按分组输出纹理内存）热键
+    void initProfiler();
+    // 导出Chrome trace到可写目录
+    void dumpProfilerTrace();
+
+    uint64_t _updateStartTime;
+    uint64_t _drawStartTime;
+    uint64_t _flushStartTime;
+    std::string _tracePath;     // 退出时FileUtils可能已被销毁，启动时先算好
 };
 
 #endif // _APP_DELEGATE_H_
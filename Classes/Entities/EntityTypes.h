@@ -0,0 +1,36 @@
+#pragma once
+#ifndef __ENTITY_TYPES_H__
+#define __ENTITY_TYPES_H__
+
+// 实体类型枚举 - 不依赖cocos2d，供场景节点与无头模拟(SimWorld)共用
+
+// 植物类型枚举
+enum class PlantType {
+    SUNFLOWER,      // 向日葵 - 资源型
+    PEASHOOTER,     // 豌豆射手 - 攻击型
+    WALLNUT,        // 坚果墙 - 防御型
+    CHERRY_BOMB,    // 樱桃炸弹 - 攻击型
+    SNOW_PEA,       // 寒冰射手 - 攻击型
+    POTATO_MINE     // 土豆地雷 - 攻击型
+};
+
+// 僵尸类型
+enum class ZombieType {
+    NORMAL,     // 普通僵尸
+    CONEHEAD,   // 路障僵尸
+    BUCKETHEAD, // 铁桶僵尸
+    FAST,       // 快速僵尸
+    GARGANTUAR  // 巨人僵尸
+};
+
+// 子弹类型枚举
+enum class ProjectileType {
+    PEA,            // 豌豆子弹
+    SNOW_PEA,       // 寒冰豌豆子弹
+    FIRE_PEA,       // 火焰豌豆子弹
+    CABBAGE,        // 卷心菜子弹
+    MELON,          // 西瓜子弹
+    SPIKEWEED       // 尖刺子弹
+};
+
+#endif // __ENTITY_TYPES_H__
@@ -2,8 +2,11 @@
 #include "./Game/GameManager.h"
 #include "./Resources/AudioManager.h"
 #include "./Resources/ResourceLoader.h"
-#include <Entities/Zombie/Zombie.h>  // нʬ
+#include <Entities/Zombie/Zombie.h>  // 假设有僵尸类
 #include <Game/WaveManager.h>
+#include "./Game/Logger.h"
+#include "./Game/EntityLayers.h"
+#include "./Game/ParticleEffectPool.h"
 
 USING_NS_CC;
 
@@ -14,21 +17,21 @@ bool CherryBomb::init()
         return false;
     }
 
-    // ñը
-    _explosionDelay = 1.5f;     // 1.5ը
-    _explosionRange = 150.0f;   // ըΧ150
-    _explosionDamage = 500;    // ը˺ɱнʬ
+    // 设置爆炸属性
+    _explosionDelay = 1.5f;     // 1.5秒后爆炸
+    _explosionRange = 150.0f;   // 爆炸范围150像素
+    _explosionDamage = 500;    // 爆炸伤害，足以秒杀所有僵尸
     _isExploding = false;
     _explosionTimer = 0.0f;
 
-    // ö
-    setIdleAnimation("cherrybomb_idle");
-    setDyingAnimation("cherrybomb_explode");
+    // 设置动画名称
+    setIdleAnimation(PVZ_ASSET_ID("cherrybomb_idle"));
+    setDyingAnimation(PVZ_ASSET_ID("cherrybomb_explode"));
 
-    // ųʼ
+    // 播放初始动画
     checkAndPlayIdleAnimation();
 
-    log("CherryBomb: Initialized with explosion delay: %.1f, damage: %d",
+    PVZ_LOGD(LogCategory::PLANT, "CherryBomb: Initialized with explosion delay: %.1f, damage: %d",
         _explosionDelay, _explosionDamage);
 
     return true;
@@ -40,7 +43,7 @@ void CherryBomb::onIdle(float delta)
     {
         _explosionTimer += delta;
 
-        // ǷҪը
+        // 检查是否需要爆炸
         if (_explosionTimer >= _explosionDelay)
         {
             _isExploding = true;
@@ -49,20 +52,11 @@ void CherryBomb::onIdle(float delta)
         }
         else
         {
-            // ˸Чʾը0.5˸
+            // 闪烁效果提示即将爆炸（最后0.5秒闪红，每0.1秒一次）
             float timeLeft = _explosionDelay - _explosionTimer;
-            if (timeLeft <= 0.5f)
+            if (timeLeft <= 0.5f && !_tint.isActive(TintOverlay::FUSE))
             {
-                // ÿ0.1˸һ
-                static float flashTimer = 0.0f;
-                flashTimer += delta;
-                if (flashTimer >= 0.1f)
-                {
-                    flashTimer = 0.0f;
-                    auto tintAction = TintTo::create(0.05f, Color3B::RED);
-                    auto reverseAction = TintTo::create(0.05f, Color3B::WHITE);
-                    this->runAction(Sequence::create(tintAction, reverseAction, nullptr));
-                }
+                _tint.start(TintOverlay::FUSE);
             }
         }
     }
@@ -70,78 +64,62 @@ void CherryBomb::onIdle(float delta)
 
 void CherryBomb::explode()
 {
-    log("CherryBomb: Exploding!");
+    PVZ_LOGI(LogCategory::PLANT, "CherryBomb: Exploding!");
+
+    _tint.stop(TintOverlay::FUSE);
 
-    // űը
-    playAnimation("cherrybomb_explode", false, [this]() {
+    // 播放爆炸动画
+    playAnimation(PVZ_ASSET_ID("cherrybomb_explode"), false, [this]() {
         this->onExplodingComplete();
         });
 
-    // űըЧ
+    // 播放爆炸音效
     playExplosionSound();
 
-    // ըЧ
+    // 创建爆炸特效
     createExplosionEffect();
 
-    // 㱬ըΧ
+    // 计算爆炸范围
     Vec2 bombPos = this->getPosition();
     float rangeSquared = _explosionRange * _explosionRange;
 
-    // ȡенʬ
+    // 这里获取场景中的所有僵尸并检查距离
     auto waveManager = WaveManager::getInstance();
     if (!waveManager) return;
 
-    const auto& zombies = waveManager->getActiveZombies();
-    for (auto zombie : zombies)
+    // 按行遍历：僵尸死亡时行索引只置空不删除，遍历过程中不会失效
+    for (int row = 0; row < WaveManager::LANE_COUNT; row++)
     {
-        if (zombie && zombie->isAlive())
+        for (auto zombie : waveManager->getZombiesInRow(row))
         {
-            Vec2 zombiePos = zombie->getPosition();
-            float distanceSquared = bombPos.distanceSquared(zombiePos);
-
-            if (distanceSquared <= rangeSquared)
+            if (zombie && zombie->isAlive())
             {
-                // Խʬ˺
-                zombie->takeDamage(_explosionDamage);
-                log("CherryBomb: Zombie hit with explosion damage: %d", _explosionDamage);
+                Vec2 zombiePos = zombie->getPosition();
+                float distanceSquared = bombPos.distanceSquared(zombiePos);
+
+                if (distanceSquared <= rangeSquared)
+                {
+                    // 对僵尸造成伤害
+                    zombie->takeDamage(_explosionDamage);
+                    PVZ_LOGT(LogCategory::PLANT, "CherryBomb: Zombie hit with explosion damage: %d", _explosionDamage);
+                }
             }
         }
     }
 
     this->onDead();
 
-    // ʱʵ֣־
-    log("CherryBomb: Explosion damage %d applied in range %.0f",
+    // 临时实现：输出日志
+    PVZ_LOGD(LogCategory::PLANT, "CherryBomb: Explosion damage %d applied in range %.0f",
         _explosionDamage, _explosionRange);
 }
 
 void CherryBomb::createExplosionEffect()
 {
-    // ըЧ
-    auto particle = ParticleExplosion::create();
-    if (particle)
-    {
-        particle->setPosition(this->getPosition());
-        particle->setDuration(0.5f);
-        particle->setSpeed(200.0f);
-        particle->setSpeedVar(50.0f);
-        particle->setLife(0.5f);
-        particle->setLifeVar(0.2f);
-        particle->setStartColor(Color4F(1.0f, 0.2f, 0.1f, 1.0f));
-        particle->setEndColor(Color4F(1.0f, 0.8f, 0.1f, 0.0f));
-        particle->setTotalParticles(50);
-
-        this->getParent()->addChild(particle, 10);
-
-        // ЧԶƳ
-        particle->runAction(Sequence::create(
-            DelayTime::create(1.0f),
-            RemoveSelf::create(),
-            nullptr
-        ));
-    }
+    // 爆炸粒子从特效池取（预设见Configs/particles.json），不再每次create
+    ParticleEffectPool::getInstance()->play(ParticleEffect::CHERRY_EXPLOSION, this->getPosition());
 
-    // ըӾЧ
+    // 创建爆炸冲击波视觉效果
     auto shockwave = Sprite::create();
     if (shockwave)
     {
@@ -149,13 +127,16 @@ void CherryBomb::createExplosionEffect()
         shockwave->setScale(0.1f);
         shockwave->setOpacity(150);
 
-        // ʹü򵥵Բɫ
+        // 使用简单的圆形纹理或颜色
         shockwave->setTextureRect(Rect(0, 0, 100, 100));
         shockwave->setColor(Color3B(255, 100, 0));
 
-        this->getParent()->addChild(shockwave, 9);
+        // 冲击波挂在特效层（压在所有行之上，在爆炸粒子之下）
+        auto entityLayers = EntityLayers::getActive();
+        Node* effectLayer = entityLayers ? entityLayers->getEffectLayer() : this->getParent();
+        effectLayer->addChild(shockwave, 9);
 
-        // 
+        // 冲击波动画
         auto scaleAction = ScaleTo::create(0.3f, _explosionRange / 50.0f);
         auto fadeAction = FadeOut::create(0.3f);
         auto removeAction = RemoveSelf::create();
@@ -171,14 +152,12 @@ void CherryBomb::createExplosionEffect()
 
 void CherryBomb::playExplosionSound()
 {
-    AudioManager::getInstance()->playSoundEffect(
-        ResourceLoader::getInstance()->getSoundEffectPath("sound_cherrybomb")
-    );
+    AudioManager::getInstance()->playSoundEffect(PVZ_ASSET_ID("sound_cherrybomb"));
 }
 
 void CherryBomb::onExplodingComplete()
 {
-    // ըɺƳֲ
+    // 爆炸动画完成后移除植物
     this->removeFromParent();
     _state = PlantState::DEAD;
     this->setVisible(false);
@@ -188,5 +167,5 @@ void CherryBomb::onExplodingComplete()
 void  CherryBomb::onDead(){
     
     this->_state = PlantState::DEAD;
-    log("CherryBomb: Explosion complete, plant removed");
+    PVZ_LOGD(LogCategory::PLANT, "CherryBomb: Explosion complete, plant removed");
 }
\ No newline at end of file
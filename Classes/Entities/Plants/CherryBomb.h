@@ -11,7 +11,7 @@ public:
 
     virtual bool init() override;
 
-    // ⷽ
+    // 特殊方法
     void explode();
     void createExplosionEffect();
     float getExplosionDelay() const { return _explosionDelay; }
@@ -19,14 +19,14 @@ public:
     int getExplosionDamage() const { return _explosionDamage; }
 
 protected:
-    // ը
-    float _explosionDelay;      // ըӳʱ
-    float _explosionRange;      // ըΧ
-    int _explosionDamage;       // ը˺
-    bool _isExploding;          // Ƿڱը
-    float _explosionTimer;      // ըʱ
-
-    // ǻ෽
+    // 爆炸相关属性
+    float _explosionDelay;      // 爆炸延迟时间
+    float _explosionRange;      // 爆炸范围
+    int _explosionDamage;       // 爆炸伤害
+    bool _isExploding;          // 是否正在爆炸
+    float _explosionTimer;      // 爆炸计时器
+
+    // 覆盖基类方法
     virtual void onIdle(float delta) override;
     //virtual void onExploding(float delta);
     virtual void onDead() override;
@@ -22,40 +22,15 @@ void Peashooter::attack(float delta)
 
 void Peashooter::shootPea()
 {
-    // Ч
-    AudioManager::getInstance()->playSoundEffect(
-        ResourceLoader::getInstance()->getSoundEffectPath("sound_shoot")
-    );
+    // 播放射击音效
+    AudioManager::getInstance()->playSoundEffect(PVZ_ASSET_ID("sound_shoot"));
 
-    // 㶹ӵ
-    auto pea = Projectile::create();
-    if (!pea)
+    // 从对象池取出豌豆子弹（从豌豆射手右侧发射）
+    auto gameManager = GameManager::getInstance();
+    if (gameManager)
     {
-        return;
-    }
-
-    // ʼ㶹ӵ
-    pea->initProjectile(ProjectileType::PEA, _attackDamage, 200.0f);
-
-    // ÷λã㶹Ҳ෢䣩
-    Vec2 launchPosition = this->getPosition() + Vec2(30, 55);
-    Vec2 direction = Vec2(1.0f, 0.0f);
-
-    // ÷
-    pea->setLaunchParams(launchPosition, direction);
-
-    // ȡڵ㲢ӵ
-    auto parent = this->getParent();
-    if (parent)
-    {
-        parent->addChild(pea, 5);
-
-        // ӵϷ
-        auto gameManager = GameManager::getInstance();
-        if (gameManager)
-        {
-            gameManager->addProjectile(pea);
-        }
+        Vec2 launchPosition = this->getPosition() + Vec2(30, 55);
+        gameManager->spawnProjectile(ProjectileType::PEA, _attackDamage, 200.0f, launchPosition, _row);
     }
 }
 
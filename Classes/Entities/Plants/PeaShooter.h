@@ -11,7 +11,7 @@ public:
 
     virtual bool init() override;
 
-    // 
+    // 攻击方法
     virtual void attack(float delta) override;
     virtual void onDead() override;
 
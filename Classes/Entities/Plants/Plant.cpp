@@ -1,11 +1,18 @@
-// Plant.cpp - ļ
+// Plant.cpp - 完整文件
 #include "Plant.h"
 #include "Entities/Zombie/Zombie.h"
 #include "./Resources/ResourceLoader.h"
 #include "./Game/WaveManager.h"
+#include "./Game/Logger.h"
+#include "./Game/SpriteAnimator.h"
 
 USING_NS_CC;
 
+Plant::~Plant()
+{
+    SpriteAnimator::getInstance()->stop(this);
+}
+
 bool Plant::init()
 {
     if (!Sprite::init())
@@ -13,7 +20,7 @@ bool Plant::init()
         return false;
     }
 
-    // ʼ
+    // 初始化
     _type = PlantType::SUNFLOWER;
     _state = PlantState::IDLE;
 
@@ -36,21 +43,22 @@ bool Plant::init()
     _row = -1;
     _col = -1;
 
-    // سʼ
-    _currentAnimate = nullptr;
+    // 动画相关初始化
+    _idleAnimationId = INVALID_ASSET_ID;
+    _attackAnimationId = INVALID_ASSET_ID;
+    _damagedAnimationId = INVALID_ASSET_ID;
+    _dyingAnimationId = INVALID_ASSET_ID;
+    _produceAnimationId = INVALID_ASSET_ID;
 
-    // Զȡ ResourceLoader 
+    // 自动获取 ResourceLoader 单例
     _resourceLoader = ResourceLoader::getInstance();
 
-    // ĬϴС
+    // 设置默认大小
     this->setContentSize(Size(50, 60));
 
-    // ê㣨ײģ
+    // 设置锚点（底部中心）
     this->setAnchorPoint(Vec2(0.5f, 0.0f));
 
-    // ø
-    this->scheduleUpdate();
-
     return true;
 }
 
@@ -62,15 +70,15 @@ bool Plant::initPlant(PlantType type, int sunCost, float cooldown, int health)
     _health = health;
     _maxHealth = health;
 
-    // 
+    // 根据类型设置属性
     switch (type)
     {
     case PlantType::SUNFLOWER:
         _canProduce = true;
         _produceInterval = 50.0f;
         _sunProduceAmount = 25;
-        _idleAnimationName = "sunflower_idle";
-        _produceAnimationName = "sunflower_produce";
+        _idleAnimationId = PVZ_ASSET_ID("sunflower_idle");
+        _produceAnimationId = PVZ_ASSET_ID("sunflower_produce");
         break;
 
     case PlantType::PEASHOOTER:
@@ -78,15 +86,15 @@ bool Plant::initPlant(PlantType type, int sunCost, float cooldown, int health)
         _attackRange = 800.0f;
         _attackSpeed = 0.25f;
         _attackDamage = 15;
-        _idleAnimationName = "peashooter_idle";
-        _attackAnimationName = "peashooter_attack";
+        _idleAnimationId = PVZ_ASSET_ID("peashooter_idle");
+        _attackAnimationId = PVZ_ASSET_ID("peashooter_attack");
         break;
 
     case PlantType::WALLNUT:
         _health = 400;
         _maxHealth = 400;
-        _idleAnimationName = "wallnut_idle";
-        _damagedAnimationName = "wallnut_damaged1";
+        _idleAnimationId = PVZ_ASSET_ID("wallnut_idle");
+        _damagedAnimationId = PVZ_ASSET_ID("wallnut_damaged1");
         break;
 
     case PlantType::SNOW_PEA:
@@ -94,63 +102,60 @@ bool Plant::initPlant(PlantType type, int sunCost, float cooldown, int health)
         _attackRange = 800.0f;
         _attackSpeed = 0.25f;
         _attackDamage = 15;
-        _idleAnimationName = "snowpea_idle";
-        _attackAnimationName = "snowpea_attack";
+        _idleAnimationId = PVZ_ASSET_ID("snowpea_idle");
+        _attackAnimationId = PVZ_ASSET_ID("snowpea_attack");
         break;
 
     case PlantType::POTATO_MINE:
-        _canAttack = false;  // ײ
-        _idleAnimationName = "potatomine_idle";
+        _canAttack = false;  // 土豆地雷不主动攻击
+        _idleAnimationId = PVZ_ASSET_ID("potatomine_idle");
         break;
 
     default:
         break;
     }
 
-    // ֱӳԲųʼresourceLoader
-    if (!_idleAnimationName.empty())
+    // 直接尝试播放初始动画（不依赖resourceLoader）
+    if (_idleAnimationId != INVALID_ASSET_ID)
     {
-        log("Plant::initPlant: Attempting to play idle animation: %s",
-            _idleAnimationName.c_str());
+        PVZ_LOGD(LogCategory::PLANT, "Plant::initPlant: Attempting to play idle animation: %s",
+            ResourceLoader::getInstance()->getAssetName(_idleAnimationId));
 
-        // ԴResourceLoaderȡУ
+        // 尝试从ResourceLoader获取动画（如果有）
         if (_resourceLoader)
         {
-            auto animation = _resourceLoader->getCachedAnimation(_idleAnimationName);
+            auto animation = _resourceLoader->getCachedAnimation(_idleAnimationId);
             if (animation)
             {
-                log("Plant::initPlant: Found animation in ResourceLoader cache");
-                auto animate = Animate::create(animation);
-                auto repeat = RepeatForever::create(animate);
-                this->runAction(repeat);
-                _currentAnimate = animate;
+                PVZ_LOGD(LogCategory::PLANT, "Plant::initPlant: Found animation in ResourceLoader cache");
+                SpriteAnimator::getInstance()->play(this, animation, true);
             }
             else
             {
-                log("Plant::initPlant: Animation not found in cache: %s",
-                    _idleAnimationName.c_str());
+                PVZ_LOGW(LogCategory::PLANT, "Plant::initPlant: Animation not found in cache: %s",
+                    ResourceLoader::getInstance()->getAssetName(_idleAnimationId));
             }
         }
         else
         {
-            log("Plant::initPlant: No ResourceLoader set, using fallback animation");
-            // ʹü򵥵ɫ仯Ϊö
+            PVZ_LOGD(LogCategory::PLANT, "Plant::initPlant: No ResourceLoader set, using fallback animation");
+            // 使用简单的颜色变化作为备用动画
             Plant::setupFallbackAnimation();
         }
     }
 
-    log("Plant: Initialized plant type %d, health: %d", (int)type, _health);
+    PVZ_LOGD(LogCategory::PLANT, "Plant: Initialized plant type %d, health: %d", (int)type, _health);
     return true;
 }
 
-// ӱö
+// 添加备用动画方法
 void Plant::setupFallbackAnimation()
 {
     switch (_type)
     {
     case PlantType::SUNFLOWER:
     {
-        // տıö΢źɫ仯
+        // 向日葵的备用动画：轻微的缩放和颜色变化
         auto scaleAction = RepeatForever::create(
             Sequence::create(
                 ScaleTo::create(1.0f, 1.05f),
@@ -173,7 +178,7 @@ void Plant::setupFallbackAnimation()
 
     case PlantType::PEASHOOTER:
     {
-        // 㶹ֵıöɫ仯
+        // 豌豆射手的备用动画：颜色变化
         auto idleAction = RepeatForever::create(
             Sequence::create(
                 TintTo::create(0.5f, Color3B(0, 200, 0)),
@@ -187,7 +192,7 @@ void Plant::setupFallbackAnimation()
 
     case PlantType::WALLNUT:
     {
-        // ǽıö΢ζ
+        // 坚果墙的备用动画：轻微晃动
         auto shakeAction = RepeatForever::create(
             Sequence::create(
                 RotateTo::create(0.5f, 1.0f),
@@ -206,19 +211,19 @@ void Plant::setupFallbackAnimation()
 
 void Plant::update(float delta)
 {
-    // Ƿ
+    // 检查是否存活
     if (!isAlive())
     {
         return;
     }
 
-    // ״ִ̬ӦΪ
+    // 根据状态执行相应行为
     switch (_state)
     {
     case PlantState::IDLE:
         onIdle(delta);
 
-        // ֲﳢԹ
+        // 攻击型植物尝试攻击
         if (_canAttack)
         {
             _attackTimer += delta;
@@ -232,7 +237,7 @@ void Plant::update(float delta)
             }
         }
 
-        // ֲ
+        // 生产型植物生产阳光
         if (_canProduce)
         {
             _produceTimer += delta;
@@ -254,7 +259,7 @@ void Plant::update(float delta)
 
     case PlantState::DAMAGED:
         onDamaged();
-        // ״̬󷵻IDLE
+        // 短暂受伤状态后返回IDLE
         _state = PlantState::IDLE;
         break;
 
@@ -273,20 +278,18 @@ bool Plant::hasZombieInAttackRange() {
     auto waveManager = WaveManager::getInstance();
     if (!waveManager) return false;
 
-    // ȡͬһеĽʬ
+    // 获取同一行的僵尸（按x升序）
     auto zombiesInRow = waveManager->getZombiesInRow(_row);
 
-    Vec2 plantPos = this->getPosition();
+    float plantX = this->getPositionX();
 
     for (auto zombie : zombiesInRow) {
         if (!zombie || !zombie->isAlive()) continue;
 
-        Vec2 zombiePos = zombie->getPosition();
-        float distance = std::abs(plantPos.x - zombiePos.x);
-
-        // 齩ʬǷڹΧڣǰ
-        if (zombiePos.x > plantPos.x && distance <= _attackRange) {
-            return true;
+        // 前方最近的僵尸决定结果，后面的只会更远
+        float zombieX = zombie->getPositionX();
+        if (zombieX > plantX) {
+            return zombieX - plantX <= _attackRange;
         }
     }
 
@@ -299,6 +302,12 @@ void Plant::setGridPosition(int row, int col)
     _col = col;
 }
 
+void Plant::updateTint(float delta)
+{
+    _tint.advance(delta);
+    _tint.apply(this);
+}
+
 void Plant::takeDamage(int damage)
 {
     if (!isAlive())
@@ -308,20 +317,18 @@ void Plant::takeDamage(int damage)
 
     _health -= damage;
 
-    // ˶
-    if (!_damagedAnimationName.empty())
+    // 播放受伤动画
+    if (_damagedAnimationId != INVALID_ASSET_ID)
     {
-        playAnimation(_damagedAnimationName, false);
+        playAnimation(_damagedAnimationId, false);
     }
     else
     {
-        // Ĭ˸Ч
-        auto tintAction = TintTo::create(0.1f, Color3B::RED);
-        auto reverseAction = TintTo::create(0.1f, this->getColor());
-        this->runAction(Sequence::create(tintAction, reverseAction, nullptr));
+        // 默认闪烁效果
+        _tint.start(TintOverlay::HIT_FLASH, 0.2f);
     }
 
-    log("Plant: Took %d damage, health remaining: %d", damage, _health);
+    PVZ_LOGT(LogCategory::PLANT, "Plant: Took %d damage, health remaining: %d", damage, _health);
 
     if (_health <= 0)
     {
@@ -337,37 +344,34 @@ void Plant::takeDamage(int damage)
 
 void Plant::attack(float delta)
 {
-    // Ϊʵ֣д
-    log("Plant: Attack!");
+    // 基类为空实现，子类重写
+    PVZ_LOGD(LogCategory::PLANT, "Plant: Attack!");
 }
 
 void Plant::produceSun()
 {
-    // Ϊʵ֣д
-    log("Plant: Produced sun!");
+    // 基类为空实现，子类重写
+    PVZ_LOGD(LogCategory::PLANT, "Plant: Produced sun!");
 }
 
 void Plant::die()
 {
     _state = PlantState::DYING;
 
-    // ֹͣж
+    // 停止所有动画
     stopCurrentAnimation();
     this->stopAllActions();
 
-    //ֹͣ
-    this->unscheduleUpdate();
-
-    // 
-    if (!_dyingAnimationName.empty())
+    // 播放死亡动画
+    if (_dyingAnimationId != INVALID_ASSET_ID)
     {
-        playAnimation(_dyingAnimationName, false, [this]() {
+        playAnimation(_dyingAnimationId, false, [this]() {
             onDyingComplete();
             });
     }
     else
     {
-        // ĬϵЧ
+        // 默认淡出效果
         auto fadeOut = FadeOut::create(0.5f);
         auto remove = RemoveSelf::create();
 
@@ -381,7 +385,7 @@ void Plant::die()
                     ));
     }
 
-    log("Plant: Died");
+    PVZ_LOGD(LogCategory::PLANT, "Plant: Died");
 }
 
 void Plant::setResourceLoader(ResourceLoader* loader)
@@ -394,86 +398,58 @@ void Plant::setAnimationHelper(AnimationHelper* helper)
     _animationHelper = helper;
 }
 
-void Plant::playAnimation(const std::string& animationName, bool loop,
+void Plant::playAnimation(AssetId animationId, bool loop,
     const std::function<void()>& callback)
 {
-    CCLOG("Plant::playAnimation: Attempting to play animation: %s, loop: %d", 
-        animationName.c_str(), loop);
+    PVZ_LOGT(LogCategory::PLANT, "Plant::playAnimation: Attempting to play animation: %s, loop: %d", 
+        ResourceLoader::getInstance()->getAssetName(animationId), loop);
     
-    // ֹͣǰ
+    // 停止当前动画
     stopCurrentAnimation();
     
-    // ȳԴResourceLoaderȡ
+    // 首先尝试从ResourceLoader获取动画
     if (_resourceLoader)
     {
-        auto animation = _resourceLoader->getCachedAnimation(animationName);
+        auto animation = _resourceLoader->getCachedAnimation(animationId);
         if (animation)
         {
-            CCLOG("Plant::playAnimation: Found animation in ResourceLoader cache");
-            
-            // Animate
-            Animate* animate = Animate::create(animation);
-            if (!animate)
-            {
-                CCLOG("Plant::playAnimation: Failed to create Animate from animation");
-                return;
-            }
-            
-            _currentAnimate = animate;
-            
-            if (loop)
-            {
-                auto repeat = RepeatForever::create(animate);
-                this->runAction(repeat);
-                CCLOG("Plant::playAnimation: Playing animation in loop mode");
-            }
-            else
-            {
-                if (callback)
-                {
-                    auto sequence = Sequence::create(animate, CallFunc::create(callback), nullptr);
-                    this->runAction(sequence);
-                }
-                else
-                {
-                    this->runAction(animate);
-                }
-                CCLOG("Plant::playAnimation: Playing animation once");
-            }
+            PVZ_LOGT(LogCategory::PLANT, "Plant::playAnimation: Found animation in ResourceLoader cache");
+
+            // 循环动画没有结束回调；单次动画播完后回调由SpriteAnimator延迟派发
+            SpriteAnimator::getInstance()->play(this, animation, loop, loop ? nullptr : callback);
+            PVZ_LOGT(LogCategory::PLANT, "Plant::playAnimation: Playing animation %s",
+                loop ? "in loop mode" : "once");
             return;
         }
         else
         {
-            CCLOG("Plant::playAnimation: Animation not found in ResourceLoader cache: %s", 
-                animationName.c_str());
+            PVZ_LOGT(LogCategory::PLANT, "Plant::playAnimation: Animation not found in ResourceLoader cache: %s", 
+                ResourceLoader::getInstance()->getAssetName(animationId));
         }
     }
     else
     {
-        CCLOG("Plant::playAnimation: No ResourceLoader available");
+        PVZ_LOGT(LogCategory::PLANT, "Plant::playAnimation: No ResourceLoader available");
     }
     
-    // ûResourceLoader򶯻ڻУʹñö
-    CCLOG("Plant::playAnimation: Using fallback animation for %s", animationName.c_str());
+    // 如果没有ResourceLoader或动画不在缓存中，使用备用动画
+    PVZ_LOGT(LogCategory::PLANT, "Plant::playAnimation: Using fallback animation for %s",
+        ResourceLoader::getInstance()->getAssetName(animationId));
     setupFallbackAnimation();
 }
 
-// һԴķ
+// 添加一个检查资源的方法
 void Plant::checkAndPlayIdleAnimation()
 {
-    if (!_idleAnimationName.empty())
+    if (_idleAnimationId != INVALID_ASSET_ID)
     {
-        playAnimation(_idleAnimationName, true);
+        playAnimation(_idleAnimationId, true);
     }
 }
 
 void Plant::stopCurrentAnimation()
 {
-    if (_currentAnimate)
-    {
-        this->stopAction(_currentAnimate);
-        _currentAnimate = nullptr;
-    }
+    SpriteAnimator::getInstance()->stop(this);
 }
 
 void Plant::onDyingComplete()
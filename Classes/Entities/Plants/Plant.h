@@ -1,28 +1,22 @@
-// Plant.h - ļ
+// Plant.h - 完整文件
 #ifndef __PLANT_H__
 #define __PLANT_H__
 
 #include "cocos2d.h"
+#include "Entities/EntityTypes.h"
+#include "Resources/AssetId.h"
+#include "Entities/TintCompositor.h"
 
 class AnimationHelper;
-// ֲö
-enum class PlantType {
-    SUNFLOWER,      // տ - Դ
-    PEASHOOTER,     // 㶹 - 
-    WALLNUT,        // ǽ - 
-    CHERRY_BOMB,    // ӣը - 
-    SNOW_PEA,       //  - 
-    POTATO_MINE     //  - 
-};
 
-// ֲ״̬
+// 植物状态
 enum class PlantState {
-    IDLE,           // 
-    ATTACKING,      // 
-    PRODUCING,      // Уտ
-    DAMAGED,        // 
-    DYING,          // 
-    DEAD            // 
+    IDLE,           // 闲置
+    ATTACKING,      // 攻击中
+    PRODUCING,      // 生产中（向日葵）
+    DAMAGED,        // 受伤
+    DYING,          // 死亡中
+    DEAD            // 死亡
 };
 
 class ResourceLoader;
@@ -32,6 +26,7 @@ class PNGAnimationHelper;
 class Plant : public cocos2d::Sprite {
 public:
     CREATE_FUNC(Plant);
+    virtual ~Plant();
 
     virtual bool init() override;
     void setupFallbackAnimation();
@@ -39,10 +34,10 @@ public:
 
     bool hasZombieInAttackRange();
 
-    // ʼֲ
+    // 初始化植物
     bool initPlant(PlantType type, int sunCost, float cooldown, int health);
 
-    // ֲ
+    // 植物属性
     PlantType getType() const { return _type; }
     int getSunCost() const { return _sunCost; }
     float getCooldown() const { return _cooldown; }
@@ -52,43 +47,47 @@ public:
     int getRow() const { return _row; }
     int getCol() const { return _col; }
 
-    // λ
+    // 设置位置
     void setGridPosition(int row, int col);
 
-    // ֲΪ
+    // 植物行为
     virtual void takeDamage(int damage);
-    virtual void attack(float delta);          // ֲʹ
-    virtual void produceSun();                 // Դֲʹ
+    virtual void attack(float delta);          // 攻击型植物使用
+    virtual void produceSun();                 // 资源型植物使用
     virtual void die();
 
-    // ״̬
+    // 状态检查
     bool isAlive() const { return _state != PlantState::DEAD && _state != PlantState::DYING; }
     bool canAttack() const { return _canAttack; }
 
-    // Դ
+    // 设置资源加载器
     void setResourceLoader(ResourceLoader* loader);
 
-    // ö
+    // 设置动画辅助器
     void setAnimationHelper(AnimationHelper* helper);
 
-    // Ŷ
-    void playAnimation(const std::string& animationName, bool loop = false,
+    // 播放动画（动画名的AssetId，如PVZ_ASSET_ID("peashooter_idle")）
+    void playAnimation(AssetId animationId, bool loop = false,
         const std::function<void()>& callback = nullptr);
 
     void checkAndPlayIdleAnimation();
 
-    // ֹͣǰ
+    // 着色（受击闪红、樱桃炸弹引信闪烁等，由GameScene每帧统一推进并写回颜色）
+    TintCompositor& getTint() { return _tint; }
+    void updateTint(float delta);
+
+    // 停止当前动画（帧动画由SpriteAnimator统一推进）
     void stopCurrentAnimation();
 
-    // ö
-    void setIdleAnimation(const std::string& name) { _idleAnimationName = name; }
-    void setAttackAnimation(const std::string& name) { _attackAnimationName = name; }
-    void setDamagedAnimation(const std::string& name) { _damagedAnimationName = name; }
-    void setDyingAnimation(const std::string& name) { _dyingAnimationName = name; }
-    void setProduceAnimation(const std::string& name) { _produceAnimationName = name; }
+    // 设置动画（动画名的AssetId）
+    void setIdleAnimation(AssetId id) { _idleAnimationId = id; }
+    void setAttackAnimation(AssetId id) { _attackAnimationId = id; }
+    void setDamagedAnimation(AssetId id) { _damagedAnimationId = id; }
+    void setDyingAnimation(AssetId id) { _dyingAnimationId = id; }
+    void setProduceAnimation(AssetId id) { _produceAnimationId = id; }
 
 protected:
-    // дĺ
+    // 子类可重写的函数
     virtual void onIdle(float delta) {}
     virtual void onAttack(float delta) {}
     virtual void onProduce(float delta) {}
@@ -96,51 +95,50 @@ protected:
     virtual void onDying() {}
     virtual void onDead() {}
 
-    // ɻص
+    // 动画完成回调
     void onDyingComplete();
 
 protected:
     PlantType _type;
     PlantState _state;
 
-    // 
+    // 基本属性
     int _sunCost;
     float _cooldown;
     int _health;
     int _maxHealth;
 
-    // 
+    // 攻击属性
     bool _canAttack;
     float _attackRange;
     float _attackSpeed;
     int _attackDamage;
     float _attackTimer;
 
-    // ԣտ
+    // 生产属性（向日葵）
     bool _canProduce;
     float _produceInterval;
     int _sunProduceAmount;
     float _produceTimer;
 
-    // λ
+    // 位置
     int _row;
     int _col;
 
-    // 
-    std::string _idleAnimationName;
-    std::string _attackAnimationName;
-    std::string _damagedAnimationName;
-    std::string _dyingAnimationName;
-    std::string _produceAnimationName;
+    // 动画相关
+    AssetId _idleAnimationId;
+    AssetId _attackAnimationId;
+    AssetId _damagedAnimationId;
+    AssetId _dyingAnimationId;
+    AssetId _produceAnimationId;
 
-    // 
-    cocos2d::Animate* _currentAnimate;
-
-    // Դ
+    // 资源加载器引用
     ResourceLoader* _resourceLoader;
 
-    // 
+    // 动画辅助类引用
     AnimationHelper* _animationHelper;
+
+    TintCompositor _tint;
 };
 
 #endif // __PLANT_H__
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "CherryBomb.h"
 #include "SnowPea.h"
 #include "PotatoMine.h"
+#include "Game/GameTuning.h"
 
 class PlantFactory {
 public:
@@ -47,28 +48,13 @@ public:
         return plant;
     }
 
+    // 阳光消耗和冷却与无头模拟共用GameTuning的数值表
     static int getSunCost(PlantType type) {
-        switch (type) {
-        case PlantType::SUNFLOWER: return 50;
-        case PlantType::PEASHOOTER: return 100;
-        case PlantType::WALLNUT: return 50;
-        case PlantType::CHERRY_BOMB: return 150;
-        case PlantType::SNOW_PEA: return 150;
-        case PlantType::POTATO_MINE: return 25;
-        default: return 0;
-        }
+        return GameTuning::plantSunCost(type);
     }
 
     static float getCooldown(PlantType type) {
-        switch (type) {
-        case PlantType::SUNFLOWER: return 7.5f;
-        case PlantType::PEASHOOTER: return 7.5f;
-        case PlantType::WALLNUT: return 15.0f;
-        case PlantType::CHERRY_BOMB: return 22.5f;
-        case PlantType::SNOW_PEA: return 7.5f;
-        case PlantType::POTATO_MINE: return 15.0f;
-        default: return 0.0f;
-        }
+        return GameTuning::plantCooldown(type);
     }
 
     static int getHealth(PlantType type) {
@@ -4,6 +4,9 @@
 #include "./Resources/ResourceLoader.h"
 #include <Entities/Zombie/Zombie.h>
 #include <Game/WaveManager.h>
+#include "./Game/Logger.h"
+#include "./Game/EntityLayers.h"
+#include "./Game/ParticleEffectPool.h"
 
 USING_NS_CC;
 
@@ -14,24 +17,24 @@ bool PotatoMine::init()
         return false;
     }
 
-    // õ
-    _armingTime = 20.0f;          // 20׼ʱ
-    _armingTimer = 0.0f;          // ׼ʱ
-    _isArmed = false;             // ʼδ
-    _isTriggered = false;         // ʼδ
+    // 设置地雷属性
+    _armingTime = 20.0f;          // 20秒准备时间
+    _armingTimer = 0.0f;          // 准备计时器
+    _isArmed = false;             // 初始未激活
+    _isTriggered = false;         // 初始未触发
 
-    _triggerRange = 30.0f;        // Χʬ˷Χ
-    _explosionRange = 80.0f;     // ըΧʵ˺ΧڴΧ
-    _explosionDamage = 200;      // ը˺ɱͨʬ
+    _triggerRange = 30.0f;        // 触发范围（僵尸进入此范围即触发）
+    _explosionRange = 80.0f;     // 爆炸范围（实际伤害范围，大于触发范围）
+    _explosionDamage = 200;      // 爆炸伤害，秒杀普通僵尸
 
-    // ö
-    setIdleAnimation("potatomine_idle");      // δ״̬
-    setDyingAnimation("potatomine_explode");  // ը
+    // 设置动画名称
+    setIdleAnimation(PVZ_ASSET_ID("potatomine_idle"));      // 未激活状态
+    setDyingAnimation(PVZ_ASSET_ID("potatomine_explode"));  // 爆炸动画
 
-    // ųʼδ״̬
+    // 播放初始动画（未激活状态）
     checkAndPlayIdleAnimation();
 
-    log("PotatoMine: Initialized with arming time: %.1f, trigger range: %.1f, explosion range: %.1f, damage: %d",
+    PVZ_LOGD(LogCategory::PLANT, "PotatoMine: Initialized with arming time: %.1f, trigger range: %.1f, explosion range: %.1f, damage: %d",
         _armingTime, _triggerRange, _explosionRange, _explosionDamage);
 
     return true;
@@ -39,29 +42,29 @@ bool PotatoMine::init()
 
 void PotatoMine::onIdle(float delta)
 {
-    // Ѵ
+    // 如果已触发或死亡，不处理
     if (_isTriggered || !isAlive() || _state == PlantState::DYING)
     {
         return;
     }
 
-    // δ׼ʱ
+    // 如果还未激活，进行准备计时
     if (!_isArmed)
     {
         _armingTimer += delta;
 
-        // Ƿ׼
+        // 检查是否完成准备
         if (_armingTimer >= _armingTime)
         {
-            arm();  // 
+            arm();  // 激活地雷
         }
         else
         {
-            // ׼˸ʾ5룩
+            // 准备过程中闪烁提示（最后5秒）
             float timeLeft = _armingTime - _armingTimer;
             if (timeLeft <= 5.0f)
             {
-                // ÿ0.5˸һ
+                // 每0.5秒闪烁一次
                 static float flashTimer = 0.0f;
                 flashTimer += delta;
                 if (flashTimer >= 0.5f)
@@ -76,10 +79,10 @@ void PotatoMine::onIdle(float delta)
     }
     else
     {
-        // ѼǷнʬڴΧ
+        // 已激活，检查是否有僵尸在触发范围内
         if (PotatoMine::checkZombieInTriggerRange())
         {
-            trigger();  // ը
+            trigger();  // 触发爆炸
         }
     }
 }
@@ -90,20 +93,20 @@ void PotatoMine::arm()
 
     _isArmed = true;
 
-    // ֹͣǰidle
+    // 停止当前idle动画
     this->stopAllActions();
     stopCurrentAnimation();
 
-    // ȫɼȷ͸
+    // 设置完全可见（确保不透明）
     this->setOpacity(255);
 
-    // ż
-    playAnimation("potatomine_armed", true);
+    // 播放激活动画
+    playAnimation(PVZ_ASSET_ID("potatomine_armed"), true);
 
-    // żЧ
+    // 播放激活音效
     playArmingSound();
 
-    log("PotatoMine: Armed and ready!");
+    PVZ_LOGI(LogCategory::PLANT, "PotatoMine: Armed and ready!");
 }
 
 void PotatoMine::trigger()
@@ -113,31 +116,31 @@ void PotatoMine::trigger()
     _isTriggered = true;
     _state = PlantState::DYING;
 
-    log("PotatoMine: Triggered! Exploding...");
+    PVZ_LOGI(LogCategory::PLANT, "PotatoMine: Triggered! Exploding...");
 
-    // ֹͣж
+    // 停止所有动作
     this->stopAllActions();
 
-    // űը
-    playAnimation("potatomine_explode", false, [this]() {
+    // 播放爆炸动画
+    playAnimation(PVZ_ASSET_ID("potatomine_explode"), false, [this]() {
         this->onExplosionComplete();
         });
 
-    // űըЧ
+    // 播放爆炸音效
     playExplosionSound();
 
-    // ըЧ
+    // 创建爆炸特效
     createMineEffect();
 
-    // 㱬ըΧ - ֻӰͬһеڽʬ
+    // 计算爆炸范围 - 只影响同一行的相邻僵尸
     Vec2 minePos = this->getPosition();
     float rangeSquared = _explosionRange * _explosionRange;
 
-    // ԱըΧڵĽʬ˺
+    // 对爆炸范围内的僵尸造成伤害
     auto waveManager = WaveManager::getInstance();
     if (waveManager)
     {
-        // ֻȡͬһеĽʬ
+        // 只获取同一行的僵尸
         auto zombiesInRow = waveManager->getZombiesInRow(_row);
         for (auto zombie : zombiesInRow)
         {
@@ -148,9 +151,9 @@ void PotatoMine::trigger()
 
                 if (distanceSquared <= rangeSquared)
                 {
-                    // Խʬ˺
+                    // 对僵尸造成伤害
                     zombie->takeDamage(_explosionDamage);
-                    log("PotatoMine: Zombie at distance %.1f hit with explosion damage: %d",
+                    PVZ_LOGT(LogCategory::PLANT, "PotatoMine: Zombie at distance %.1f hit with explosion damage: %d",
                         sqrt(distanceSquared), _explosionDamage);
                 }
             }
@@ -165,11 +168,11 @@ bool PotatoMine::checkZombieInTriggerRange()
     auto waveManager = WaveManager::getInstance();
     if (!waveManager) return false;
 
-    // ֻͬһеĽʬ
+    // 只检查同一行的僵尸
     auto zombiesInRow = waveManager->getZombiesInRow(_row);
 
     Vec2 minePos = this->getPosition();
-    float range = _triggerRange;  // ʹôΧм
+    float range = _triggerRange;  // 使用触发范围进行检测
 
     for (auto zombie : zombiesInRow)
     {
@@ -178,10 +181,10 @@ bool PotatoMine::checkZombieInTriggerRange()
         Vec2 zombiePos = zombie->getPosition();
         float distance = minePos.distance(zombiePos);
 
-        // 齩ʬǷڵ׵ĴΧ
+        // 检查僵尸是否在地雷的触发范围内
         if (distance <= range)
         {
-            log("PotatoMine: Zombie detected in trigger range at distance %.1f (range: %.1f)", distance, range);
+            PVZ_LOGT(LogCategory::PLANT, "PotatoMine: Zombie detected in trigger range at distance %.1f (range: %.1f)", distance, range);
             return true;
         }
     }
@@ -191,30 +194,10 @@ bool PotatoMine::checkZombieInTriggerRange()
 
 void PotatoMine::createMineEffect()
 {
-    // ըЧ
-    auto particle = ParticleExplosion::create();
-    if (particle)
-    {
-        particle->setPosition(this->getPosition());
-        particle->setDuration(0.4f);
-        particle->setSpeed(200.0f);
-        particle->setSpeedVar(50.0f);
-        particle->setLife(0.4f);
-        particle->setLifeVar(0.1f);
-        particle->setStartColor(Color4F(1.0f, 0.6f, 0.1f, 1.0f));
-        particle->setEndColor(Color4F(1.0f, 0.9f, 0.2f, 0.0f));
-        particle->setTotalParticles(40);
-
-        this->getParent()->addChild(particle, 10);
-
-        particle->runAction(Sequence::create(
-            DelayTime::create(0.8f),
-            RemoveSelf::create(),
-            nullptr
-        ));
-    }
+    // 爆炸粒子从特效池取（预设见Configs/particles.json），不再每次create
+    ParticleEffectPool::getInstance()->play(ParticleEffect::MINE_EXPLOSION, this->getPosition());
 
-    // ڱըΧ
+    // 创建冲击波，基于爆炸范围
     auto shockwave = Sprite::create();
     if (shockwave)
     {
@@ -222,13 +205,16 @@ void PotatoMine::createMineEffect()
         shockwave->setScale(0.1f);
         shockwave->setOpacity(200);
 
-        // Բ
+        // 创建圆形纹理
         shockwave->setTextureRect(Rect(0, 0, 100, 100));
         shockwave->setColor(Color3B(255, 150, 0));
 
-        this->getParent()->addChild(shockwave, 9);
+        // 冲击波挂在特效层（压在所有行之上，在爆炸粒子之下）
+        auto entityLayers = EntityLayers::getActive();
+        Node* effectLayer = entityLayers ? entityLayers->getEffectLayer() : this->getParent();
+        effectLayer->addChild(shockwave, 9);
 
-        // СڱըΧ
+        // 冲击波大小基于爆炸范围
         auto scaleAction = ScaleTo::create(0.3f, _explosionRange / 50.0f * 2.0f);
         auto fadeAction = FadeOut::create(0.3f);
 
@@ -245,7 +231,7 @@ void PotatoMine::playArmingSound()
     auto audioManager = AudioManager::getInstance();
     if (audioManager)
     {
-        audioManager->playSoundEffect("Sounds/SFX/plant_planted.mp3");
+        audioManager->playSoundEffect(PVZ_ASSET_ID("sound_plant_planted"));
     }
 }
 
@@ -254,13 +240,13 @@ void PotatoMine::playExplosionSound()
     auto audioManager = AudioManager::getInstance();
     if (audioManager)
     {
-        audioManager->playSoundEffect("Sounds/SFX/explosion.mp3");
+        audioManager->playSoundEffect(PVZ_ASSET_ID("sound_explosion"));
     }
 }
 
 void PotatoMine::onExplosionComplete()
 {
-    // ըɺƳֲ
+    // 爆炸动画完成后移除植物
     //this->removeFromParent();
     this->setVisible(false);
     _state = PlantState::DEAD;
@@ -270,5 +256,5 @@ void PotatoMine::onExplosionComplete()
 void PotatoMine::onDead()
 {
     this->_state = PlantState::DEAD;
-    log("PotatoMine: Explosion complete, plant removed");
+    PVZ_LOGD(LogCategory::PLANT, "PotatoMine: Explosion complete, plant removed");
 }
\ No newline at end of file
@@ -22,40 +22,15 @@ void SnowPea::attack(float delta)
 
 void SnowPea::shootIcePea()
 {
-    // Чʹͨ㶹ͬЧ
-    AudioManager::getInstance()->playSoundEffect(
-        ResourceLoader::getInstance()->getSoundEffectPath("sound_shoot")
-    );
+    // 播放射击音效（可以使用与普通豌豆不同的音效）
+    AudioManager::getInstance()->playSoundEffect(PVZ_ASSET_ID("sound_shoot"));
 
-    // 㶹ӵ
-    auto icePea = Projectile::create();
-    if (!icePea)
+    // 从对象池取出寒冰豌豆子弹（向右发射，稍微偏移）
+    auto gameManager = GameManager::getInstance();
+    if (gameManager)
     {
-        return;
-    }
-
-    // ʼ㶹ӵ
-    icePea->initProjectile(ProjectileType::SNOW_PEA, _attackDamage, 200.0f);
-
-    // ÷λúͷ򣨻ֲĳ
-    Vec2 launchPosition = this->getPosition() + Vec2(30, 55);  // ΢ƫ
-    Vec2 direction = Vec2(1.0f, 0.0f);  // ҷ
-
-    // ÷
-    icePea->setLaunchParams(launchPosition, direction);
-
-    // ӵ
-    auto parent = this->getParent();
-    if (parent)
-    {
-        parent->addChild(icePea, 5);
-
-        // ֪ͨϷӵ
-        auto gameManager = GameManager::getInstance();
-        if (gameManager)
-        {
-            gameManager->addProjectile(icePea);
-        }
+        Vec2 launchPosition = this->getPosition() + Vec2(30, 55);
+        gameManager->spawnProjectile(ProjectileType::SNOW_PEA, _attackDamage, 200.0f, launchPosition, _row);
     }
 }
 
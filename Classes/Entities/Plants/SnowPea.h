@@ -12,7 +12,7 @@ public:
 
     virtual bool init() override;
 
-    // ʽ
+    // 攻击方式
     virtual void attack(float delta) override;
     virtual void onDead() override;
 
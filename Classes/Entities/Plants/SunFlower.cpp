@@ -1,7 +1,10 @@
 #include "Sunflower.h"
 #include "./Game/GameManager.h"
+#include "./Game/GameTuning.h"
+#include "./Game/SunManager.h"
 #include "./Resources/AudioManager.h"
 #include "./Resources/ResourceLoader.h" 
+#include "./Game/Logger.h"
 
 USING_NS_CC;
 
@@ -12,17 +15,18 @@ bool Sunflower::init()
         return false;
     }
 
-    // ʼտ
+    // 初始化向日葵属性
     initPlant(PlantType::SUNFLOWER, 50, 7.5f, 100);
 
-    // տ
-    _produceInterval = 25.0f; // ÿ24һ
+    // 设置向日葵特有属性
+    _produceInterval = GameTuning::SUNFLOWER_INTERVAL;
 
-    // ɫʹС
-    this->setColor(Color3B(255, 255, 0)); // ɫ
+    // 设置颜色和大小
+    _tint.setBaseColor(Color3B(255, 255, 0)); // 黄色
+    _tint.apply(this);
     this->setContentSize(Size(60, 80));
 
-    // Ӻ
+    // 添加呼吸动画
     auto idleAction = RepeatForever::create(
         Sequence::create(
             ScaleTo::create(1.0f, 1.05f),
@@ -32,7 +36,7 @@ bool Sunflower::init()
     );
     this->runAction(idleAction);
 
-    // ɫ
+    // 添加颜色波动动画
     auto colorAction = RepeatForever::create(
         Sequence::create(
             TintTo::create(1.0f, Color3B(255, 255, 100)),
@@ -57,128 +61,15 @@ void Sunflower::onDead()
 
 void Sunflower::createSun()
 {
-    log("Sunflower: Producing sun!");
+    PVZ_LOGD(LogCategory::PLANT, "Sunflower: Producing sun!");
 
-    // Ч
+    // 播放生产音效
     auto audioManager = AudioManager::getInstance();
     if (audioManager)
     {
-        audioManager->playSoundEffect("Sounds/SFX/sun_produced.mp3");
+        audioManager->playSoundEffect(PVZ_ASSET_ID("sound_sun_produced"));
     }
 
-    // ȡResourceLoaderʵ
-    auto resourceLoader = ResourceLoader::getInstance();
-
-    // ̫
-    Sprite* sun = nullptr;
-
-    if (resourceLoader && resourceLoader->hasAnimation("sun_floating"))
-    {
-        // ʹö̫
-        log("Sunflower: Creating sun with sun_floating animation");
-
-        // ȡ
-        auto animation = resourceLoader->getCachedAnimation("sun_floating");
-        if (animation)
-        {
-            // һŶ
-            sun = Sprite::create();
-
-            // һAnimate
-            auto animate = Animate::create(animation);
-            if (animate)
-            {
-                // ѭŶ
-                auto repeatAnimation = RepeatForever::create(animate);
-                sun->runAction(repeatAnimation);
-            }
-        }
-    }
-
-    // ʧܣʹü򵥵ͼΪ
-    if (!sun)
-    {
-        log("Sunflower: Using fallback sun graphic");
-        sun = Sprite::create();
-        sun->setTextureRect(Rect(0, 0, 30, 30));
-        sun->setColor(Color3B(255, 255, 0));
-    }
-
-    // λãտϷ
-    auto sunflowerPos = this->getPosition();
-    sun->setPosition(sunflowerPos + Vec2(0, 80));
-
-    // ȡڵ㲢
-    auto parent = this->getParent();
-    if (parent)
-    {
-        parent->addChild(sun, 10); // ߲㼶
-
-        // ⸡
-        auto floatAction = RepeatForever::create(
-            Sequence::create(
-                MoveBy::create(0.5f, Vec2(0, 10)),
-                MoveBy::create(0.5f, Vec2(0, -10)),
-                nullptr
-            )
-        );
-        sun->runAction(floatAction);
-
-        // ת
-        auto rotateAction = RepeatForever::create(
-            RotateBy::create(2.0f, 360)
-        );
-        sun->runAction(rotateAction);
-
-        // ӵռ
-        auto listener = EventListenerTouchOneByOne::create();
-        listener->setSwallowTouches(true);
-        listener->onTouchBegan = [sun, parent](Touch* touch, Event* event) {
-            Vec2 locationInNode = sun->convertToNodeSpace(touch->getLocation());
-            Size s = sun->getContentSize();
-            Rect rect = Rect(0, 0, s.width, s.height);
-
-            if (rect.containsPoint(locationInNode))
-            {
-                // ռЧ
-                auto audioManager = AudioManager::getInstance();
-                if (audioManager)
-                {
-                    audioManager->playSoundEffect("Sounds/SFX/sun_collected.mp3");
-                }
-
-                // 
-                auto gameManager = GameManager::getInstance();
-                if (gameManager)
-                {
-                    gameManager->addSun(25);
-                }
-
-                // ռ
-                auto scaleUp = ScaleTo::create(0.1f, 1.5f);
-                auto fadeOut = FadeOut::create(0.1f);
-                auto remove = RemoveSelf::create();
-
-                sun->runAction(Sequence::create(
-                    scaleUp,
-                    Spawn::create(fadeOut, scaleUp->clone(), nullptr),
-                    remove,
-                    nullptr
-                ));
-
-                return true;
-            }
-            return false;
-        };
-
-        parent->getEventDispatcher()->addEventListenerWithSceneGraphPriority(listener, sun);
-
-        // Զʧ10
-        sun->runAction(Sequence::create(
-            DelayTime::create(10.0f),
-            FadeOut::create(0.5f),
-            RemoveSelf::create(),
-            nullptr
-        ));
-    }
+    // 阳光出现在向日葵上方，由SunManager的阳光池负责动画和收集
+    SunManager::getInstance()->spawnProducedSun(this->getPosition() + Vec2(0, 80));
 }
\ No newline at end of file
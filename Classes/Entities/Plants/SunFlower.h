@@ -10,7 +10,7 @@ public:
 
     virtual bool init() override;
 
-    // ⷽ
+    // 生产阳光方法
     virtual void produceSun() override;
     virtual void onDead() override;
 
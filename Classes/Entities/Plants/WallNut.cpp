@@ -1,4 +1,5 @@
 #include "WallNut.h"
+#include "./Game/Logger.h"
 
 USING_NS_CC;
 
@@ -9,16 +10,16 @@ bool WallNut::init()
         return false;
     }
 
-    // üǽ
+    // 设置坚果墙特有属性
     _crackLevel = 0;
 
     /*
-    // ɫʹСɫ
+    // 设置颜色和大小（棕色）
     this->setColor(Color3B(139, 69, 19));
     this->setContentSize(Size(60, 70));
     */
 
-    // ΢ζּ̣
+    // 添加轻微晃动动画（表现坚固）
     auto shakeAction = RepeatForever::create(
         Sequence::create(
             RotateTo::create(0.5f, 1.0f),
@@ -39,33 +40,33 @@ void WallNut::takeDamage(int damage)
 
 void WallNut::updateCrackLevel()
 {
-    // ֵٷֱȸѷȼ
+    // 根据生命值百分比更新裂缝等级
     float healthPercent = (float)_health / (float)_maxHealth;
 
     int newCrackLevel = 0;
     if (healthPercent < 0.33f)
     {
-        newCrackLevel = 2; // ѷ
+        newCrackLevel = 2; // 严重裂缝
     }
     else if (healthPercent < 0.66f)
     {
-        newCrackLevel = 1; // ΢ѷ
+        newCrackLevel = 1; // 轻微裂缝
     }
 
     if (newCrackLevel != _crackLevel)
     {
         _crackLevel = newCrackLevel;
 
-        // ѷȼıɫ
+        // 根据裂缝等级改变颜色
         if (_crackLevel == 1)
         {
-            this->setColor(Color3B(160, 80, 30)); // ǳһ
+            _tint.setBaseColor(Color3B(160, 80, 30)); // 变浅一点
         }
         else if (_crackLevel == 2)
         {
-            this->setColor(Color3B(180, 100, 40)); // ǳ
+            _tint.setBaseColor(Color3B(180, 100, 40)); // 更浅
 
-            // ˸Чʾ
+            // 添加闪烁效果表示严重损坏
             auto blinkAction = RepeatForever::create(
                 Sequence::create(
                     FadeTo::create(0.2f, 150),
@@ -76,6 +77,6 @@ void WallNut::updateCrackLevel()
             this->runAction(blinkAction);
         }
 
-        log("WallNut: Crack level updated to %d", _crackLevel);
+        PVZ_LOGD(LogCategory::PLANT, "WallNut: Crack level updated to %d", _crackLevel);
     }
 }
\ No newline at end of file
@@ -10,12 +10,12 @@ public:
 
     virtual bool init() override;
 
-    // ʱ⴦
+    // 受伤时的特殊处理
     virtual void takeDamage(int damage) override;
 
 private:
     void updateCrackLevel();
-    int _crackLevel; // ѷȼ0-2
+    int _crackLevel; // 裂缝等级（0-2）
 };
 
 #endif // __WALLNUT_H__
\ No newline at end of file
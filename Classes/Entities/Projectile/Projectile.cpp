@@ -2,11 +2,19 @@
 #include "./Resources/ResourceLoader.h"
 #include "./Entities/Zombie/Zombie.h"
 #include <Game/WaveManager.h>
+#include "./Game/Logger.h"
+#include "./Game/SpriteAnimator.h"
+#include "./Game/ParticleEffectPool.h"
 
 //#include "./Utils/AnimationHelper.h"
 
 USING_NS_CC;
 
+Projectile::~Projectile()
+{
+    SpriteAnimator::getInstance()->stop(this);
+}
+
 bool Projectile::init()
 {
     if (!Sprite::init())
@@ -14,7 +22,7 @@ bool Projectile::init()
         return false;
     }
 
-    // ʼĬֵ
+    // 初始化默认值
     _type = ProjectileType::PEA;
     _state = ProjectileState::FLYING;
 
@@ -26,20 +34,28 @@ bool Projectile::init()
     _direction = Vec2::ZERO;
     _velocity = Vec2::ZERO;
     _rotationSpeed = 0.0f;
+    _row = -1;
+    _sweepFromX = 0.0f;
+    _hasPrevSimPosition = false;
+    _isInterpolated = false;
+    _isPooled = false;
+
+    _damageType = DamageType::SINGLE_TARGET;
+    _splashRadius = 0.0f;
+    _damageFalloff = 1.0f;
 
     _hasTrailEffect = false;
     _hasHitEffect = false;
     _effectTimer = 0.0f;
 
     _resourceLoader = ResourceLoader::getInstance();
-    _currentAnimate = nullptr;
+    _flyAnimationId = INVALID_ASSET_ID;
+    _hitAnimationId = INVALID_ASSET_ID;
+    _explodeAnimationId = INVALID_ASSET_ID;
 
-    // Ĭê
+    // 设置默认锚点
     this->setAnchorPoint(Vec2(0.5f, 0.5f));
 
-    // ø
-    this->scheduleUpdate();
-
     return true;
 }
 
@@ -48,19 +64,26 @@ bool Projectile::initProjectile(ProjectileType type, int damage, float speed,
     _type = type;
     _damage = damage;
     _speed = speed;
+    _damageType = damageType;
+    _hasHitEffect = false;
 
-    // 
+    // 根据类型设置属性
     switch (type)
     {
     case ProjectileType::PEA:
-        _flyAnimationName = "pea_fly";
-        _hitAnimationName = "pea_hit";
+        _flyAnimationId = PVZ_ASSET_ID("pea_fly");
+        _hitAnimationId = PVZ_ASSET_ID("pea_hit");
         _maxLifeTime = 4.0f;
+        _hasHitEffect = true;
         break;
     case ProjectileType::SNOW_PEA:
-        _flyAnimationName = "snow_pea_fly";
-        _hitAnimationName = "pea_hit";
+        _flyAnimationId = PVZ_ASSET_ID("snow_pea_fly");
+        _hitAnimationId = PVZ_ASSET_ID("pea_hit");
         _maxLifeTime = 4.0f;
+        _hasHitEffect = true;
+        break;
+    case ProjectileType::FIRE_PEA:
+        _hasHitEffect = true;
         break;
     default:
         break;
@@ -78,23 +101,23 @@ void Projectile::update(float delta)
 
     _lifeTime += delta;
 
-    // ʱ
+    // 检查生存时间
     if (_lifeTime >= _maxLifeTime)
     {
         destroy();
         return;
     }
 
-    // ״̬
+    // 根据状态更新
     switch (_state)
     {
     case ProjectileState::FLYING:
+        // 碰撞由GameManager按行统一检测（扫掠区间从_sweepFromX到当前位置）
         fly(delta);
-        checkZombieCollisions();
         break;
 
     case ProjectileState::HIT:
-        // ӳٺ
+        // 短暂延迟后销毁
         this->scheduleOnce([this](float dt) {
             destroy();
             }, 0.05f, "delayed_destroy");
@@ -105,119 +128,143 @@ void Projectile::update(float delta)
     }
 }
 
-void Projectile::checkZombieCollisions() {
+bool Projectile::handleZombieHit(Zombie* zombie, float hitX) {
     if (_state != ProjectileState::FLYING) {
-        return;
+        return true;
+    }
+    if (!zombie || !zombie->isAlive()) {
+        return false;
     }
 
-    auto waveManager = WaveManager::getInstance();
-    if (!waveManager) return;
-
-    const auto& zombies = waveManager->getActiveZombies();
-    Rect projectileRect = this->getBoundingBox();
-
-    bool hitSomething = false;
-
-    for (auto zombie : zombies) {
-        if (!zombie || !zombie->isAlive()) continue;
+    // 对僵尸造成伤害
+    applyDamageToZombie(zombie);
 
-        Rect zombieRect = zombie->getBoundingBox();
+    // 单体伤害子弹停在命中点，只攻击一个目标
+    if (_damageType == DamageType::SINGLE_TARGET) {
+        this->setPositionX(hitX);
+        hitTarget();
+        return true;
+    }
 
-        if (projectileRect.intersectsRect(zombieRect)) {
-            hitSomething = true;
+    // 范围伤害击中后继续飞行直到消失或超时
+    return false;
+}
 
-            // Խʬ˺
-            applyDamageToZombie(zombie);
+void Projectile::saveSimPosition() {
+    _prevSimPosition = this->getPosition();
+    _hasPrevSimPosition = true;
+}
 
-            // ǵ˺ӵֻһĿ
-            if (_damageType == DamageType::SINGLE_TARGET) {
-                hitTarget();
-                break;
-            }
-        }
+void Projectile::restoreSimPosition() {
+    if (_isInterpolated) {
+        this->setPosition(_simPosition);
+        _isInterpolated = false;
     }
+}
 
-    // ǷΧ˺һĿֱʧʱ
-    if (hitSomething && _damageType == DamageType::AREA_OF_EFFECT) {
-        // Χ˺кԼУѡ
-        // ֱ
-        // destroy();
+void Projectile::applyRenderInterpolation(float alpha) {
+    // 本帧刚发射的子弹还没有上一步的位置，直接显示逻辑位置
+    if (!_hasPrevSimPosition) {
+        return;
     }
+
+    _simPosition = this->getPosition();
+    this->setPosition(_prevSimPosition.lerp(_simPosition, alpha));
+    _isInterpolated = true;
 }
 
 void Projectile::applyDamageToZombie(Zombie* zombie) {
     if (!zombie || !zombie->isAlive()) return;
 
     bool dead = zombie->getHealth() - _damage <= 0;
-    // ˺
+    // 基础伤害
     zombie->takeDamage(_damage);
 
     if (dead)
         return;
-    // ӵЧ
+    // 根据子弹类型添加特效
     switch (_type) {
     case ProjectileType::SNOW_PEA:
-        zombie->freeze(2.5f);  // 2.5
+        zombie->freeze(2.5f);  // 冰冻2.5秒
         break;
     case ProjectileType::FIRE_PEA:
-        // ˺Ч
-        zombie->setColor(Color3B::RED);
-        // ӻЧ
+        // 火焰持续伤害效果（燃烧着色，重复命中时刷新时长）
+        zombie->getTint().start(TintOverlay::BURNING, 3.0f);
         break;
     default:
         break;
     }
 }
 
+void Projectile::resetForReuse()
+{
+    this->stopAllActions();
+    this->unscheduleAllCallbacks();
+    stopCurrentAnimation();
+
+    _state = ProjectileState::FLYING;
+    _lifeTime = 0.0f;
+    _direction = Vec2::ZERO;
+    _velocity = Vec2::ZERO;
+    _row = -1;
+    _sweepFromX = 0.0f;
+    _hasPrevSimPosition = false;
+    _isInterpolated = false;
+
+    _damageType = DamageType::SINGLE_TARGET;
+    _splashRadius = 0.0f;
+    _damageFalloff = 1.0f;
+
+    this->setRotation(0.0f);
+    this->setScale(1.0f);
+    this->setColor(Color3B::WHITE);
+    this->setOpacity(255);
+    this->setVisible(false);
+}
+
 void Projectile::setLaunchParams(const cocos2d::Vec2& startPos, const cocos2d::Vec2& direction)
 {
     this->setPosition(startPos);
+    _sweepFromX = startPos.x;
     _direction = direction.getNormalized();
     _velocity = _direction * _speed;
 
-    // ת
+    // 设置旋转
     float angle = CC_RADIANS_TO_DEGREES(_direction.getAngle());
     this->setRotation(-angle);
 
-    // ȷӵɼ
+    // 确保子弹可见
     this->setVisible(true);
     this->setOpacity(255);
 
-    // ŷж - ʹøɿķ
-    if (!_flyAnimationName.empty())
+    // 播放飞行动画 - 使用更可靠的方法
+    if (_flyAnimationId != INVALID_ASSET_ID)
     {
-        // ԶַŶ
         bool animationPlayed = false;
-        
-        //1ֱʹResourceLoader
+
+        //方法1：直接使用ResourceLoader（循环帧动画交给SpriteAnimator，复用时不分配动作）
         if (_resourceLoader)
         {
-            auto animation = _resourceLoader->getCachedAnimation(_flyAnimationName);
+            auto animation = _resourceLoader->getCachedAnimation(_flyAnimationId);
             if (animation)
             {
-                auto animate = Animate::create(animation);
-                if (animate)
-                {
-                    _currentAnimate = animate;
-                    auto repeat = RepeatForever::create(animate);
-                    this->runAction(repeat);
-                    animationPlayed = true;
-                    log("Projectile: Animation played via ResourceLoader");
-                }
+                SpriteAnimator::getInstance()->play(this, animation, true);
+                animationPlayed = true;
+                PVZ_LOGT(LogCategory::PROJECTILE, "Projectile: Animation played via ResourceLoader");
             }
         }
 
-        // 2зʧܣñ
+        // 方法2：如果所有方法都失败，设置备用外观
         if (!animationPlayed)
         {
-            log("WARNING: Failed to play animation, using fallback appearance");
+            PVZ_LOGE(LogCategory::PROJECTILE, "Failed to play animation, using fallback appearance");
 
-            // һ򵥵㶹״Ϊ
+            // 设置一个简单的豌豆形状作为后备
             this->setColor(Color3B(0, 200, 0));
             this->setTextureRect(Rect(0, 0, 15, 8));
             this->setOpacity(200);
 
-            // Ӽ򵥵
+            // 添加简单的脉动动画
             auto pulseAction = RepeatForever::create(
                 Sequence::create(
                     ScaleTo::create(0.3f, 1.2f, 1.0f),
@@ -230,7 +277,7 @@ void Projectile::setLaunchParams(const cocos2d::Vec2& startPos, const cocos2d::V
     }
     else
     {
-        // ûжƣֱñ
+        // 如果没有动画名称，直接设置备用外观
         this->setColor(Color3B(0, 200, 0));
         this->setTextureRect(Rect(0, 0, 15, 8));
         this->setOpacity(200);
@@ -250,14 +297,14 @@ void Projectile::applySplashDamage(const Vec2& center) {
         float distance = center.distance(zombiePos);
 
         if (distance <= _splashRadius) {
-            // ݾ˺˥
+            // 根据距离计算伤害衰减
             float falloff = 1.0f - (distance / _splashRadius) * _damageFalloff;
             int splashDamage = _damage * falloff;
 
             if (splashDamage > 0) {
                 zombie->takeDamage(splashDamage);
 
-                // ǱӵЧ
+                // 如果是冰冻或火焰子弹，添加特效
                 if (_type == ProjectileType::SNOW_PEA) {
                     zombie->freeze(2.5f * falloff);
                 }
@@ -268,11 +315,11 @@ void Projectile::applySplashDamage(const Vec2& center) {
 
 void Projectile::fly(float delta)
 {
-    // λ
+    // 更新位置
     Vec2 newPos = this->getPosition() + _velocity * delta;
     this->setPosition(newPos);
 
-    // ǷɳĻ
+    // 检查是否飞出屏幕
     Size visibleSize = Director::getInstance()->getVisibleSize();
     float margin = 100.0f;
 
@@ -296,13 +343,16 @@ void Projectile::hitTarget()
 
     this->fly(50.0f / _velocity.x);
 
-    // ֹͣж
+    // 停止飞行动画
     stopCurrentAnimation();
 
-    // Żж
-    if (!_hitAnimationName.empty())
+    // 击中粒子
+    addHitEffect();
+
+    // 播放击中动画
+    if (_hitAnimationId != INVALID_ASSET_ID)
     {
-        playAnimation(_hitAnimationName, false, [this]() {
+        playAnimation(_hitAnimationId, false, [this]() {
             destroy();
             });
     }
@@ -322,12 +372,18 @@ void Projectile::destroy()
 
     _state = ProjectileState::DEAD;
 
-    // ֹͣжͶ
+    // 停止所有动画和动作
     stopCurrentAnimation();
     this->stopAllActions();
-    this->unscheduleUpdate();
 
-    // ȫشӸڵƳ
+    // 池中的子弹留在场景层上，由GameManager清理阶段还回对象池
+    if (_isPooled)
+    {
+        onDestroy();
+        return;
+    }
+
+    // 安全地从父节点移除
     this->scheduleOnce([this](float dt) {
         if (this->getParent())
         {
@@ -345,57 +401,31 @@ bool Projectile::checkCollision(cocos2d::Rect targetRect)
         return false;
     }
 
-    // 򵥾ײ
+    // 简单矩形碰撞检测
     Rect projectileRect = this->getBoundingBox();
     return projectileRect.intersectsRect(targetRect);
 }
 
-void Projectile::playAnimation(const std::string& animationName, bool loop,
+void Projectile::playAnimation(AssetId animationId, bool loop,
     const std::function<void()>& callback)
 {
 
-    // ֹͣǰ
+    // 停止当前动画
     stopCurrentAnimation();
 
-    // ʹResourceLoaderȡ
+    // 使用ResourceLoader获取动画
     if (_resourceLoader)
     {
-        // Զַʽȡ
-        Animation* animation = nullptr;
-
-        // 1. ӻȡ
-        animation = _resourceLoader->getCachedAnimation(animationName);
-
-        // 2. ͨ÷ȡ
-        if (!animation)
-        {
-            animation = _resourceLoader->getAnimation(animationName);
-        }
+        Animation* animation = _resourceLoader->getCachedAnimation(animationId);
 
         if (animation)
         {
-            _currentAnimate = Animate::create(animation);
-            if (_currentAnimate)
-            {
-                // лصж
-                if (callback)
-                {
-                    auto sequence = Sequence::create(_currentAnimate, CallFunc::create(callback), nullptr);
-                    this->runAction(sequence);
-                }
-                else if (loop)
-                {
-                    auto repeat = RepeatForever::create(_currentAnimate);
-                    this->runAction(repeat);
-                }
-                else
-                {
-                    this->runAction(_currentAnimate);
-                }
+            // 有回调函数时只播一次，播完后回调由SpriteAnimator延迟派发
+            SpriteAnimator::getInstance()->play(this, animation, loop && !callback, callback);
 
-                log("Projectile: Animation '%s' played successfully", animationName.c_str());
-                return;
-            }
+            PVZ_LOGT(LogCategory::PROJECTILE, "Projectile: Animation '%s' played successfully",
+                _resourceLoader->getAssetName(animationId));
+            return;
         }
     }
 
@@ -403,29 +433,46 @@ void Projectile::playAnimation(const std::string& animationName, bool loop,
 
 void Projectile::stopCurrentAnimation()
 {
-    if (_currentAnimate)
-    {
-        this->stopAction(_currentAnimate);
-        _currentAnimate = nullptr;
-    }
+    SpriteAnimator::getInstance()->stop(this);
 }
 
 void Projectile::addTrailEffect()
 {
-    // ʵ֣Ա
+    // 空实现，保留以备后用
 }
 
 void Projectile::addHitEffect()
 {
-    // ʵ֣Ա
+    if (!_hasHitEffect)
+    {
+        return;
+    }
+
+    // 从粒子特效池取（子弹与特效层都在原点、不缩放，坐标可以直接用）
+    ParticleEffect effect = ParticleEffect::COUNT;
+    switch (_type)
+    {
+    case ProjectileType::PEA:
+        effect = ParticleEffect::PEA_HIT;
+        break;
+    case ProjectileType::SNOW_PEA:
+        effect = ParticleEffect::SNOW_PEA_HIT;
+        break;
+    case ProjectileType::FIRE_PEA:
+        effect = ParticleEffect::FIRE_PEA_HIT;
+        break;
+    default:
+        break;
+    }
+    ParticleEffectPool::getInstance()->play(effect, this->getPosition());
 }
 
 void Projectile::explode()
 {
-    // ʵ֣Ա
+    // 空实现，保留以备后用
 }
 
 void Projectile::setupAnimations()
 {
-    // ʵ֣Ѿ initProjectile ú
+    // 空实现，动画已经在 initProjectile 中设置好了
 }
\ No newline at end of file
@@ -4,141 +4,158 @@
 
 #include "cocos2d.h"
 #include <string>
+#include "Entities/EntityTypes.h"
+#include "Resources/AssetId.h"
 #include "Entities/Zombie/Zombie.h"
 
-// ӵö
-enum class ProjectileType {
-    PEA,            // 㶹ӵ
-    SNOW_PEA,       // 㶹ӵ
-    FIRE_PEA,       // 㶹ӵ
-    CABBAGE,        // Ĳӵ
-    MELON,          // ӵ
-    SPIKEWEED       // ӵ
-};
-
-// ӵ״̬
+// 子弹状态
 enum class ProjectileState {
-    FLYING,         // 
-    HIT,            // Ŀ
-    EXPLODING,      // ը
-    DEAD            // 
+    FLYING,         // 飞行中
+    HIT,            // 击中目标
+    EXPLODING,      // 爆炸中
+    DEAD            // 已销毁
 };
 
-// ˺ö
+// 伤害类型枚举
 enum class DamageType {
-    SINGLE_TARGET,  // ˺
-    AREA_OF_EFFECT  // Χ˺
+    SINGLE_TARGET,  // 单体伤害
+    AREA_OF_EFFECT  // 范围伤害
 };
 
 class Projectile : public cocos2d::Sprite {
 public:
     CREATE_FUNC(Projectile);
 
+    virtual ~Projectile();
     virtual bool init() override;
     virtual void update(float delta) override;
 
-    // ʼӵʱָ˺
+    // 初始化子弹时指定伤害类型
     virtual bool initProjectile(ProjectileType type, int damage, float speed,
         DamageType damageType = DamageType::SINGLE_TARGET);
 
-    // ӵ
+    // 子弹属性
     ProjectileType getType() const { return _type; }
     int getDamage() const { return _damage; }
     float getSpeed() const { return _speed; }
     ProjectileState getState() const { return _state; }
     bool isAlive() const { return _state != ProjectileState::DEAD; }
 
-    // ÷
+    // 设置发射参数
     void setLaunchParams(const cocos2d::Vec2& startPos, const cocos2d::Vec2& direction);
+
+    // 所在行（碰撞检测只在同一行内进行）
+    void setRow(int row) { _row = row; }
+    int getRow() const { return _row; }
+
+    // 扫掠碰撞：上次碰撞检测后的起点x，由GameManager每帧检测后重置
+    float getSweepFromX() const { return _sweepFromX; }
+    void resetSweep() { _sweepFromX = this->getPositionX(); }
+
+    // 碰撞处理（由GameManager的行分桶检测调用），返回子弹是否已被消耗
+    bool handleZombieHit(Zombie* zombie, float hitX);
+
+    // 渲染插值：逻辑步之间显示位置按alpha混合上一步与当前步的逻辑位置
+    void saveSimPosition();                  // 每个逻辑步开始前记录位置
+    void restoreSimPosition();               // 帧开始时把显示位置还原成逻辑位置
+    void applyRenderInterpolation(float alpha);
+
+    // 对象池：池中的子弹销毁时只隐藏，由GameManager在清理阶段还回ProjectilePool
+    void setPooled(bool pooled) { _isPooled = pooled; }
+    bool isPooled() const { return _isPooled; }
+    void resetForReuse();                    // 停止动作并恢复初始状态（隐藏）
     
-    // ÷Χ˺
+    // 设置范围伤害参数
     void setSplashDamage(float radius, float damageFalloff = 1.0f) {
         _splashRadius = radius;
         _damageFalloff = damageFalloff;
         _damageType = DamageType::AREA_OF_EFFECT;
     }
 
-    // Ӧ÷Χ˺
+    // 应用范围伤害
     void applySplashDamage(const cocos2d::Vec2& center);
 
-    // ӵΪ
+    // 子弹行为
     virtual void fly(float delta);
     virtual void hitTarget();
     virtual void explode();
     virtual void destroy();
 
-    // ײ
+    // 碰撞检测
     virtual bool checkCollision(cocos2d::Rect targetRect);
 
-    // Ч
-    void addTrailEffect(); // βЧ
-    void addHitEffect();   // ӻЧ
+    // 特效
+    void addTrailEffect(); // 添加拖尾效果
+    void addHitEffect();   // 添加击中效果
 
 protected:
-    // дĺ
+    // 子类可重写的函数
     virtual void onFlying(float delta) {}
     virtual void onHit() {}
     virtual void onExplode() {}
     virtual void onDestroy() {}
 
-    // 
+    // 动画相关
     virtual void setupAnimations();
     bool isReadyForRemoval() const {
         return _state == ProjectileState::DEAD || !this->getParent();
     }
 
 protected:
-    ProjectileType _type;          // ӵ
-    ProjectileState _state;        // ӵ״̬
-
-    // 
-    int _damage;                   // ˺ֵ
-    float _speed;                  // ٶ
-    float _lifeTime;               // ʱ
-    float _maxLifeTime;            // ʱ
-
-    // 
-    cocos2d::Vec2 _direction;      // з
-    cocos2d::Vec2 _velocity;       // ٶ
-    float _rotationSpeed;          // תٶ
+    ProjectileType _type;          // 子弹类型
+    ProjectileState _state;        // 子弹状态
+
+    // 基础属性
+    int _damage;                   // 伤害值
+    float _speed;                  // 飞行速度
+    float _lifeTime;               // 生存时间
+    float _maxLifeTime;            // 最大生存时间
+
+    // 物理属性
+    cocos2d::Vec2 _direction;      // 飞行方向
+    cocos2d::Vec2 _velocity;       // 速度向量
+    float _rotationSpeed;          // 旋转速度
+    int _row;                      // 所在行
+    float _sweepFromX;             // 扫掠起点
+    cocos2d::Vec2 _prevSimPosition;    // 渲染插值
+    cocos2d::Vec2 _simPosition;
+    bool _hasPrevSimPosition;
+    bool _isInterpolated;
+    bool _isPooled;                // 是否由对象池管理
 
     DamageType _damageType;
-    float _splashRadius;     // 뾶
-    float _damageFalloff;    // ˺˥ϵ
+    float _splashRadius;     // 溅射半径
+    float _damageFalloff;    // 伤害衰减系数
 
-    // Ч
-    bool _hasTrailEffect;          // ǷβЧ
-    bool _hasHitEffect;            // ǷлЧ
-    float _effectTimer;            // Чʱ
+    // 特效属性
+    bool _hasTrailEffect;          // 是否有拖尾效果
+    bool _hasHitEffect;            // 是否有击中效果
+    float _effectTimer;            // 特效计时器
 
-    // 
-    std::string _flyAnimationName;    // ж
-    std::string _hitAnimationName;    // ж
-    std::string _explodeAnimationName; // ը
+    // 动画名称
+    AssetId _flyAnimationId;        // 飞行动画
+    AssetId _hitAnimationId;        // 击中动画
+    AssetId _explodeAnimationId;    // 爆炸动画
 
-    // Դ
+    // 资源引用
     class ResourceLoader* _resourceLoader;
     class AnimationHelper* _animationHelper;
 
-    // 
-    cocos2d::Animate* _currentAnimate;
-
 private:
-    void checkZombieCollisions();
     void applyDamageToZombie(Zombie* zombie);
 
 public:
-    // Դ
+    // 设置资源加载器
     void setResourceLoader(class ResourceLoader* loader);
 
-    // ö
+    // 设置动画辅助器
     void setAnimationHelper(class AnimationHelper* helper);
 
-    // Ŷ
-    void playAnimation(const std::string& animationName, bool loop = false,
+    // 播放动画（动画名的AssetId）
+    void playAnimation(AssetId animationId, bool loop = false,
         const std::function<void()>& callback = nullptr);
 
-    // ֹͣǰ
+    // 停止当前动画（帧动画由SpriteAnimator统一推进）
     void stopCurrentAnimation();
 };
 
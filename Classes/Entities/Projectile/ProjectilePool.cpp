@@ -0,0 +1,147 @@
+#include "ProjectilePool.h"
+#include <algorithm>
+#include "./Game/Logger.h"
+
+USING_NS_CC;
+
+ProjectilePool::ProjectilePool(ProjectileType type)
+    : _type(type)
+    , _layer(nullptr)
+    , _zOrder(0)
+{
+    resetStats();
+}
+
+ProjectilePool::~ProjectilePool()
+{
+    clear();
+}
+
+void ProjectilePool::prewarm(Node* layer, int zOrder, int count)
+{
+    if (_layer != layer)
+    {
+        clear();
+    }
+
+    _layer = layer;
+    _zOrder = zOrder;
+    if (!_layer)
+    {
+        return;
+    }
+
+    _nodes.reserve(count);
+    _free.reserve(count);
+    while ((int)_nodes.size() < count)
+    {
+        Projectile* projectile = createNode();
+        if (!projectile)
+        {
+            break;
+        }
+        _free.push_back(projectile);
+    }
+
+    PVZ_LOGI(LogCategory::PROJECTILE, "ProjectilePool: Type %d prewarmed %d nodes", (int)_type, (int)_nodes.size());
+}
+
+Projectile* ProjectilePool::acquire()
+{
+    if (!_layer)
+    {
+        return nullptr;
+    }
+
+    Projectile* projectile = nullptr;
+    if (!_free.empty())
+    {
+        projectile = _free.back();
+        _free.pop_back();
+    }
+    else
+    {
+        // 池空：临时扩容，记录一次miss
+        projectile = createNode();
+        if (!projectile)
+        {
+            return nullptr;
+        }
+        _stats.misses++;
+    }
+
+    projectile->resetForReuse();
+
+    _stats.acquires++;
+    _stats.inUse++;
+    _stats.highWater = std::max(_stats.highWater, _stats.inUse);
+    return projectile;
+}
+
+void ProjectilePool::release(Projectile* projectile)
+{
+    if (!projectile)
+    {
+        return;
+    }
+
+    // 只接收本池创建的节点，重复还回的直接忽略（否则同一节点会被acquire两次、inUse也会算错）
+    if (std::find(_nodes.begin(), _nodes.end(), projectile) == _nodes.end())
+    {
+        PVZ_LOGW(LogCategory::PROJECTILE, "ProjectilePool: Type %d rejected foreign projectile", (int)_type);
+        return;
+    }
+    if (std::find(_free.begin(), _free.end(), projectile) != _free.end())
+    {
+        return;
+    }
+
+    projectile->resetForReuse();
+    _free.push_back(projectile);
+    _stats.inUse--;
+}
+
+void ProjectilePool::clear()
+{
+    for (auto projectile : _nodes)
+    {
+        if (projectile->getParent())
+        {
+            projectile->removeFromParent();
+        }
+        projectile->release();
+    }
+    _nodes.clear();
+    _free.clear();
+    _layer = nullptr;
+
+    _stats.capacity = 0;
+    _stats.inUse = 0;
+}
+
+void ProjectilePool::resetStats()
+{
+    _stats.capacity = (int)_nodes.size();
+    _stats.inUse = (int)(_nodes.size() - _free.size());
+    _stats.highWater = _stats.inUse;
+    _stats.misses = 0;
+    _stats.acquires = 0;
+}
+
+Projectile* ProjectilePool::createNode()
+{
+    auto projectile = Projectile::create();
+    if (!projectile)
+    {
+        return nullptr;
+    }
+
+    projectile->retain();
+    projectile->setPooled(true);
+    projectile->resetForReuse();
+    _layer->addChild(projectile, _zOrder);
+
+    _nodes.push_back(projectile);
+    _stats.capacity = (int)_nodes.size();
+    return projectile;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#ifndef __PROJECTILE_POOL_H__
+#define __PROJECTILE_POOL_H__
+
+#include "cocos2d.h"
+#include <vector>
+#include "Entities/Projectile/Projectile.h"
+
+// 子弹对象池（每种ProjectileType一个，由GameManager持有）
+// 关卡开始时预热一批节点，隐藏地挂在场景层上；发射时取出重置状态并显示，
+// 销毁时只隐藏并还回池中，不再每发子弹create/addChild/removeFromParent。
+class ProjectilePool
+{
+public:
+    // 池统计（用于调整预热数量）
+    struct Stats
+    {
+        int capacity;       // 池中节点总数
+        int inUse;          // 当前在飞行中的数量
+        int highWater;      // inUse的历史最大值
+        int misses;         // 池空时临时创建节点的次数
+        int acquires;       // 总取出次数
+    };
+
+    explicit ProjectilePool(ProjectileType type);
+    ~ProjectilePool();
+
+    ProjectileType getType() const { return _type; }
+    cocos2d::Node* getLayer() const { return _layer; }
+
+    // 绑定场景层并预热count个节点（已绑定其它层时先清空）
+    void prewarm(cocos2d::Node* layer, int zOrder, int count);
+
+    // 取出一个已重置的子弹，池未绑定场景层时返回nullptr
+    Projectile* acquire();
+
+    // 还回池中（隐藏，留在场景层上等待复用），不属于本池或已在空闲列表中的节点忽略
+    void release(Projectile* projectile);
+
+    // 释放所有节点并解除与场景层的绑定
+    void clear();
+
+    const Stats& getStats() const { return _stats; }
+    void resetStats();
+
+private:
+    ProjectilePool(const ProjectilePool&) = delete;
+    ProjectilePool& operator=(const ProjectilePool&) = delete;
+
+    Projectile* createNode();
+
+    ProjectileType _type;
+    cocos2d::Node* _layer;
+    int _zOrder;
+
+    std::vector<Projectile*> _nodes;    // 池中所有节点（持有引用）
+    std::vector<Projectile*> _free;     // 空闲节点
+
+    Stats _stats;
+};
+
+#endif // __PROJECTILE_POOL_H__
@@ -0,0 +1,185 @@
+#include "TintCompositor.h"
+#include <algorithm>
+#include <cmath>
+
+USING_NS_CC;
+
+namespace {
+    // 每种叠加层的默认颜色、完全生效时的透明度、脉冲频率（0为不闪）、是否随剩余时间淡出
+    struct OverlayStyle
+    {
+        Color3B color;
+        GLubyte opacity;
+        float pulseHz;
+        bool fadeOut;
+    };
+
+    const OverlayStyle OVERLAY_STYLES[(int)TintOverlay::COUNT] = {
+        { Color3B(100, 100, 255), 180, 0.0f, false },   // FROZEN
+        { Color3B(255, 90, 40), 255, 2.0f, false },     // BURNING
+        { Color3B::RED, 255, 10.0f, false },            // FUSE
+        { Color3B::RED, 255, 0.0f, true },              // HIT_FLASH
+    };
+
+    const float TWO_PI = 6.28318530718f;
+
+    GLubyte lerpByte(GLubyte from, GLubyte to, float t)
+    {
+        return (GLubyte)(from + (to - from) * t + 0.5f);
+    }
+}
+
+TintCompositor::TintCompositor()
+    : _baseColor(Color3B::WHITE)
+    , _activeCount(0)
+    , _dirty(false)     // 精灵默认就是白色，第一次有变化时再写
+{
+    for (auto& layer : _layers)
+    {
+        layer.active = false;
+        layer.duration = 0.0f;
+        layer.remaining = 0.0f;
+        layer.time = 0.0f;
+        layer.color = Color3B::WHITE;
+    }
+}
+
+void TintCompositor::setBaseColor(const Color3B& color)
+{
+    if (_baseColor != color)
+    {
+        _baseColor = color;
+        _dirty = true;
+    }
+}
+
+void TintCompositor::start(TintOverlay overlay, float duration)
+{
+    start(overlay, duration, OVERLAY_STYLES[(int)overlay].color);
+}
+
+void TintCompositor::start(TintOverlay overlay, float duration, const Color3B& color)
+{
+    Layer& layer = _layers[(int)overlay];
+    if (!layer.active)
+    {
+        layer.active = true;
+        layer.time = 0.0f;
+        _activeCount++;
+    }
+    layer.duration = duration;
+    layer.remaining = duration;
+    layer.color = color;
+    _dirty = true;
+}
+
+void TintCompositor::stop(TintOverlay overlay)
+{
+    Layer& layer = _layers[(int)overlay];
+    if (layer.active)
+    {
+        layer.active = false;
+        _activeCount--;
+        _dirty = true;
+    }
+}
+
+bool TintCompositor::isActive(TintOverlay overlay) const
+{
+    return _layers[(int)overlay].active;
+}
+
+void TintCompositor::reset()
+{
+    for (int i = 0; i < (int)TintOverlay::COUNT; i++)
+    {
+        _layers[i].active = false;
+    }
+    _activeCount = 0;
+    _baseColor = Color3B::WHITE;
+    _dirty = true;
+}
+
+void TintCompositor::advance(float delta)
+{
+    if (_activeCount == 0)
+    {
+        return;
+    }
+
+    for (int i = 0; i < (int)TintOverlay::COUNT; i++)
+    {
+        Layer& layer = _layers[i];
+        if (!layer.active)
+        {
+            continue;
+        }
+
+        layer.time += delta;
+        if (layer.duration > 0.0f)
+        {
+            layer.remaining -= delta;
+            if (layer.remaining <= 0.0f)
+            {
+                layer.active = false;
+                _activeCount--;
+            }
+        }
+    }
+
+    // 有叠加层（或刚结束一个）时结果随时间变化
+    _dirty = true;
+}
+
+void TintCompositor::resolve(Color3B* color, GLubyte* opacity) const
+{
+    *color = _baseColor;
+    *opacity = 255;
+
+    for (int i = 0; i < (int)TintOverlay::COUNT; i++)
+    {
+        const Layer& layer = _layers[i];
+        if (!layer.active)
+        {
+            continue;
+        }
+
+        const OverlayStyle& style = OVERLAY_STYLES[i];
+        float strength = 1.0f;
+        if (style.fadeOut && layer.duration > 0.0f)
+        {
+            strength = layer.remaining / layer.duration;
+        }
+        else if (style.pulseHz > 0.0f)
+        {
+            strength = 0.5f - 0.5f * cosf(TWO_PI * style.pulseHz * layer.time);
+        }
+
+        color->r = lerpByte(color->r, layer.color.r, strength);
+        color->g = lerpByte(color->g, layer.color.g, strength);
+        color->b = lerpByte(color->b, layer.color.b, strength);
+        *opacity = std::min(*opacity, lerpByte(255, style.opacity, strength));
+    }
+}
+
+void TintCompositor::apply(Sprite* sprite)
+{
+    // 没有变化时不碰精灵（备用贴图自己跑的颜色动画也不会被覆盖）
+    if (!_dirty || !sprite)
+    {
+        return;
+    }
+    _dirty = false;
+
+    Color3B color;
+    GLubyte opacity;
+    resolve(&color, &opacity);
+    if (sprite->getColor() != color)
+    {
+        sprite->setColor(color);
+    }
+    if (sprite->getOpacity() != opacity)
+    {
+        sprite->setOpacity(opacity);
+    }
+}
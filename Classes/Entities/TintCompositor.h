@@ -0,0 +1,63 @@
+#pragma once
+#ifndef __TINT_COMPOSITOR_H__
+#define __TINT_COMPOSITOR_H__
+
+#include "cocos2d.h"
+
+// 着色叠加层，按枚举顺序从下往上叠加（受击闪红压在冰冻、燃烧之上）
+enum class TintOverlay
+{
+    FROZEN,         // 冰冻：蓝色、半透明
+    BURNING,        // 燃烧：橙红色慢脉冲
+    FUSE,           // 即将爆炸：红色快闪
+    HIT_FLASH,      // 受击：闪一下后淡出
+    COUNT
+};
+
+// TintCompositor - 实体的着色合成器
+// 实体只登记底色和几个定时叠加层，不再各自setColor或跑TintTo动作：
+// 受击不用每次分配Sequence+TintTo，也不会在淡出途中取到半红的颜色当作"原色"导致越变越红。
+// GameScene每帧统一推进计时并把合成结果写回精灵，结果没变时不写。
+class TintCompositor
+{
+public:
+    TintCompositor();
+
+    // 实体自身的颜色（备用贴图的配色、护甲破坏后的颜色等），叠加层都在它之上
+    void setBaseColor(const cocos2d::Color3B& color);
+    const cocos2d::Color3B& getBaseColor() const { return _baseColor; }
+
+    // 开启叠加层，duration <= 0 表示一直保持到stop；重复开启时刷新计时
+    void start(TintOverlay overlay, float duration = 0.0f);
+    // 使用指定颜色（如路障受击闪绿、铁桶受击闪灰）
+    void start(TintOverlay overlay, float duration, const cocos2d::Color3B& color);
+    void stop(TintOverlay overlay);
+    bool isActive(TintOverlay overlay) const;
+
+    // 清除所有叠加层并恢复白色底色（对象池复用时调用）
+    void reset();
+
+    // 推进计时（逻辑时间，倍速时随之加快）
+    void advance(float delta);
+    // 把合成结果写到精灵上，只在结果变化时调用setColor/setOpacity
+    void apply(cocos2d::Sprite* sprite);
+
+private:
+    struct Layer
+    {
+        bool active;
+        float duration;
+        float remaining;
+        float time;
+        cocos2d::Color3B color;
+    };
+
+    void resolve(cocos2d::Color3B* color, GLubyte* opacity) const;
+
+    cocos2d::Color3B _baseColor;
+    Layer _layers[(int)TintOverlay::COUNT];
+    int _activeCount;
+    bool _dirty;
+};
+
+#endif // __TINT_COMPOSITOR_H__
@@ -6,6 +6,8 @@
 #include <cocos2d.h>
 #include "Game/WaveManager.h"
 #include "Game/GridSystem.h"
+#include "./Game/Logger.h"
+#include "./Game/SpriteAnimator.h"
 USING_NS_CC;
 
 Zombie::Zombie()
@@ -25,12 +27,19 @@ Zombie::Zombie()
     , _deathAnimation(nullptr)
     , _originalSpeed(20.0f)    
     , _isFrozen(false)         
+    , _hasPrevSimPosition(false)
+    , _isInterpolated(false)
+    , _isPooled(false)
 {
 }
 
 Zombie::~Zombie()
 {
     _targetPlant = nullptr;
+    SpriteAnimator::getInstance()->stop(this);
+    CC_SAFE_RELEASE_NULL(_walkAnimation);
+    CC_SAFE_RELEASE_NULL(_attackAnimation);
+    CC_SAFE_RELEASE_NULL(_deathAnimation);
 }
 
 bool Zombie::init()
@@ -47,7 +56,7 @@ bool Zombie::initWithType(ZombieType type)
 {
     _type = type;
 
-    // 
+    // 根据类型设置属性
     switch (type)
     {
         case ZombieType::NORMAL:
@@ -72,36 +81,24 @@ bool Zombie::initWithType(ZombieType type)
             break;
     }
 
-    // óʼ״̬
+    // 设置初始状态
     _state = ZombieState::ALIVE;
     _attackTimer = 0;
     _freezeTimer = 0;
     _targetPlant = nullptr;
 
-    // _Oߴ磨Ҫ
+    // 確保設置物理尺寸（重要！）
     this->setContentSize(Size(60, 100));
-    this->setAnchorPoint(Vec2(0.3f, 0.3f)); // {^cʹ_R
+    this->setAnchorPoint(Vec2(0.3f, 0.3f)); // 調整錨點使其腳部對齊地面
 
-    // ضԴ
-    ResourceLoader* resourceLoader = ResourceLoader::getInstance();
-    if (resourceLoader)
-    {
-        _walkAnimation = resourceLoader->getCachedAnimation(getWalkAnimationName());
-        _attackAnimation = resourceLoader->getCachedAnimation(getAttackAnimationName());
-        _deathAnimation = resourceLoader->getCachedAnimation(getDeathAnimationName());
+    // 加载动画资源
+    refreshAnimations();
+    playWalkAnimation();
 
-        if (_walkAnimation)
-        {
-            this->runAction(RepeatForever::create(Animate::create(_walkAnimation)));
-        }
-    }
-
-    // ʼƶ
+    // 开始移动
     startMoving();
 
-    this->scheduleUpdate();
-
-    log("Zombie: Initialized type %d at row %d", (int)type, _row);
+    PVZ_LOGD(LogCategory::ZOMBIE, "Zombie: Initialized type %d at row %d", (int)type, _row);
     return true;
 }
 
@@ -118,58 +115,113 @@ Zombie* Zombie::create(ZombieType type)
 }
 
 void Zombie::update(float delta)
+{
+    // 单独更新时依次执行各阶段；场景中由GameScene的流水线分阶段调用
+    updateMove(delta);
+    updateTarget();
+    updateAttack(delta);
+}
+
+void Zombie::updateMove(float delta)
 {
     if (_state == ZombieState::DEAD)
     {
         return;
     }
 
-    // ±״̬
+    // 更新冰冻状态
     if (_freezeTimer > 0)
     {
         _freezeTimer -= delta;
         if (_freezeTimer <= 0)
         {
-            // 
+            // 解除冰冻
             unFreeze();
-            this->setColor(Color3B::WHITE);
         }
     }
 
-    // ײ
-    checkCollisions();
+    // 攻击中的僵尸不移动
+    updateMovement(delta);
+}
+
+void Zombie::updateTarget()
+{
+    if (_state == ZombieState::DEAD)
+    {
+        return;
+    }
 
     _targetPlant = this->findPlantInFront();
-    // Ŀֲ򹥻
     if (_targetPlant && _targetPlant->isAlive())
     {
-        _attackTimer += delta;
-        if (_attackTimer >= _attackInterval)
-        {
-            attack(_targetPlant);
-            _attackTimer = 0;
-        }
-
-        // Ź
+        // 播放攻击动画
         if (_state != ZombieState::ATTACKING)
         {
             _state = ZombieState::ATTACKING;
             playAttackAnimation();
         }
     }
-    else
+    else if (_state == ZombieState::ATTACKING)
     {
-        // ûĿ꣬ƶ
-        if (_state == ZombieState::ATTACKING)
+        // 没有目标，恢复行走
+        _state = ZombieState::ALIVE;
+        playWalkAnimation();
+    }
+}
+
+void Zombie::updateAttack(float delta)
+{
+    if (_state != ZombieState::ATTACKING)
+    {
+        return;
+    }
+
+    // 如果有目标植物，则攻击
+    if (_targetPlant && _targetPlant->isAlive())
+    {
+        _attackTimer += delta;
+        if (_attackTimer >= _attackInterval)
         {
-            _state = ZombieState::ALIVE;
-            playWalkAnimation();
+            attack(_targetPlant);
+            _attackTimer = 0;
         }
+    }
+}
 
-        updateMovement(delta);
+void Zombie::saveSimPosition()
+{
+    _prevSimPosition = this->getPosition();
+    _hasPrevSimPosition = true;
+}
+
+void Zombie::restoreSimPosition()
+{
+    if (_isInterpolated)
+    {
+        this->setPosition(_simPosition);
+        _isInterpolated = false;
     }
 }
 
+void Zombie::applyRenderInterpolation(float alpha)
+{
+    // 本帧刚生成的僵尸还没有上一步的位置，直接显示逻辑位置
+    if (!_hasPrevSimPosition)
+    {
+        return;
+    }
+
+    _simPosition = this->getPosition();
+    this->setPosition(_prevSimPosition.lerp(_simPosition, alpha));
+    _isInterpolated = true;
+}
+
+void Zombie::updateTint(float delta)
+{
+    _tint.advance(delta);
+    _tint.apply(this);
+}
+
 void Zombie::takeDamage(int damage)
 {
     if (_state == ZombieState::DEAD)
@@ -179,15 +231,10 @@ void Zombie::takeDamage(int damage)
 
     _health -= damage;
 
-    // Ч
-    auto tintAction = Sequence::create(
-        TintTo::create(0.1f, Color3B::RED),
-        TintTo::create(0.1f, this->getColor()),
-        nullptr
-    );
-    this->runAction(tintAction);
+    // 受伤效果
+    _tint.start(TintOverlay::HIT_FLASH, 0.2f);
 
-    log("Zombie: Took %d damage, health: %d/%d", damage, _health, _maxHealth);
+    PVZ_LOGT(LogCategory::ZOMBIE, "Zombie: Took %d damage, health: %d/%d", damage, _health, _maxHealth);
 
     if (_health <= 0)
     {
@@ -200,11 +247,11 @@ void Zombie::attack(Plant* plant)
     if (plant && plant->isAlive())
     {
         plant->takeDamage(_damage);
-        log("Zombie: Attacked plant for %d damage", _damage);
+        PVZ_LOGT(LogCategory::ZOMBIE, "Zombie: Attacked plant for %d damage", _damage);
     }
 }
 
-// Zombie.cpp е die() ޸ģ
+// Zombie.cpp 中的 die() 方法修改：
 void Zombie::die()
 {
     if (_state == ZombieState::DEAD)
@@ -215,41 +262,34 @@ void Zombie::die()
     _state = ZombieState::DEAD;
     stopMoving();
 
-    // ֹͣЄ
+    // 停止所有動作
     this->stopAllActions();
 
-    // ֹͣ
-    this->unscheduleUpdate();
+    // 死亡后不再在行索引里，不会再被统一更新着色：撤掉受击闪红，保留冰冻/燃烧的颜色
+    _tint.stop(TintOverlay::HIT_FLASH);
+    _tint.apply(this);
 
-    // ֪ͨWaveManager
+    // 立即通知WaveManager
     auto waveManager = WaveManager::getInstance();
     if (waveManager)
     {
         waveManager->zombieKilled(this);
     }
 
-    // ӮKƳ
+    // 播放死亡動畫並立即移除
     if (_deathAnimation)
     {
-        auto deathAction = Animate::create(_deathAnimation);
-        auto removeAction = CallFunc::create([this]() {
-            if (this->getParent())
-            {
-                this->removeFromParent();
-            }
+        SpriteAnimator::getInstance()->play(this, _deathAnimation, false, [this]() {
+            leaveScene();
             });
-        this->runAction(Sequence::create(deathAction, removeAction, nullptr));
     }
     else
     {
-        // ]ЄӮƳ
-        if (this->getParent())
-        {
-            this->removeFromParent();
-        }
+        // 沒有動畫，立即移除
+        leaveScene();
     }
 
-    log("Zombie: Died");
+    PVZ_LOGD(LogCategory::ZOMBIE, "Zombie: Died");
 }
 
 void Zombie::freeze(float duration)
@@ -259,20 +299,19 @@ void Zombie::freeze(float duration)
     _freezeTimer = duration;
     _isFrozen = true;
 
-    // ԭʼٶȣѾ
+    // 保存原始速度（如果不是已经被冰冻）
     if (!_isFrozen) {
         _originalSpeed = _speed;
     }
 
-    // üЧٵԭٶȵ75%
-    float slowFactor = 0.75f;  // ΪҪļٱ
+    // 设置减速效果（例如减速到原速度的75%）
+    float slowFactor = 0.75f;  // 调整为需要的减速比例
     _speed = _originalSpeed * slowFactor;
 
-    // ӾЧ
-    this->setColor(Color3B(100, 100, 255)); // ɫЧ
-    this->setOpacity(180); // ΢͸һ
+    // 冰冻视觉效果（蓝色、稍微透明），解冻时撤掉
+    _tint.start(TintOverlay::FROZEN);
 
-    log("Zombie: Frozen for %.1f seconds, speed reduced from %.1f to %.1f",
+    PVZ_LOGD(LogCategory::ZOMBIE, "Zombie: Frozen for %.1f seconds, speed reduced from %.1f to %.1f",
         duration, _originalSpeed, _speed);
 }
 
@@ -280,35 +319,79 @@ void Zombie::unFreeze()
 {
     if (!_isFrozen) return;
 
-    // ָԭʼٶ
+    // 恢复原始速度
     _speed = _originalSpeed;
     _isFrozen = false;
 
-    // ָӾ
-    this->setColor(Color3B::WHITE);
-    this->setOpacity(255);
+    // 恢复视觉外观
+    _tint.stop(TintOverlay::FROZEN);
 
-    log("Zombie: Unfrozen, speed restored to %.1f", _speed);
+    PVZ_LOGD(LogCategory::ZOMBIE, "Zombie: Unfrozen, speed restored to %.1f", _speed);
 }
 
 void Zombie::startMoving()
 {
-    // ʼƶ߼
-    log("Zombie: Started moving");
+    // 开始移动逻辑
+    PVZ_LOGD(LogCategory::ZOMBIE, "Zombie: Started moving");
 }
 
 void Zombie::stopMoving()
 {
-    // ֹͣƶ߼
-    log("Zombie: Stopped moving");
+    // 停止移动逻辑
+    PVZ_LOGD(LogCategory::ZOMBIE, "Zombie: Stopped moving");
+}
+
+void Zombie::setAnimations(Animation* walk, Animation* attack, Animation* death)
+{
+    if (walk != _walkAnimation)
+    {
+        CC_SAFE_RETAIN(walk);
+        CC_SAFE_RELEASE(_walkAnimation);
+        _walkAnimation = walk;
+    }
+    if (attack != _attackAnimation)
+    {
+        CC_SAFE_RETAIN(attack);
+        CC_SAFE_RELEASE(_attackAnimation);
+        _attackAnimation = attack;
+    }
+    if (death != _deathAnimation)
+    {
+        CC_SAFE_RETAIN(death);
+        CC_SAFE_RELEASE(_deathAnimation);
+        _deathAnimation = death;
+    }
+}
+
+void Zombie::refreshAnimations()
+{
+    ResourceLoader* resourceLoader = ResourceLoader::getInstance();
+    if (!resourceLoader)
+    {
+        return;
+    }
+
+    Animation* walk = resourceLoader->getCachedAnimation(getWalkAnimationId());
+    Animation* attack = resourceLoader->getCachedAnimation(getAttackAnimationId());
+    Animation* death = resourceLoader->getCachedAnimation(getDeathAnimationId());
+    setAnimations(walk ? walk : _walkAnimation,
+        attack ? attack : _attackAnimation,
+        death ? death : _deathAnimation);
+}
+
+void Zombie::releaseAnimations()
+{
+    SpriteAnimator::getInstance()->stop(this);
+    setAnimations(nullptr, nullptr, nullptr);
+    // 换成cocos内置的白色纹理，不再引用图集页（空闲时隐藏，不会显示出来）
+    this->setTexture(nullptr);
 }
 
 void Zombie::playWalkAnimation()
 {
     if (_walkAnimation)
     {
-        this->stopAllActions();
-        this->runAction(RepeatForever::create(Animate::create(_walkAnimation)));
+        SpriteAnimator::getInstance()->play(this, _walkAnimation, true);
     }
 }
 
@@ -316,8 +399,7 @@ void Zombie::playAttackAnimation()
 {
     if (_attackAnimation)
     {
-        this->stopAllActions();
-        this->runAction(RepeatForever::create(Animate::create(_attackAnimation)));
+        SpriteAnimator::getInstance()->play(this, _attackAnimation, true);
     }
 }
 
@@ -325,56 +407,52 @@ void Zombie::playDeathAnimation()
 {
     if (_deathAnimation)
     {
-        this->stopAllActions();
-        this->runAction(Sequence::create(
-            Animate::create(_deathAnimation),
-            nullptr
-        ));
+        SpriteAnimator::getInstance()->play(this, _deathAnimation, false);
     }
 }
 
-std::string Zombie::getWalkAnimationName() const
+AssetId Zombie::getWalkAnimationId() const
 {
     switch (_type)
     {
         case ZombieType::NORMAL:
-            return "zombie_normal_walk";
+            return PVZ_ASSET_ID("zombie_normal_walk");
         case ZombieType::CONEHEAD:
-            return "zombie_conehead_walk";
+            return PVZ_ASSET_ID("zombie_conehead_walk");
         case ZombieType::BUCKETHEAD:
-            return "zombie_buckethead_walk";
+            return PVZ_ASSET_ID("zombie_buckethead_walk");
         default:
-            return "zombie_normal_walk";
+            return PVZ_ASSET_ID("zombie_normal_walk");
     }
 }
 
-std::string Zombie::getAttackAnimationName() const
+AssetId Zombie::getAttackAnimationId() const
 {
     switch (_type)
     {
         case ZombieType::NORMAL:
-            return "zombie_normal_attack";
+            return PVZ_ASSET_ID("zombie_normal_attack");
         case ZombieType::CONEHEAD:
-            return "zombie_conehead_attack";
+            return PVZ_ASSET_ID("zombie_conehead_attack");
         case ZombieType::BUCKETHEAD:
-            return "zombie_buckethead_attack";
+            return PVZ_ASSET_ID("zombie_buckethead_attack");
         default:
-            return "zombie_normal_attack";
+            return PVZ_ASSET_ID("zombie_normal_attack");
     }
 }
 
-std::string Zombie::getDeathAnimationName() const
+AssetId Zombie::getDeathAnimationId() const
 {
     switch (_type)
     {
         case ZombieType::NORMAL:
-            return "zombie_normal_death";
+            return PVZ_ASSET_ID("zombie_normal_death");
         case ZombieType::CONEHEAD:
-            return "zombie_conehead_death";
+            return PVZ_ASSET_ID("zombie_conehead_death");
         case ZombieType::BUCKETHEAD:
-            return "zombie_buckethead_death";
+            return PVZ_ASSET_ID("zombie_buckethead_death");
         default:
-            return "zombie_normal_death";
+            return PVZ_ASSET_ID("zombie_normal_death");
     }
 }
 
@@ -385,77 +463,110 @@ void Zombie::updateMovement(float delta)
         return;
     }
 
-    // ʵٶȣǱЧ
+    // 计算实际速度（考虑冰冻效果）
     float actualSpeed = _speed;
     if (_freezeTimer > 0)
     {
         actualSpeed = 0.5*_speed;
     }
 
-    // ƶ
+    // 向左移动
     float moveDistance = -actualSpeed * delta;
     this->setPositionX(this->getPositionX() + moveDistance);
 
-    // Ƿ񵽴յ㣨Ļࣩ
-    auto visibleSize = Director::getInstance()->getVisibleSize();
+    // 位置变化后检查行索引的顺序（越过相邻僵尸时才需要重新排序）
+    auto waveManager = WaveManager::getInstance();
+    if (waveManager)
+    {
+        waveManager->zombieMoved(this);
+    }
+
+    // 检查是否到达终点（屏幕左侧）
     if (this->getPositionX() < -50)
     {
-        log("Zombie: Reached end of screen");
+        PVZ_LOGD(LogCategory::ZOMBIE, "Zombie: Reached end of screen");
 
-        // ֪ͨ WaveManager
-        auto waveManager = WaveManager::getInstance();
+        // 立即通知 WaveManager
         if (waveManager)
         {
             waveManager->zombieReachedEnd(this);
         }
 
-        // ֹͣЄƳ
+        // 停止所有動作後移除
         this->stopAllActions();
-        if (this->getParent())
-        {
-            this->removeFromParent();
-        }
+        leaveScene();
     }
 }
 
-void Zombie::checkCollisions()
+void Zombie::leaveScene()
 {
-    // Ҫʵϵͳʵײ
-    // ʱʹü򵥵ľ
+    if (_isPooled)
+    {
+        auto waveManager = WaveManager::getInstance();
+        if (waveManager)
+        {
+            waveManager->recycleZombie(this);
+            return;
+        }
+    }
 
-    if (!_targetPlant || !_targetPlant->isAlive())
+    SpriteAnimator::getInstance()->stop(this);
+    if (this->getParent())
     {
-        // Ѱǰֲ
-        _targetPlant = findPlantInFront();
+        this->removeFromParent();
     }
 }
 
+void Zombie::resetForReuse()
+{
+    this->stopAllActions();
+
+    _state = ZombieState::ALIVE;
+    _health = _maxHealth;
+    _attackTimer = 0;
+    _freezeTimer = 0;
+    _targetPlant = nullptr;
+    _isFrozen = false;
+    _speed = _originalSpeed;
+    _hasPrevSimPosition = false;
+    _isInterpolated = false;
+
+    _tint.reset();
+    _tint.apply(this);
+    this->setScale(1.0f);
+    this->setVisible(true);
+
+    // 池中的僵尸可能跨越了图集组的卸载/重新加载
+    refreshAnimations();
+    playWalkAnimation();
+}
+
 Plant* Zombie::findPlantInFront()
 {
     auto gridSystem = GridSystem::getInstance();
     if (!gridSystem) return nullptr;
 
-    // ȡʬǰλöӦ
+    // 获取僵尸当前位置对应的网格
     int col, row;
     Vec2 worldPos = this->getPosition();
 
-    // ԽתΪ
+    // 尝试将世界坐标转换为网格坐标
     if (gridSystem->worldToGrid(worldPos, row, col)) {
-        // 鵱ǰǷֲ
+        // 检查当前格子是否有植物
         Plant* plant = gridSystem->getPlantAt(row, col);
         if (plant && plant->isAlive()) {
             float distance = abs(this->getPositionX() - plant->getPositionX());
-            if (distance <= 5) { // Χ
+            if (distance <= 5) { // 攻击范围
                 return plant;
             }
         }
 
-        // ǰӣࣩ
+        // 检查前方格子（左侧）
         if (col > 0) {
             plant = gridSystem->getPlantAt(row, col - 1);
             if (plant && plant->isAlive()) {
                 float distance = std::abs(this->getPositionX() - plant->getPositionX());
-                if (distance <= 25) { // ԴļⷶΧ
+                if (distance <= 25) { // 稍大的检测范围
                     return plant;
                 }
             }
@@ -3,25 +3,19 @@
 #define __ZOMBIE_H__
 
 #include "cocos2d.h"
+#include "Entities/EntityTypes.h"
+#include "Resources/AssetId.h"
+#include "Entities/TintCompositor.h"
 
 class Plant;
 class Projectile;
 
-// ʬ״̬
+// 僵尸状态
 enum class ZombieState {
-    ALIVE,      // 
-    ATTACKING,  // 
-    DEAD,       // 
-    FROZEN      // 
-};
-
-// ʬ
-enum class ZombieType {
-    NORMAL,     // ͨʬ
-    CONEHEAD,   // ·Ͻʬ
-    BUCKETHEAD, // Ͱʬ
-    FAST,       // ٽʬ
-    GARGANTUAR  // ˽ʬ
+    ALIVE,      // 存活
+    ATTACKING,  // 攻击中
+    DEAD,       // 死亡
+    FROZEN      // 冰冻
 };
 
 class Zombie : public cocos2d::Sprite {
@@ -29,10 +23,10 @@ public:
     virtual bool init() override;
     virtual void update(float delta) override;
 
-    // 
+    // 工厂方法
     static Zombie* create(ZombieType type = ZombieType::NORMAL);
 
-    // Իȡ
+    // 属性获取
     ZombieType getType() const { return _type; }
     ZombieState getState() const { return _state; }
     int getRow() const { return _row; }
@@ -42,25 +36,45 @@ public:
     int getDamage() const { return _damage; }
     bool isAlive() const { return _state != ZombieState::DEAD; }
 
-    // 
+    // 属性设置
     void setType(ZombieType type) { _type = type; }
     void setRow(int row) { _row = row; }
     void setHealth(int health) { _health = health; }
     void setSpeed(float speed) { _speed = speed; }
     void setDamage(int damage) { _damage = damage; }
 
-    // ״̬
+    // 状态控制
     virtual void takeDamage(int damage);
     virtual void attack(Plant* plant);
     virtual void die();
     virtual void freeze(float duration);
-    virtual void unFreeze();  // 
+    virtual void unFreeze();  // 新增：解除冰冻
+
+    // 着色（受击、冰冻、燃烧都登记到合成器，由GameScene每帧统一推进并写回颜色）
+    TintCompositor& getTint() { return _tint; }
+    void updateTint(float delta);
 
-    // ƶ
+    // 移动控制
     virtual void startMoving();
     virtual void stopMoving();
 
-    // 
+    // 分阶段更新（由GameScene的逻辑流水线按 移动 -> 索敌 -> 结算伤害 的顺序调用）
+    void updateMove(float delta);
+    void updateTarget();
+    void updateAttack(float delta);
+
+    // 渲染插值：逻辑步之间显示位置按alpha混合上一步与当前步的逻辑位置
+    void saveSimPosition();                  // 每个逻辑步开始前记录位置
+    void restoreSimPosition();               // 帧开始时把显示位置还原成逻辑位置
+    void applyRenderInterpolation(float alpha);
+
+    // 对象池：池中的僵尸死亡/到达终点后还回WaveManager的ZombiePool
+    void setPooled(bool pooled) { _isPooled = pooled; }
+    bool isPooled() const { return _isPooled; }
+    virtual void resetForReuse();            // 恢复满血、行走状态（子类恢复护甲）
+    void releaseAnimations();                // 释放持有的动画和当前帧纹理（空闲时图集组被淘汰，复用时重新取）
+
+    // 动画控制（帧动画由SpriteAnimator统一推进）
     virtual void playWalkAnimation();
     virtual void playAttackAnimation();
     virtual void playDeathAnimation();
@@ -71,41 +85,57 @@ protected:
     Zombie();
     virtual ~Zombie();
 
-    // ʼضʬ
+    // 初始化特定僵尸类型
     virtual bool initWithType(ZombieType type);
 
-    // Դ
-    virtual std::string getWalkAnimationName() const;
-    virtual std::string getAttackAnimationName() const;
-    virtual std::string getDeathAnimationName() const;
+    // 动画资源（动画名的AssetId）
+    virtual AssetId getWalkAnimationId() const;
+    virtual AssetId getAttackAnimationId() const;
+    virtual AssetId getDeathAnimationId() const;
+
+    // 设置并持有动画（图集组被淘汰后ResourceLoader不再持有，僵尸自己的引用保证动画和纹理仍有效）
+    void setAnimations(cocos2d::Animation* walk, cocos2d::Animation* attack, cocos2d::Animation* death);
+    // 按动画ID重新从ResourceLoader取（图集组重新加载后换成新的动画），取不到的保留原来的
+    void refreshAnimations();
 
-    // Ѱ·ײ
+    // 寻路和碰撞检测
     virtual void updateMovement(float delta);
-    virtual void checkCollisions();
     virtual Plant* findPlantInFront();
 
+    // 离场：池中的僵尸还回对象池，否则从场景移除
+    void leaveScene();
+
 protected:
     ZombieType _type;
     ZombieState _state;
-    int _row;           // 
+    int _row;           // 所在行
 
-    // 
+    // 属性
     int _health;
     int _maxHealth;
-    float _speed;       // /
-    int _damage;        // ÿι˺
-    float _originalSpeed;  // 洢ԭʼٶ
-    bool _isFrozen;        // Ƿڱ״̬
+    float _speed;       // 像素/秒
+    int _damage;        // 每次攻击伤害
+    float _originalSpeed;  // 存储原始速度
+    bool _isFrozen;        // 是否处于冰冻状态
 
-    // ״̬ʱ
+    // 状态计时器
     float _attackTimer;
     float _attackInterval;
     float _freezeTimer;
 
-    // Ŀֲ
+    // 目标植物
     Plant* _targetPlant;
 
-    // 
+    // 渲染插值
+    cocos2d::Vec2 _prevSimPosition;
+    cocos2d::Vec2 _simPosition;
+    bool _hasPrevSimPosition;
+    bool _isInterpolated;
+    bool _isPooled;
+
+    TintCompositor _tint;
+
+    // 动画相关（持有引用）
     cocos2d::Animation* _walkAnimation;
     cocos2d::Animation* _attackAnimation;
     cocos2d::Animation* _deathAnimation;
@@ -1,6 +1,7 @@
 #include "ZombieBucketHead.h"
 #include "./Resources/ResourceLoader.h"
 #include <cocos2d.h>
+#include "./Game/Logger.h"
 
 USING_NS_CC;
 
@@ -18,59 +19,57 @@ ZombieBucketHead* ZombieBucketHead::create()
 
 bool ZombieBucketHead::init()
 {
-    // ȵøinitWithTypeָ
+    // 先调用父类的initWithType，指定类型
     if (!Zombie::init())
     {
         return false;
     }
 
-    // FͰЌ
+    // 鐵桶特有屬性（Zombie::init按NORMAL初始化，这里修正类型，对象池按类型回收）
+    _type = ZombieType::BUCKETHEAD;
     _bucketHealth = 200;
     _bucketDestroyed = false;
 
-    // ע⣺Zombie::initWithTypeѾscheduleUpdate()ﲻҪظ
-    // Oߴ^c
+    // 設置物理尺寸和錨點
     this->setContentSize(Size(60, 100));
-    this->setAnchorPoint(Vec2(0.5f, 0.3f)); // _R
+    this->setAnchorPoint(Vec2(0.5f, 0.3f)); // 腳部對齊地面
 
-    // ض
+    // 加载特定动画
     ResourceLoader* resourceLoader = ResourceLoader::getInstance();
     if (resourceLoader)
     {
-        // LԇdFͰӮ
-        _walkAnimation = resourceLoader->getCachedAnimation("zombie_buckethead_walk");
-        _attackAnimation = resourceLoader->getCachedAnimation("zombie_buckethead_attack");
-        _deathAnimation = resourceLoader->getCachedAnimation("zombie_normal_death");
+        // 嘗試加載鐵桶動畫
+        auto walkAnim = resourceLoader->getCachedAnimation(PVZ_ASSET_ID("zombie_buckethead_walk"));
+        auto attackAnim = resourceLoader->getCachedAnimation(PVZ_ASSET_ID("zombie_buckethead_attack"));
+        auto deathAnim = resourceLoader->getCachedAnimation(PVZ_ASSET_ID("zombie_normal_death"));
 
-        // ]FͰӮʹͨƄӮ
-        if (!_walkAnimation)
+        // 如果沒有鐵桶動畫，使用普通僵屍動畫作為備用
+        if (!walkAnim)
         {
-            _walkAnimation = resourceLoader->getCachedAnimation("zombie_normal_walk");
-            log("WARNING: Using normal zombie walk animation for buckethead");
+            walkAnim = resourceLoader->getCachedAnimation(PVZ_ASSET_ID("zombie_normal_walk"));
+            PVZ_LOGW(LogCategory::ZOMBIE, "Using normal zombie walk animation for buckethead");
         }
+        setAnimations(walkAnim, attackAnim, deathAnim);
 
         if (_walkAnimation)
         {
-            log("ZombieBucketHead: Walk animation loaded successfully, frame count: %d",
+            PVZ_LOGD(LogCategory::ZOMBIE, "ZombieBucketHead: Walk animation loaded successfully, frame count: %d",
                 _walkAnimation->getFrames().size());
-            this->runAction(RepeatForever::create(Animate::create(_walkAnimation)));
+            playWalkAnimation();
         }
         else
         {
-            log("ZombieBucketHead: ERROR: Walk animation not loaded!");
-            // BÄӮ]УεҕXЧ
+            PVZ_LOGE(LogCategory::ZOMBIE, "ZombieBucketHead: Walk animation not loaded!");
+            // 連備用動畫都沒有，創建簡單的視覺效果
             this->setTextureRect(Rect(0, 0, 60, 100));
-            this->setColor(Color3B::WHITE); // ɫʾFͰ
+            this->setColor(Color3B::WHITE); // 灰色表示鐵桶
         }
     }
 
-    // ʼƶ
+    // 开始移动
     startMoving();
 
-    // 
-    this->scheduleUpdate();
-
-    log("ZombieBucketHead: Initialized successfully");
+    PVZ_LOGD(LogCategory::ZOMBIE, "ZombieBucketHead: Initialized successfully");
     return true;
 }
 
@@ -81,13 +80,22 @@ bool ZombieBucketHead::initWithType(ZombieType type)
         return false;
     }
 
-    // Ͱʬضʼ
+    // 铁桶僵尸的特定初始化
     _bucketHealth = 200;
     _bucketDestroyed = false;
 
     return true;
 }
 
+void ZombieBucketHead::resetForReuse()
+{
+    Zombie::resetForReuse();
+
+    // 恢复铁桶
+    _bucketDestroyed = false;
+    _bucketHealth = 200;
+}
+
 void ZombieBucketHead::takeDamage(int damage)
 {
     if (_state == ZombieState::DEAD)
@@ -95,7 +103,7 @@ void ZombieBucketHead::takeDamage(int damage)
         return;
     }
 
-    // ȿ۳Ͱֵ
+    // 先扣除铁桶生命值
     if (!_bucketDestroyed && _bucketHealth > 0)
     {
         if (_bucketHealth >= damage) {
@@ -108,49 +116,44 @@ void ZombieBucketHead::takeDamage(int damage)
             _bucketHealth = 0;
         }
 
-        // ͰƻЧ
+        // 铁桶被破坏的效果
         if (_bucketHealth <= 0)
         {
             _bucketDestroyed = true;
-            log("ZombieBucketHead: Bucket destroyed");
+            PVZ_LOGD(LogCategory::ZOMBIE, "ZombieBucketHead: Bucket destroyed");
 
-            // ͰƻʱЧ
+            // 铁桶被破坏时的效果
             auto scaleAction = ScaleTo::create(0.2f, 1.0f, 0.8f);
             auto restoreAction = ScaleTo::create(0.2f, 1.0f, 1.0f);
             this->runAction(Sequence::create(scaleAction, restoreAction, nullptr));
 
-            // ıɫʾͰ
-            this->setColor(Color3B::WHITE);
+            // 改变颜色表示铁桶已破
+            _tint.setBaseColor(Color3B::WHITE);
         }
 
         
-        // ЧͰ
-        auto tintAction = Sequence::create(
-            TintTo::create(0.1f, Color3B(200, 200, 200)),
-            TintTo::create(0.1f, this->getColor()),
-            nullptr
-        );
-        this->runAction(tintAction);
-
-        log("ZombieBucketHead: Bucket took %d damage, bucket health: %d", damage, _bucketHealth);
+        // 受伤效果（针对铁桶）
+        _tint.start(TintOverlay::HIT_FLASH, 0.2f, Color3B(200, 200, 200));
+
+        PVZ_LOGT(LogCategory::ZOMBIE, "ZombieBucketHead: Bucket took %d damage, bucket health: %d", damage, _bucketHealth);
     }
 
     if(damage>0)
-    // Ͱѱƻ˺ʬ
+    // 铁桶已被破坏，伤害僵尸本体
     Zombie::takeDamage(damage);
 }
 
-std::string ZombieBucketHead::getWalkAnimationName() const
+AssetId ZombieBucketHead::getWalkAnimationId() const
 {
-    return "zombie_buckethead_walk";
+    return PVZ_ASSET_ID("zombie_buckethead_walk");
 }
 
-std::string ZombieBucketHead::getAttackAnimationName() const
+AssetId ZombieBucketHead::getAttackAnimationId() const
 {
-    return "zombie_buckethead_attack";
+    return PVZ_ASSET_ID("zombie_buckethead_attack");
 }
 
-std::string ZombieBucketHead::getDeathAnimationName() const
+AssetId ZombieBucketHead::getDeathAnimationId() const
 {
-    return "zombie_normal_death";
+    return PVZ_ASSET_ID("zombie_normal_death");
 }
\ No newline at end of file
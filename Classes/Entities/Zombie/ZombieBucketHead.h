@@ -9,16 +9,17 @@ public:
     static ZombieBucketHead* create();
     virtual bool init() override;
     virtual void takeDamage(int damage) override;
+    virtual void resetForReuse() override;
 
 protected:
     virtual bool initWithType(ZombieType type) override;
-    virtual std::string getWalkAnimationName() const override;
-    virtual std::string getAttackAnimationName() const override;
-    virtual std::string getDeathAnimationName() const override;
+    virtual AssetId getWalkAnimationId() const override;
+    virtual AssetId getAttackAnimationId() const override;
+    virtual AssetId getDeathAnimationId() const override;
 
 private:
-    bool _bucketDestroyed; // ͰǷѱƻ
-    int _bucketHealth;     // Ͱֵ
+    bool _bucketDestroyed; // 铁桶是否已被破坏
+    int _bucketHealth;     // 铁桶生命值
 };
 
 #endif // __ZOMBIE_BUCKET_HEAD_H__
\ No newline at end of file
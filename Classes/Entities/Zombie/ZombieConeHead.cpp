@@ -1,6 +1,7 @@
 #include "ZombieConeHead.h"
 #include "./Resources/ResourceLoader.h"
 #include <cocos2d.h>
+#include "./Game/Logger.h"
 
 USING_NS_CC;
 
@@ -23,36 +24,35 @@ bool ZombieConeHead::init()
         return false;
     }
 
+    _type = ZombieType::CONEHEAD;   // Zombie::init按NORMAL初始化，这里修正类型（对象池按类型回收）
     _coneDestroyed = false;
-    _coneHealth = 100;    // ·ֵ
+    _coneHealth = 100;    // 路障生命值
 
-    // Լض
+    // 尝试加载动画
     ResourceLoader* resourceLoader = ResourceLoader::getInstance();
     if (resourceLoader)
     {
-        // Լ߶
-        auto walkAnim = resourceLoader->getCachedAnimation("zombie_conehead_walk");
+        // 尝试加载走动画
+        auto walkAnim = resourceLoader->getCachedAnimation(PVZ_ASSET_ID("zombie_conehead_walk"));
         if (walkAnim)
         {
-            _walkAnimation = walkAnim;
-            this->runAction(RepeatForever::create(Animate::create(_walkAnimation)));
+            setAnimations(walkAnim, _attackAnimation, _deathAnimation);
+            playWalkAnimation();
         }
         else
         {
-            log("WARNING: zombie_conehead_walk animation not found, using default sprite");
-            // ʹĬϾ
+            PVZ_LOGW(LogCategory::ZOMBIE, "zombie_conehead_walk animation not found, using default sprite");
+            // 使用默认精灵
             this->setTextureRect(Rect(0, 0, 60, 100));
-            this->setColor(Color3B(0, 150, 0)); // ɫʾ·Ͻʬ
+            _tint.setBaseColor(Color3B(0, 150, 0)); // 绿色表示路障僵尸
+            _tint.apply(this);
         }
     }
 
-    // ʼƶ
+    // 开始移动
     startMoving();
 
-    // 
-    this->scheduleUpdate();
-
-    log("ZombieConeHead: Initialized successfully");
+    PVZ_LOGD(LogCategory::ZOMBIE, "ZombieConeHead: Initialized successfully");
     return true;
 }
 
@@ -63,13 +63,27 @@ bool ZombieConeHead::initWithType(ZombieType type)
         return false;
     }
 
-    // ·Ͻʬضʼ
+    // 路障僵尸的特定初始化
     _coneHealth = 200;
     _coneDestroyed = false;
 
     return true;
 }
 
+void ZombieConeHead::resetForReuse()
+{
+    Zombie::resetForReuse();
+
+    // 恢复路障
+    _coneDestroyed = false;
+    _coneHealth = 100;
+    if (!_walkAnimation)
+    {
+        _tint.setBaseColor(Color3B(0, 150, 0));
+        _tint.apply(this);
+    }
+}
+
 void ZombieConeHead::takeDamage(int damage)
 {
     if (_state == ZombieState::DEAD)
@@ -77,7 +91,7 @@ void ZombieConeHead::takeDamage(int damage)
         return;
     }
 
-    // ȿ۳·ֵ
+    // 先扣除路障生命值
     if (!_coneDestroyed && _coneHealth > 0)
     {
         if (_coneHealth >= damage) {
@@ -90,13 +104,13 @@ void ZombieConeHead::takeDamage(int damage)
             _coneHealth = 0;
         }
 
-        // ·ϱƻЧ
+        // 路障被破坏的效果
         if (_coneHealth <= 0)
         {
             _coneDestroyed = true;
-            log("ZombieConeHead: Cone destroyed");
+            PVZ_LOGD(LogCategory::ZOMBIE, "ZombieConeHead: Cone destroyed");
 
-            this->setColor(Color3B::WHITE); // ͨʬɫ
+            _tint.setBaseColor(Color3B::WHITE); // 变成普通僵尸颜色
 
             auto shakeAction = Sequence::create(
                 MoveBy::create(0.1f, Vec2(5, 0)),
@@ -107,33 +121,28 @@ void ZombieConeHead::takeDamage(int damage)
             this->runAction(shakeAction);
         }
 
-        // Ч·ϣ
-        auto tintAction = Sequence::create(
-            TintTo::create(0.1f, Color3B::GREEN),
-            TintTo::create(0.1f, this->getColor()),
-            nullptr
-        );
-        this->runAction(tintAction);
+        // 受伤效果（针对路障）
+        _tint.start(TintOverlay::HIT_FLASH, 0.2f, Color3B::GREEN);
 
-        log("ZombieConeHead: Cone took %d damage, cone health: %d", damage, _coneHealth);
+        PVZ_LOGT(LogCategory::ZOMBIE, "ZombieConeHead: Cone took %d damage, cone health: %d", damage, _coneHealth);
     }
 
     if(damage)
-    // ·ѱƻ˺ʬ
+    // 路障已被破坏，伤害僵尸本体
         Zombie::takeDamage(damage);
 }
 
-std::string ZombieConeHead::getWalkAnimationName() const
+AssetId ZombieConeHead::getWalkAnimationId() const
 {
-    return "zombie_conehead_walk";
+    return PVZ_ASSET_ID("zombie_conehead_walk");
 }
 
-std::string ZombieConeHead::getAttackAnimationName() const
+AssetId ZombieConeHead::getAttackAnimationId() const
 {
-    return "zombie_conehead_attack";
+    return PVZ_ASSET_ID("zombie_conehead_attack");
 }
 
-std::string ZombieConeHead::getDeathAnimationName() const
+AssetId ZombieConeHead::getDeathAnimationId() const
 {
-    return "zombie_normal_death";
+    return PVZ_ASSET_ID("zombie_normal_death");
 }
\ No newline at end of file
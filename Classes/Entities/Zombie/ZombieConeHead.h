@@ -9,16 +9,17 @@ public:
     static ZombieConeHead* create();
     virtual bool init() override;
     virtual void takeDamage(int damage) override;
+    virtual void resetForReuse() override;
 
 protected:
     virtual bool initWithType(ZombieType type) override;
-    virtual std::string getWalkAnimationName() const override;
-    virtual std::string getAttackAnimationName() const override;
-    virtual std::string getDeathAnimationName() const override;
+    virtual AssetId getWalkAnimationId() const override;
+    virtual AssetId getAttackAnimationId() const override;
+    virtual AssetId getDeathAnimationId() const override;
 
 private:
-    bool _coneDestroyed; // ·Ƿѱƻ
-    int _coneHealth;     // ·ֵ
+    bool _coneDestroyed; // 路障是否已被破坏
+    int _coneHealth;     // 路障生命值
 };
 
 #endif // __ZOMBIE_CONE_HEAD_H__
\ No newline at end of file
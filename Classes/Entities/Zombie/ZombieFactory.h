@@ -26,16 +26,16 @@ public:
         int random = rand() % 100;
 
         if (waveNumber <= 2) {
-            // ǰ2ֻͨʬ
+            // 前2波只有普通僵尸
             return createZombie(ZombieType::NORMAL);
         }
         else if (waveNumber <= 5) {
-            // 3-5ͨ·Ͻʬ
+            // 3-5波有普通和路障僵尸
             if (random < 80) return createZombie(ZombieType::NORMAL);
             else return createZombie(ZombieType::CONEHEAD);
         }
         else {
-            // 6֮
+            // 6波之后有所有类型
             if (random < 60) return createZombie(ZombieType::NORMAL);
             else if (random < 85) return createZombie(ZombieType::CONEHEAD);
             else return createZombie(ZombieType::BUCKETHEAD);
@@ -1,6 +1,7 @@
 #include "ZombieNormal.h"
 #include "./Resources/ResourceLoader.h"
 #include <cocos2d.h>
+#include "./Game/Logger.h"
 
 USING_NS_CC;
 
@@ -23,34 +24,31 @@ bool ZombieNormal::init()
         return false;
     }
 
-    // ĬJľ`Ӯdʧ
+    // 創建默認的精靈（如果動畫加載失敗）
     this->setTextureRect(Rect(0, 0, 60, 100));
     this->setColor(Color3B::WHITE);
 
-    // LԇdӮ
+    // 嘗試加載動畫
     ResourceLoader* resourceLoader = ResourceLoader::getInstance();
     if (resourceLoader)
     {
-        // Lԇd߄ӄӮ
-        auto walkAnim = resourceLoader->getCachedAnimation("zombie_normal_walk");
+        // 嘗試加載走動動畫
+        auto walkAnim = resourceLoader->getCachedAnimation(PVZ_ASSET_ID("zombie_normal_walk"));
         if (walkAnim)
         {
-            _walkAnimation = walkAnim;
-            this->runAction(RepeatForever::create(Animate::create(_walkAnimation)));
+            setAnimations(walkAnim, _attackAnimation, _deathAnimation);
+            playWalkAnimation();
         }
         else
         {
-            log("WARNING: zombie_normal_walk animation not found, using default sprite");
+            PVZ_LOGW(LogCategory::ZOMBIE, "zombie_normal_walk animation not found, using default sprite");
         }
     }
 
-    // _ʼƄ
+    // 開始移動
     startMoving();
 
-    // Ӹ
-    this->scheduleUpdate();
-
-    log("ZombieNormal: Initialized successfully at row %d", _row);
+    PVZ_LOGD(LogCategory::ZOMBIE, "ZombieNormal: Initialized successfully at row %d", _row);
     return true;
 }
 
@@ -61,19 +59,23 @@ bool ZombieNormal::initWithType(ZombieType type)
         return false;
     }
 
-    // ͨʬضԴ
+    // 加载普通僵尸的特定资源
     ResourceLoader* resourceLoader = ResourceLoader::getInstance();
     if (resourceLoader)
     {
-        // ûжĬϵ
+        // 如果没有动画，创建默认的
         if (!resourceLoader->hasAnimation("zombie_normal_walk"))
         {
-            // Ĭ϶֡
+            // 创建默认动画帧
             Vector<SpriteFrame*> frames;
             for (int i = 1; i <= 4; i++)
             {
                 std::string frameName = StringUtils::format("Images/Zombies/Normal/walk_%02d.png", i);
-                auto frame = SpriteFrame::create(frameName, Rect(0, 0, 100, 100));
+                auto frame = SpriteFrameCache::getInstance()->getSpriteFrameByName(frameName);
+                if (!frame)
+                {
+                    frame = SpriteFrame::create(frameName, Rect(0, 0, 100, 100));
+                }
                 if (frame)
                 {
                     frames.pushBack(frame);
@@ -91,17 +93,17 @@ bool ZombieNormal::initWithType(ZombieType type)
     return true;
 }
 
-std::string ZombieNormal::getWalkAnimationName() const
+AssetId ZombieNormal::getWalkAnimationId() const
 {
-    return "zombie_normal_walk";
+    return PVZ_ASSET_ID("zombie_normal_walk");
 }
 
-std::string ZombieNormal::getAttackAnimationName() const
+AssetId ZombieNormal::getAttackAnimationId() const
 {
-    return "zombie_normal_attack";
+    return PVZ_ASSET_ID("zombie_normal_attack");
 }
 
-std::string ZombieNormal::getDeathAnimationName() const
+AssetId ZombieNormal::getDeathAnimationId() const
 {
-    return "zombie_normal_death";
+    return PVZ_ASSET_ID("zombie_normal_death");
 }
\ No newline at end of file
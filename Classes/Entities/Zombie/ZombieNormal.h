@@ -12,9 +12,9 @@ public:
 
 protected:
     virtual bool initWithType(ZombieType type) override;
-    virtual std::string getWalkAnimationName() const override;
-    virtual std::string getAttackAnimationName() const override;
-    virtual std::string getDeathAnimationName() const override;
+    virtual AssetId getWalkAnimationId() const override;
+    virtual AssetId getAttackAnimationId() const override;
+    virtual AssetId getDeathAnimationId() const override;
 };
 
 #endif // __ZOMBIE_NORMAL_H__
\ No newline at end of file
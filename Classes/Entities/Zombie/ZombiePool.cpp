@@ -0,0 +1,225 @@
+#include "ZombiePool.h"
+#include "./Entities/Zombie/ZombieFactory.h"
+#include <algorithm>
+#include "./Game/Logger.h"
+#include "./Game/SpriteAnimator.h"
+
+USING_NS_CC;
+
+ZombiePool::ZombiePool()
+    : _layer(nullptr)
+    , _zOrder(0)
+{
+}
+
+ZombiePool::~ZombiePool()
+{
+    for (auto& pool : _pools)
+    {
+        for (auto zombie : pool.nodes)
+        {
+            if (zombie->getParent())
+            {
+                zombie->removeFromParent();
+            }
+            zombie->release();
+        }
+    }
+    _pools.clear();
+}
+
+void ZombiePool::setLayer(Node* layer, int zOrder)
+{
+    _layer = layer;
+    _zOrder = zOrder;
+}
+
+void ZombiePool::prewarm(ZombieType type, int count)
+{
+    if (!_layer)
+    {
+        return;
+    }
+
+    TypePool& pool = getTypePool(type);
+    while ((int)pool.nodes.size() < count)
+    {
+        Zombie* zombie = createNode(pool);
+        if (!zombie)
+        {
+            break;
+        }
+        pool.free.push_back(zombie);
+    }
+
+    // 已有的空闲实例迁移到新的生成层
+    for (auto zombie : pool.free)
+    {
+        attachToLayer(zombie);
+    }
+
+    PVZ_LOGI(LogCategory::ZOMBIE, "ZombiePool: Type %d prewarmed %d nodes", (int)type, (int)pool.nodes.size());
+}
+
+Zombie* ZombiePool::acquire(ZombieType type)
+{
+    if (!_layer)
+    {
+        return nullptr;
+    }
+
+    TypePool& pool = getTypePool(type);
+    Zombie* zombie = nullptr;
+    if (!pool.free.empty())
+    {
+        zombie = pool.free.back();
+        pool.free.pop_back();
+    }
+    else
+    {
+        // 池空：临时扩容，记录一次miss
+        zombie = createNode(pool);
+        if (!zombie)
+        {
+            return nullptr;
+        }
+        pool.stats.misses++;
+    }
+
+    attachToLayer(zombie);
+    zombie->resetForReuse();
+
+    pool.stats.acquires++;
+    pool.stats.inUse++;
+    pool.stats.highWater = std::max(pool.stats.highWater, pool.stats.inUse);
+    return zombie;
+}
+
+void ZombiePool::release(Zombie* zombie)
+{
+    if (!zombie)
+    {
+        return;
+    }
+
+    TypePool& pool = getTypePool(zombie->getType());
+    if (std::find(pool.free.begin(), pool.free.end(), zombie) != pool.free.end())
+    {
+        return;
+    }
+
+    SpriteAnimator::getInstance()->stop(zombie);
+    zombie->setVisible(false);
+    pool.free.push_back(zombie);
+    pool.stats.inUse--;
+}
+
+void ZombiePool::reclaimAll()
+{
+    for (auto& pool : _pools)
+    {
+        pool.free.clear();
+        for (auto zombie : pool.nodes)
+        {
+            zombie->stopAllActions();
+            SpriteAnimator::getInstance()->stop(zombie);
+            zombie->setVisible(false);
+            pool.free.push_back(zombie);
+        }
+        pool.stats.inUse = 0;
+    }
+}
+
+void ZombiePool::releaseIdleAnimations()
+{
+    for (auto& pool : _pools)
+    {
+        for (auto zombie : pool.free)
+        {
+            zombie->releaseAnimations();
+        }
+    }
+}
+
+const ZombiePool::Stats& ZombiePool::getStats(ZombieType type) const
+{
+    static const Stats emptyStats = { 0, 0, 0, 0, 0 };
+    for (const auto& pool : _pools)
+    {
+        if (pool.type == type)
+        {
+            return pool.stats;
+        }
+    }
+    return emptyStats;
+}
+
+void ZombiePool::logStats() const
+{
+    for (const auto& pool : _pools)
+    {
+        PVZ_LOGD(LogCategory::ZOMBIE, "ZombiePool: Type %d - capacity %d, in use %d, high water %d, misses %d, acquires %d",
+            (int)pool.type, pool.stats.capacity, pool.stats.inUse, pool.stats.highWater,
+            pool.stats.misses, pool.stats.acquires);
+    }
+}
+
+ZombiePool::TypePool& ZombiePool::getTypePool(ZombieType type)
+{
+    for (auto& pool : _pools)
+    {
+        if (pool.type == type)
+        {
+            return pool;
+        }
+    }
+
+    TypePool pool;
+    pool.type = type;
+    pool.stats.capacity = 0;
+    pool.stats.inUse = 0;
+    pool.stats.highWater = 0;
+    pool.stats.misses = 0;
+    pool.stats.acquires = 0;
+    _pools.push_back(pool);
+    return _pools.back();
+}
+
+Zombie* ZombiePool::createNode(TypePool& pool)
+{
+    Zombie* zombie = ZombieFactory::createZombie(pool.type);
+    if (!zombie)
+    {
+        return nullptr;
+    }
+
+    zombie->retain();
+    zombie->setPooled(true);
+    zombie->setVisible(false);
+    attachToLayer(zombie);
+
+    pool.nodes.push_back(zombie);
+    pool.stats.capacity = (int)pool.nodes.size();
+    return zombie;
+}
+
+void ZombiePool::attachToLayer(Zombie* zombie)
+{
+    // 生成层可能把僵尸挂在更深的容器里（EntityLayers按行分层），在其子树中即视为已挂好
+    for (Node* parent = zombie->getParent(); parent; parent = parent->getParent())
+    {
+        if (parent == _layer)
+        {
+            return;
+        }
+    }
+
+    if (zombie->getParent())
+    {
+        zombie->removeFromParent();
+    }
+    if (_layer)
+    {
+        _layer->addChild(zombie, _zOrder);
+    }
+}
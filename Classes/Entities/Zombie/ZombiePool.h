@@ -0,0 +1,71 @@
+#pragma once
+#ifndef __ZOMBIE_POOL_H__
+#define __ZOMBIE_POOL_H__
+
+#include "cocos2d.h"
+#include <vector>
+#include "Entities/Zombie/Zombie.h"
+
+// 僵尸对象池（按ZombieType分组，由WaveManager持有）
+// 僵尸死亡或到达终点后隐藏并还回池中，下一波、下一局（restartGame）直接复用，
+// 实例持有自己的动画句柄；复用时按名字重新取一次（该类型的图集组可能已被淘汰又重新加载）。
+// 池不随场景销毁，取出时如果节点不在当前生成层上会重新挂到生成层。
+class ZombiePool
+{
+public:
+    // 池统计（用于调整预热数量）
+    struct Stats
+    {
+        int capacity;       // 池中节点总数
+        int inUse;          // 当前在场上的数量
+        int highWater;      // inUse的历史最大值
+        int misses;         // 池空时临时创建节点的次数
+        int acquires;       // 总取出次数
+    };
+
+    ZombiePool();
+    ~ZombiePool();
+
+    // 设置生成层（新场景调用，已有节点在取出时迁移过去）
+    void setLayer(cocos2d::Node* layer, int zOrder);
+
+    // 为某种僵尸预热count个实例
+    void prewarm(ZombieType type, int count);
+
+    // 取出一个已重置并挂在生成层上的僵尸，未设置生成层时返回nullptr
+    Zombie* acquire(ZombieType type);
+
+    // 还回池中（隐藏，留待复用）
+    void release(Zombie* zombie);
+
+    // 把所有实例都收回空闲列表（开局重置时调用，回收死亡动画被场景切换打断的僵尸）
+    void reclaimAll();
+
+    // 空闲实例释放动画和纹理引用（图集组被淘汰后调用，否则被淘汰的纹理仍被池中僵尸留在显存里）
+    void releaseIdleAnimations();
+
+    const Stats& getStats(ZombieType type) const;
+    void logStats() const;
+
+private:
+    ZombiePool(const ZombiePool&) = delete;
+    ZombiePool& operator=(const ZombiePool&) = delete;
+
+    struct TypePool
+    {
+        ZombieType type;
+        std::vector<Zombie*> nodes;     // 该类型的所有实例（持有引用）
+        std::vector<Zombie*> free;      // 空闲实例
+        Stats stats;
+    };
+
+    TypePool& getTypePool(ZombieType type);
+    Zombie* createNode(TypePool& pool);
+    void attachToLayer(Zombie* zombie);
+
+    std::vector<TypePool> _pools;
+    cocos2d::Node* _layer;
+    int _zOrder;
+};
+
+#endif // __ZOMBIE_POOL_H__
@@ -0,0 +1,238 @@
+#include "EntityLayers.h"
+#include <algorithm>
+#include "./Game/Logger.h"
+#include "./Resources/TextureResidency.h"
+
+USING_NS_CC;
+
+namespace {
+    const char* const LAYER_NAMES[] = { "plants", "zombies", "projectiles" };
+
+    // 行容器在effect/sun层之下；行号越小越靠前
+    const int EFFECT_LAYER_Z = 1000;
+    const int SUN_LAYER_Z = 1001;
+}
+
+EntityLayers* EntityLayers::_active = nullptr;
+
+EntityLayers* EntityLayers::create(int laneCount)
+{
+    auto layers = new (std::nothrow) EntityLayers();
+    if (layers && layers->initWithLaneCount(laneCount))
+    {
+        layers->autorelease();
+        return layers;
+    }
+    delete layers;
+    return nullptr;
+}
+
+EntityLayers::EntityLayers()
+    : _laneCount(0)
+    , _effectLayer(nullptr)
+    , _sunLayer(nullptr)
+    , _evictionListener(0)
+{
+}
+
+bool EntityLayers::initWithLaneCount(int laneCount)
+{
+    if (!Node::init() || laneCount <= 0)
+    {
+        return false;
+    }
+
+    _laneCount = laneCount;
+    for (int row = 0; row < laneCount; row++)
+    {
+        auto lane = Node::create();
+        addChild(lane, laneCount - row);
+        for (int layer = 0; layer < (int)EntityLayer::COUNT; layer++)
+        {
+            auto container = Node::create();
+            lane->addChild(container, layer);
+            _laneLayers.push_back(container);
+        }
+    }
+
+    _effectLayer = Node::create();
+    addChild(_effectLayer, EFFECT_LAYER_Z);
+    _sunLayer = Node::create();
+    addChild(_sunLayer, SUN_LAYER_Z);
+    return true;
+}
+
+void EntityLayers::onEnter()
+{
+    Node::onEnter();
+    _active = this;
+
+    _evictionListener = TextureResidency::getInstance()->getEvictionObservable().subscribe([this](const int&) {
+        resetTextureRanks();
+    }, false);
+}
+
+void EntityLayers::onExit()
+{
+    if (_evictionListener)
+    {
+        TextureResidency::getInstance()->getEvictionObservable().unsubscribe(_evictionListener);
+        _evictionListener = 0;
+    }
+    if (_active == this)
+    {
+        _active = nullptr;
+    }
+    Node::onExit();
+}
+
+Node* EntityLayers::getLaneLayer(EntityLayer layer, int row) const
+{
+    row = std::max(0, std::min(row, _laneCount - 1));
+    return _laneLayers[row * (int)EntityLayer::COUNT + (int)layer];
+}
+
+void EntityLayers::place(Sprite* entity, EntityLayer layer, int row)
+{
+    if (!entity)
+    {
+        return;
+    }
+
+    Node* container = getLaneLayer(layer, row);
+    int rank = getTextureRank(entity->getTexture());
+    if (entity->getParent() == container)
+    {
+        if (entity->getLocalZOrder() != rank)
+        {
+            entity->setLocalZOrder(rank);
+        }
+        return;
+    }
+
+    // 换容器时不清理动作和调度（池中的实体在这之前已经重置好）
+    entity->retain();
+    if (entity->getParent())
+    {
+        entity->removeFromParentAndCleanup(false);
+    }
+    container->addChild(entity, rank);
+    entity->release();
+}
+
+void EntityLayers::textureChanged(Sprite* entity)
+{
+    // 行容器是 this -> 行 -> 种类容器 -> 实体
+    Node* container = entity ? entity->getParent() : nullptr;
+    if (!container || !container->getParent() || container->getParent()->getParent() != this)
+    {
+        return;
+    }
+
+    int rank = getTextureRank(entity->getTexture());
+    if (entity->getLocalZOrder() != rank)
+    {
+        entity->setLocalZOrder(rank);
+    }
+}
+
+int EntityLayers::getTextureRank(Texture2D* texture)
+{
+    auto it = std::find(_textureRanks.begin(), _textureRanks.end(), texture);
+    if (it != _textureRanks.end())
+    {
+        return (int)(it - _textureRanks.begin());
+    }
+    _textureRanks.push_back(texture);
+    return (int)_textureRanks.size() - 1;
+}
+
+void EntityLayers::resetTextureRanks()
+{
+    _textureRanks.clear();
+    for (auto container : _laneLayers)
+    {
+        for (auto child : container->getChildren())
+        {
+            auto sprite = dynamic_cast<Sprite*>(child);
+            if (sprite)
+            {
+                int rank = getTextureRank(sprite->getTexture());
+                if (sprite->getLocalZOrder() != rank)
+                {
+                    sprite->setLocalZOrder(rank);
+                }
+            }
+        }
+    }
+}
+
+void EntityLayers::collectBatchStats(std::vector<LayerStats>& stats)
+{
+    stats.clear();
+    for (int row = _laneCount - 1; row >= 0; row--)
+    {
+        for (int layer = 0; layer < (int)EntityLayer::COUNT; layer++)
+        {
+            countBatches(getLaneLayer((EntityLayer)layer, row),
+                StringUtils::format("lane%d.%s", row, LAYER_NAMES[layer]), stats);
+        }
+    }
+    countBatches(_effectLayer, "effects", stats);
+    countBatches(_sunLayer, "suns", stats);
+}
+
+void EntityLayers::countBatches(Node* layer, const std::string& name, std::vector<LayerStats>& stats)
+{
+    // 按绘制顺序遍历（先排序，与visit时一致）
+    layer->sortAllChildren();
+
+    LayerStats layerStats = { name, 0, 0 };
+    Texture2D* lastTexture = nullptr;
+    GLProgramState* lastState = nullptr;
+    BlendFunc lastBlend = BlendFunc::DISABLE;
+    for (auto child : layer->getChildren())
+    {
+        auto sprite = dynamic_cast<Sprite*>(child);
+        if (!sprite || !sprite->isVisible())
+        {
+            continue;
+        }
+
+        const BlendFunc& blend = sprite->getBlendFunc();
+        if (layerStats.sprites == 0 || sprite->getTexture() != lastTexture ||
+            sprite->getGLProgramState() != lastState || blend != lastBlend)
+        {
+            layerStats.batches++;
+        }
+        lastTexture = sprite->getTexture();
+        lastState = sprite->getGLProgramState();
+        lastBlend = blend;
+        layerStats.sprites++;
+    }
+
+    if (layerStats.sprites > 0)
+    {
+        stats.push_back(layerStats);
+    }
+}
+
+void EntityLayers::logBatchStats()
+{
+    std::vector<LayerStats> stats;
+    collectBatchStats(stats);
+
+    int sprites = 0;
+    int batches = 0;
+    for (const auto& layerStats : stats)
+    {
+        PVZ_LOGI(LogCategory::GAME, "EntityLayers: %-18s %4d sprites, %3d batches",
+            layerStats.name.c_str(), layerStats.sprites, layerStats.batches);
+        sprites += layerStats.sprites;
+        batches += layerStats.batches;
+    }
+
+    auto renderer = Director::getInstance()->getRenderer();
+    PVZ_LOGI(LogCategory::GAME, "EntityLayers: %d sprites in %d entity batches; renderer drew %d batches, %d vertices last frame",
+        sprites, batches, (int)renderer->getDrawnBatches(), (int)renderer->getDrawnVertices());
+}
@@ -0,0 +1,76 @@
+#pragma once
+#ifndef __ENTITY_LAYERS_H__
+#define __ENTITY_LAYERS_H__
+
+#include "cocos2d.h"
+#include <string>
+#include <vector>
+
+// 每行内按种类分的实体容器
+enum class EntityLayer
+{
+    PLANT,
+    ZOMBIE,
+    PROJECTILE,
+    COUNT
+};
+
+// EntityLayers - 游戏场景的实体层级
+// 每行一个容器（下面的行在前，遮挡上面的行），行内按植物 -> 僵尸 -> 子弹分层；阳光和爆炸特效各一层，压在所有行之上。
+// 同一层内的精灵按纹理排序（localZOrder为纹理的序号），同纹理的精灵连续绘制，
+// 渲染器能把相邻的TrianglesCommand合批；以前植物、僵尸、子弹、阳光直接挂在场景上交错绘制，几乎每个精灵都要换纹理。
+// 所有容器都在原点且不缩放，实体坐标与挂在场景上时一致。
+class EntityLayers : public cocos2d::Node
+{
+public:
+    // 每层的合批统计：按绘制顺序数相邻精灵的材质（纹理、混合、着色器）切换次数，即这一层至少要提交的批次
+    struct LayerStats
+    {
+        std::string name;
+        int sprites;        // 可见精灵数
+        int batches;        // 预计批次数
+    };
+
+    static EntityLayers* create(int laneCount);
+
+    // 当前场景的实体层级（F10输出统计用）；没有游戏场景时为nullptr
+    static EntityLayers* getActive() { return _active; }
+
+    virtual void onEnter() override;
+    virtual void onExit() override;
+
+    // 把实体挂到所在行、所属种类的容器下并按纹理排序；已在该容器中时只更新排序
+    void place(cocos2d::Sprite* entity, EntityLayer layer, int row);
+    // 精灵换了纹理（如动画切到另一张图集页）后按新纹理重新排序；不在行容器中的精灵忽略
+    void textureChanged(cocos2d::Sprite* entity);
+
+    cocos2d::Node* getLaneLayer(EntityLayer layer, int row) const;
+    cocos2d::Node* getEffectLayer() const { return _effectLayer; }
+    cocos2d::Node* getSunLayer() const { return _sunLayer; }
+    int getLaneCount() const { return _laneCount; }
+
+    // 按绘制顺序统计每层（非空的层）的精灵数和批次数
+    void collectBatchStats(std::vector<LayerStats>& stats);
+    // 输出每层统计和渲染器上一帧实际的批次数
+    void logBatchStats();
+
+private:
+    EntityLayers();
+    bool initWithLaneCount(int laneCount);
+
+    int getTextureRank(cocos2d::Texture2D* texture);
+    // 有图集组被淘汰：清空纹理序号（旧指针可能被新纹理复用），行容器里的精灵重新排序
+    void resetTextureRanks();
+    void countBatches(cocos2d::Node* layer, const std::string& name, std::vector<LayerStats>& stats);
+
+    static EntityLayers* _active;
+
+    int _laneCount;
+    std::vector<cocos2d::Node*> _laneLayers;            // 下标为 行 * 种类数 + 种类
+    cocos2d::Node* _effectLayer;
+    cocos2d::Node* _sunLayer;
+    std::vector<cocos2d::Texture2D*> _textureRanks;     // 纹理首次出现的顺序即排序序号
+    int _evictionListener;                              // TextureResidency淘汰通知的订阅ID
+};
+
+#endif // __ENTITY_LAYERS_H__
@@ -0,0 +1,114 @@
+#include "FixedStepClock.h"
+#include <algorithm>
+
+const float FixedStepClock::DEFAULT_STEP = 1.0f / 120.0f;
+
+FixedStepClock::FixedStepClock(float step)
+    : _step(step > 0.0f ? step : DEFAULT_STEP)
+    , _speed(Speed::X1)
+    , _accumulator(0.0f)
+    , _maxFrameDelta(0.25f)
+    , _uncappedBudget(0.012f)
+    , _maxStepsPerFrame(64)
+    , _stepsThisFrame(0)
+    , _droppedSteps(0)
+{
+}
+
+void FixedStepClock::reset()
+{
+    _accumulator = 0.0f;
+    _stepsThisFrame = 0;
+    _droppedSteps = 0;
+}
+
+void FixedStepClock::setSpeed(Speed speed)
+{
+    _speed = speed;
+    // 切换倍速时丢弃残留时间，避免从UNCAPPED切回来时补跑
+    _accumulator = 0.0f;
+}
+
+FixedStepClock::Speed FixedStepClock::getNextSpeed(Speed speed)
+{
+    switch (speed) {
+    case Speed::X1:  return Speed::X2;
+    case Speed::X2:  return Speed::X4;
+    case Speed::X4:  return Speed::X16;
+    case Speed::X16: return Speed::UNCAPPED;
+    default:         return Speed::X1;
+    }
+}
+
+int FixedStepClock::getSpeedMultiplier(Speed speed)
+{
+    switch (speed) {
+    case Speed::X1:  return 1;
+    case Speed::X2:  return 2;
+    case Speed::X4:  return 4;
+    case Speed::X16: return 16;
+    default:         return 0;
+    }
+}
+
+const char* FixedStepClock::getSpeedName(Speed speed)
+{
+    switch (speed) {
+    case Speed::X1:  return "1x";
+    case Speed::X2:  return "2x";
+    case Speed::X4:  return "4x";
+    case Speed::X16: return "16x";
+    default:         return "MAX";
+    }
+}
+
+void FixedStepClock::beginFrame(float frameDelta)
+{
+    _stepsThisFrame = 0;
+    _frameStart = std::chrono::steady_clock::now();
+
+    if (_speed == Speed::UNCAPPED) {
+        _accumulator = 0.0f;
+        return;
+    }
+
+    frameDelta = std::min(std::max(frameDelta, 0.0f), _maxFrameDelta);
+    _accumulator += frameDelta * getSpeedMultiplier(_speed);
+}
+
+bool FixedStepClock::consumeStep()
+{
+    if (_speed == Speed::UNCAPPED) {
+        // 至少跑一步，之后按墙钟预算决定是否继续
+        if (_stepsThisFrame > 0) {
+            float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - _frameStart).count();
+            if (elapsed >= _uncappedBudget) {
+                return false;
+            }
+        }
+        _stepsThisFrame++;
+        return true;
+    }
+
+    if (_accumulator < _step) {
+        return false;
+    }
+    if (_stepsThisFrame >= _maxStepsPerFrame) {
+        // 本帧已到上限：剩下的整步丢掉，只留零头给插值，下一帧不再补跑
+        int dropped = (int)(_accumulator / _step);
+        _droppedSteps += dropped;
+        _accumulator -= dropped * _step;
+        return false;
+    }
+    _accumulator -= _step;
+    _stepsThisFrame++;
+    return true;
+}
+
+float FixedStepClock::getAlpha() const
+{
+    if (_speed == Speed::UNCAPPED) {
+        return 1.0f;
+    }
+    return std::min(_accumulator / _step, 1.0f);
+}
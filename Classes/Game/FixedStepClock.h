@@ -0,0 +1,70 @@
+#pragma once
+#ifndef __FIXED_STEP_CLOCK_H__
+#define __FIXED_STEP_CLOCK_H__
+
+#include <chrono>
+
+// FixedStepClock - 固定步长累加器
+// 把每帧不定长的delta累加起来，按固定步长（默认1/120秒）切成若干逻辑步，
+// 帧率抖动不再影响对局结果（子弹飞行距离、攻击计时、出怪计时都按同样的步长推进）。
+// 剩余不足一步的时间用getAlpha()给渲染插值。
+// 每帧的步数有上限，逻辑步本身跑不动时丢弃超出的整步（只保留不足一步的零头），不会一帧比一帧欠得更多。
+// 倍速模式每帧按倍数多跑几步；UNCAPPED模式不看帧时间，在每帧的墙钟预算内尽可能多跑。
+// 不依赖cocos2d，场景(GameScene)和无头运行器共用。
+
+class FixedStepClock {
+public:
+    enum class Speed {
+        X1,
+        X2,
+        X4,
+        X16,
+        UNCAPPED
+    };
+
+    // 默认逻辑步长
+    static const float DEFAULT_STEP;
+
+    explicit FixedStepClock(float step = DEFAULT_STEP);
+
+    // 清空累加器（开局/重开时调用）
+    void reset();
+
+    // 倍速
+    void setSpeed(Speed speed);
+    Speed getSpeed() const { return _speed; }
+    static Speed getNextSpeed(Speed speed);
+    static int getSpeedMultiplier(Speed speed);   // UNCAPPED返回0
+    static const char* getSpeedName(Speed speed);
+
+    // 单帧最多计入的时间，卡顿超过这个值的部分直接丢弃，避免越追越慢
+    void setMaxFrameDelta(float seconds) { _maxFrameDelta = seconds; }
+    // UNCAPPED模式下每帧用于逻辑步的墙钟时间
+    void setUncappedBudget(float seconds) { _uncappedBudget = seconds; }
+    // 每帧最多跑的逻辑步数（UNCAPPED模式不受限制，由墙钟预算控制）
+    void setMaxStepsPerFrame(int steps) { _maxStepsPerFrame = steps > 0 ? steps : 1; }
+
+    // 每帧开始时调用一次，然后循环 while (clock.consumeStep()) { tick(clock.getStep()); }
+    void beginFrame(float frameDelta);
+    bool consumeStep();
+
+    float getStep() const { return _step; }
+    // 上一逻辑步到下一逻辑步之间的插值比例 [0, 1]
+    float getAlpha() const;
+    int getStepsThisFrame() const { return _stepsThisFrame; }
+    // 因步数上限被丢弃的逻辑步累计数（reset时清零）
+    int getDroppedSteps() const { return _droppedSteps; }
+
+private:
+    float _step;
+    Speed _speed;
+    float _accumulator;
+    float _maxFrameDelta;
+    float _uncappedBudget;
+    int _maxStepsPerFrame;
+    int _stepsThisFrame;
+    int _droppedSteps;
+    std::chrono::steady_clock::time_point _frameStart;
+};
+
+#endif // __FIXED_STEP_CLOCK_H__
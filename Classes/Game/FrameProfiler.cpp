@@ -0,0 +1,123 @@
+#include "FrameProfiler.h"
+#include <chrono>
+#include <cstdio>
+
+namespace {
+    const uint64_t EVENT_MASK = FrameProfiler::EVENT_CAPACITY - 1;
+
+    // 事件名都是代码里的字面量，这里只做最基本的JSON转义
+    void writeJsonString(FILE* file, const char* text)
+    {
+        fputc('"', file);
+        for (const char* p = text; *p; p++) {
+            if (*p == '"' || *p == '\\') {
+                fputc('\\', file);
+            }
+            fputc(*p, file);
+        }
+        fputc('"', file);
+    }
+}
+
+const int FrameProfiler::EVENT_CAPACITY;
+
+FrameProfiler* FrameProfiler::_instance = nullptr;
+
+FrameProfiler* FrameProfiler::getInstance()
+{
+    if (_instance == nullptr) {
+        _instance = new FrameProfiler();
+    }
+    return _instance;
+}
+
+FrameProfiler::FrameProfiler()
+    : _events(new Event[EVENT_CAPACITY])
+    , _writeIndex(0)
+    , _enabled(false)
+    , _frameIndex(0)
+    , _startTime(now())
+{
+    static_assert((EVENT_CAPACITY & (EVENT_CAPACITY - 1)) == 0, "EVENT_CAPACITY must be a power of two");
+    clear();
+}
+
+FrameProfiler::~FrameProfiler()
+{
+    delete[] _events;
+    _instance = nullptr;
+}
+
+uint64_t FrameProfiler::now()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t FrameProfiler::getThreadId()
+{
+    static std::atomic<uint32_t> nextId(1);
+    thread_local uint32_t threadId = nextId.fetch_add(1, std::memory_order_relaxed);
+    return threadId;
+}
+
+void FrameProfiler::record(const char* name, uint64_t start, uint64_t end)
+{
+    uint64_t index = _writeIndex.fetch_add(1, std::memory_order_relaxed);
+    Event& event = _events[index & EVENT_MASK];
+
+    event.sequence.store(0, std::memory_order_relaxed);
+    event.name = name;
+    event.start = start;
+    event.duration = end > start ? end - start : 0;
+    event.threadId = getThreadId();
+    event.frame = getFrameIndex();
+    event.sequence.store(index + 1, std::memory_order_release);
+}
+
+int FrameProfiler::getEventCount() const
+{
+    uint64_t written = _writeIndex.load(std::memory_order_relaxed);
+    return (int)(written < (uint64_t)EVENT_CAPACITY ? written : (uint64_t)EVENT_CAPACITY);
+}
+
+void FrameProfiler::clear()
+{
+    for (int i = 0; i < EVENT_CAPACITY; i++) {
+        _events[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    _writeIndex.store(0, std::memory_order_release);
+}
+
+bool FrameProfiler::writeChromeTrace(const std::string& filePath) const
+{
+    FILE* file = fopen(filePath.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+
+    uint64_t end = _writeIndex.load(std::memory_order_acquire);
+    uint64_t begin = end > (uint64_t)EVENT_CAPACITY ? end - EVENT_CAPACITY : 0;
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"PlantsVsZombiesMini\"}}", file);
+
+    for (uint64_t i = begin; i < end; i++) {
+        const Event& event = _events[i & EVENT_MASK];
+        if (event.sequence.load(std::memory_order_acquire) != i + 1) {
+            continue;   // 正在写或已被覆盖
+        }
+
+        // trace_event的时间单位是微秒，相对profiler创建时间
+        double ts = event.start > _startTime ? (double)(event.start - _startTime) / 1000.0 : 0.0;
+        double dur = (double)event.duration / 1000.0;
+        fputs(",\n{\"name\":", file);
+        writeJsonString(file, event.name);
+        fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%u}}",
+            event.threadId, ts, dur, event.frame);
+    }
+
+    fputs("\n]}\n", file);
+    fclose(file);
+    return true;
+}
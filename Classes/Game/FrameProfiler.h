@@ -0,0 +1,106 @@
+#pragma once
+#ifndef __FRAME_PROFILER_H__
+#define __FRAME_PROFILER_H__
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// FrameProfiler - 分阶段帧耗时采样
+// 用PVZ_PROFILE_ZONE("名字")在作用域开头打点，离开作用域时记录一段[开始, 结束)，
+// 写进固定大小的环形缓冲区（满了覆盖最旧的），可以随时导出为Chrome trace_event JSON
+// （chrome://tracing 或 Perfetto 打开）。关闭时每个打点只多一次原子读。
+// 替代cocos2d自带的CC_PROFILER_*（需要CC_ENABLE_PROFILERS重编引擎，且只有平均值没有时间线）。
+// PVZ_PROFILER_ENABLED为0时宏展开为空。不依赖cocos2d，场景和无头运行器共用。
+
+#ifndef PVZ_PROFILER_ENABLED
+#define PVZ_PROFILER_ENABLED 1
+#endif
+
+class FrameProfiler {
+public:
+    static const int EVENT_CAPACITY = 1 << 16;  // 环形缓冲区大小，必须是2的幂
+
+    static FrameProfiler* getInstance();
+
+    void setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    // 帧计数，写进每个事件的args里方便在时间线上对照
+    void beginFrame() { _frameIndex.fetch_add(1, std::memory_order_relaxed); }
+    uint32_t getFrameIndex() const { return _frameIndex.load(std::memory_order_relaxed); }
+
+    // 单调时钟（纳秒）
+    static uint64_t now();
+
+    // 记录一段耗时；name必须是静态字符串（只存指针）
+    void record(const char* name, uint64_t start, uint64_t end);
+
+    // 当前缓冲区里的事件数
+    int getEventCount() const;
+    void clear();
+
+    // 导出缓冲区里的事件为Chrome trace JSON
+    bool writeChromeTrace(const std::string& filePath) const;
+
+private:
+    FrameProfiler();
+    ~FrameProfiler();
+
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    struct Event {
+        std::atomic<uint64_t> sequence;     // 写完后为写入序号+1，导出时跳过写了一半的槽位
+        const char* name;
+        uint64_t start;
+        uint64_t duration;
+        uint32_t threadId;
+        uint32_t frame;
+    };
+
+    static uint32_t getThreadId();
+
+    static FrameProfiler* _instance;
+
+    Event* _events;
+    std::atomic<uint64_t> _writeIndex;
+    std::atomic<bool> _enabled;
+    std::atomic<uint32_t> _frameIndex;
+    uint64_t _startTime;
+};
+
+// 作用域计时：构造时取开始时间，析构时记录
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : _name(name)
+        , _start(FrameProfiler::getInstance()->isEnabled() ? FrameProfiler::now() : 0)
+    {
+    }
+
+    ~ProfileScope()
+    {
+        if (_start != 0) {
+            FrameProfiler::getInstance()->record(_name, _start, FrameProfiler::now());
+        }
+    }
+
+private:
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    const char* _name;
+    uint64_t _start;
+};
+
+#define PVZ_PROFILE_CONCAT_INNER(a, b) a##b
+#define PVZ_PROFILE_CONCAT(a, b) PVZ_PROFILE_CONCAT_INNER(a, b)
+
+#if PVZ_PROFILER_ENABLED
+#define PVZ_PROFILE_ZONE(name) ProfileScope PVZ_PROFILE_CONCAT(_profileScope, __LINE__)(name)
+#else
+#define PVZ_PROFILE_ZONE(name) ((void)0)
+#endif
+
+#endif // __FRAME_PROFILER_H__
@@ -1,10 +1,14 @@
 #include "GameManager.h"
 #include "./UI/MenuScene.h"
+#include "./UI/LoadingScene.h"
 #include "GameScene.h"
 #include "Game/WaveManager.h"
+#include "Game/GameTuning.h"
 #include "./Resources/AudioManager.h"
 #include "./Resources/ResourceLoader.h"
 #include <Entities/Projectile/Projectile.h>
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
 
 USING_NS_CC;
 
@@ -17,8 +21,8 @@ GameManager* GameManager::getInstance()
         _instance = new GameManager();
         if (_instance && _instance->init())
         {
-            // Cocos2d-x 3.17УRefautorelease()ʽͬ
-            // ʹֶڴ
+            // 在Cocos2d-x 3.17中，Ref的autorelease()管理方式不同
+            // 我们使用手动内存管理
         }
         else
         {
@@ -30,7 +34,8 @@ GameManager* GameManager::getInstance()
 }
 
 GameManager::GameManager()
-    : _currentState(GameState::MENU)
+    : _entityLayers(nullptr)
+    , _currentState(GameState::MENU)
     , _sunCount(0)
     , _currentLevel(1)
     , _playerScore(0)
@@ -41,12 +46,17 @@ GameManager::GameManager()
 
 GameManager::~GameManager()
 {
+    for (auto pool : _projectilePools)
+    {
+        delete pool;
+    }
+    _projectilePools.clear();
     _instance = nullptr;
 }
 
 bool GameManager::init()
 {
-    // Ϸ
+    // 加载游戏配置
     auto userDefaults = UserDefault::getInstance();
 
     _currentLevel = userDefaults->getIntegerForKey("current_level", 1);
@@ -54,17 +64,17 @@ bool GameManager::init()
     _isSoundEnabled = userDefaults->getBoolForKey("sound_enabled", true);
     _isMusicEnabled = userDefaults->getBoolForKey("music_enabled", true);
 
-    // ʼ WaveManager惦ɆT
-   // WaveManager::getInstance()->init(); // ֱ{
+    // 初始化 WaveManager（但不存儲為成員）
+   // WaveManager::getInstance()->init(); // 直接調用
 
     return true;
 }
 
 bool GameManager::spendSun(int amount)
 {
-    if (_sunCount >= amount)
+    if (_sunCount.get() >= amount)
     {
-        _sunCount -= amount;
+        _sunCount.set(_sunCount.get() - amount);
         return true;
     }
     return false;
@@ -72,12 +82,12 @@ bool GameManager::spendSun(int amount)
 
 void GameManager::startNewGame()
 {
-    log("GameManager: Starting new game");
+    PVZ_LOGI(LogCategory::GAME, "GameManager: Starting new game");
 
-    // YԴ
+    // 先清理所有資源
     clearAllProjectiles();
 
-    // 횙
+    // 清理殭屍
     auto waveManager = WaveManager::getInstance();
     if (waveManager)
     {
@@ -85,14 +95,14 @@ void GameManager::startNewGame()
         waveManager->reset();
     }
 
-    // [򔵓
-    _sunCount = 100;
+    // 重置遊戲數據
+    _sunCount.set(GameTuning::STARTING_SUN);
     _currentState = GameState::PLAYING;
     _playerScore = 0;
     _projectiles.clear();
 
-    // ГQ[
-    goToGameScene();
+    // 先進加載場景，後台解碼完遊戲資源後再切到遊戲場景
+    goToLoadingScene();
 }
 
 void GameManager::pauseGame()
@@ -103,10 +113,10 @@ void GameManager::pauseGame()
 
         auto director = Director::getInstance();
 
-        // Cocos2d-x 3.17Уʹ·ʽͣ
+        // Cocos2d-x 3.17中，使用以下方式暂停
         director->pause();
 
-        // ͣ
+        // 暂停背景音乐
         AudioManager::getInstance()->pauseBackgroundMusic();
     }
 }
@@ -119,22 +129,22 @@ void GameManager::resumeGame()
 
         auto director = Director::getInstance();
 
-        // Cocos2d-x 3.17Уʹ·ʽָ
+        // Cocos2d-x 3.17中，使用以下方式恢复
         director->resume();
 
-        // ָ
+        // 恢复背景音乐
         AudioManager::getInstance()->resumeBackgroundMusic();
     }
 }
 
 void GameManager::restartGame()
 {
-    // Ϸ
-    _sunCount = 100;
+    // 重置游戏数据
+    _sunCount.set(GameTuning::STARTING_SUN);
     _playerScore = 0;
     _currentState = GameState::PLAYING;
     clearAllProjectiles();
-    // ¼Ϸ
+    // 重新加载游戏场景
     goToGameScene();
 }
 
@@ -142,23 +152,13 @@ void GameManager::gameOver(bool isWin)
 {
     _currentState = GameState::GAME_OVER;
 
-    // Ϸ
+    // 保存游戏数据
     auto userDefaults = UserDefault::getInstance();
     userDefaults->setIntegerForKey("player_score", _playerScore);
     userDefaults->setIntegerForKey("current_level", _currentLevel);
     userDefaults->flush();
 
-    // ӳٷز˵
-    auto director = Director::getInstance();
-    director->getRunningScene()->runAction(
-        Sequence::create(
-            DelayTime::create(2.0f),
-            CallFunc::create([]() {
-                GameManager::getInstance()->goToMenuScene();
-                }),
-            nullptr
-                    )
-    );
+    // 返回菜单的延迟由GameScene按逻辑时间倒计时（倍速时同步加快，暂停时停止）
 }
 
 void GameManager::goToMenuScene()
@@ -168,7 +168,16 @@ void GameManager::goToMenuScene()
     auto director = Director::getInstance();
     auto scene = MenuScene::createScene();
 
-    // лĹЧ
+    // 切换场景的过渡效果
+    director->replaceScene(TransitionFade::create(0.5f, scene));
+}
+
+void GameManager::goToLoadingScene()
+{
+    auto director = Director::getInstance();
+    auto scene = LoadingScene::createScene();
+
+    // 切换场景的过渡效果
     director->replaceScene(TransitionFade::create(0.5f, scene));
 }
 
@@ -177,71 +186,177 @@ void GameManager::goToGameScene()
     _currentState = GameState::PLAYING;
 
     auto director = Director::getInstance();
-    auto scene = GameScene::createScene();  // ʹµGameScene
+    auto scene = GameScene::createScene();  // 使用新的GameScene
 
-    // лĹЧ
+    // 切换场景的过渡效果
     director->replaceScene(TransitionFade::create(0.5f, scene));
 
-    // Ϸ֣GameSceneѾ
+    // 播放游戏背景音乐（在GameScene中已经处理）
     // AudioManager::getInstance()->playBackgroundMusic("Sounds/BGM/game_bgm.mp3", true);
 }
 
-void GameManager::addProjectile(Projectile* projectile)
+Projectile* GameManager::spawnProjectile(ProjectileType type, int damage, float speed,
+    const Vec2& position, int row)
 {
+    ProjectilePool* pool = getProjectilePool(type);
+    Projectile* projectile = pool ? pool->acquire() : nullptr;
     if (!projectile)
     {
-        return;
+        return nullptr;
     }
 
-    // ǷѾ
-    auto it = std::find(_projectiles.begin(), _projectiles.end(), projectile);
-    if (it == _projectiles.end())
+    projectile->initProjectile(type, damage, speed);
+    projectile->setLaunchParams(position, Vec2(1.0f, 0.0f));
+    projectile->setRow(row);
+    if (_entityLayers)
     {
-        _projectiles.push_back(projectile);
-        log("GameManager: Projectile added, total: %d", (int)_projectiles.size());
+        _entityLayers->place(projectile, EntityLayer::PROJECTILE, row);
     }
+
+    // 池中取出的节点同一时刻只会在列表中出现一次，不需要查重
+    _projectiles.push_back(projectile);
+    return projectile;
 }
 
 void GameManager::updateProjectiles(float delta)
 {
-    // ʹõȫرƳ
+    PVZ_PROFILE_ZONE("GameManager::updateProjectiles");
+
+    // 只更新飞行，移除放到清理阶段，避免本帧碰撞检测时列表变化
+    for (auto projectile : _projectiles)
+    {
+        if (projectile && projectile->isAlive() && projectile->getParent())
+        {
+            projectile->update(delta);
+        }
+    }
+}
+
+void GameManager::cleanupProjectiles()
+{
+    PVZ_PROFILE_ZONE("GameManager::cleanupProjectiles");
+
+    // 使用迭代器安全地遍历和移除
     for (auto it = _projectiles.begin(); it != _projectiles.end(); )
     {
         Projectile* projectile = *it;
 
-        // ָǷЧ
+        // 检查指针是否有效
         if (!projectile)
         {
-            log("GameManager: Removing null projectile");
+            PVZ_LOGW(LogCategory::GAME, "GameManager: Removing null projectile");
             it = _projectiles.erase(it);
             continue;
         }
 
-        // ӵǷѾٻƳ
+        // 检查子弹是否已经被销毁或移除
         if (!projectile->isAlive() || 
             projectile->getState() == ProjectileState::DEAD ||
-            !projectile->getParent())  // 飺ӵǷѾӳƳ
+            !projectile->getParent())  // 新增检查：子弹是否已经从场景中移除
         {
-            log("GameManager: Removing dead or detached projectile");
-            
-            // ȫشбƳҪӸڵƳΪѾƳˣ
+            // 池中的子弹还回对象池，其它子弹已在destroy中自行移除
+            if (projectile->isPooled())
+            {
+                ProjectilePool* pool = getProjectilePool(projectile->getType());
+                if (pool)
+                {
+                    pool->release(projectile);
+                }
+            }
+
             it = _projectiles.erase(it);
             continue;
         }
 
-        // ´ӵ
-        projectile->update(delta);
         ++it;
     }
 }
 
+void GameManager::resolveProjectileCollisions()
+{
+    PVZ_PROFILE_ZONE("GameManager::resolveProjectileCollisions");
+
+    auto waveManager = WaveManager::getInstance();
+    if (!waveManager) return;
+
+    _broadphase.reset(WaveManager::LANE_COUNT);
+    _collisionZombies.clear();
+
+    // 僵尸按行加入，每只每帧只计算一次包围盒
+    for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+    {
+        for (auto zombie : waveManager->getZombiesInRow(row))
+        {
+            if (!zombie || !zombie->isAlive()) continue;
+
+            Rect zombieRect = zombie->getBoundingBox();
+            _broadphase.addBody(row, zombieRect.getMinX(), zombieRect.getMaxX(),
+                (uint32_t)_collisionZombies.size());
+            _collisionZombies.push_back(zombie);
+        }
+    }
+
+    // 子弹用上次检测到现在的位移做扫掠区间
+    for (size_t i = 0; i < _projectiles.size(); i++)
+    {
+        Projectile* projectile = _projectiles[i];
+        if (!projectile || projectile->getState() != ProjectileState::FLYING || !projectile->getParent())
+        {
+            continue;
+        }
+
+        float halfWidth = projectile->getBoundingBox().size.width * 0.5f;
+        _broadphase.addSweep(projectile->getRow(), projectile->getSweepFromX(),
+            projectile->getPositionX(), halfWidth, (uint32_t)i);
+    }
+
+    // 命中按子弹分组、组内按进入先后排序；前面的僵尸已死时顺延到下一个
+    const auto& hits = _broadphase.solve();
+    size_t i = 0;
+    while (i < hits.size())
+    {
+        uint32_t sweepId = hits[i].sweepId;
+        Projectile* projectile = _projectiles[sweepId];
+
+        bool consumed = false;
+        for (; i < hits.size() && hits[i].sweepId == sweepId; i++)
+        {
+            if (!consumed)
+            {
+                consumed = projectile->handleZombieHit(_collisionZombies[hits[i].bodyId], hits[i].hitX);
+            }
+        }
+    }
+
+    for (auto projectile : _projectiles)
+    {
+        if (projectile && projectile->isAlive())
+        {
+            projectile->resetSweep();
+        }
+    }
+}
+
 void GameManager::clearAllProjectiles()
 {
-    log("GameManager: Clearing all projectiles (%d)", (int)_projectiles.size());
+    PVZ_LOGI(LogCategory::GAME, "GameManager: Clearing all projectiles (%d)", (int)_projectiles.size());
 
     for (auto projectile : _projectiles)
     {
-        if (projectile && projectile->getParent())
+        if (!projectile)
+        {
+            continue;
+        }
+
+        if (projectile->isPooled())
+        {
+            ProjectilePool* pool = getProjectilePool(projectile->getType());
+            if (pool)
+            {
+                pool->release(projectile);
+            }
+        }
+        else if (projectile->getParent())
         {
             projectile->removeFromParent();
         }
@@ -257,6 +372,59 @@ void GameManager::removeProjectile(Projectile* projectile)
     if (it != _projectiles.end())
     {
         _projectiles.erase(it);
-        log("GameManager: Projectile removed, total: %d", (int)_projectiles.size());
+        PVZ_LOGD(LogCategory::GAME, "GameManager: Projectile removed, total: %d", (int)_projectiles.size());
+    }
+}
+
+void GameManager::prewarmProjectilePools(EntityLayers* layers)
+{
+    _entityLayers = layers;
+
+    // 预热数量按满屏射手估算，不够时池会临时扩容并记录miss
+    getProjectilePool(ProjectileType::PEA)->prewarm(layers, 0, 48);
+    getProjectilePool(ProjectileType::SNOW_PEA)->prewarm(layers, 0, 16);
+}
+
+void GameManager::releaseProjectilePools(EntityLayers* layers)
+{
+    logProjectilePoolStats();
+
+    // 只释放绑定在该场景层上的池（切换场景时新场景可能已经预热）
+    for (auto pool : _projectilePools)
+    {
+        if (pool->getLayer() == layers)
+        {
+            pool->clear();
+            pool->resetStats();
+        }
+    }
+    if (_entityLayers == layers)
+    {
+        _entityLayers = nullptr;
+    }
+}
+
+ProjectilePool* GameManager::getProjectilePool(ProjectileType type)
+{
+    for (auto pool : _projectilePools)
+    {
+        if (pool->getType() == type)
+        {
+            return pool;
+        }
     }
-}
\ No newline at end of file
+
+    auto pool = new ProjectilePool(type);
+    _projectilePools.push_back(pool);
+    return pool;
+}
+
+void GameManager::logProjectilePoolStats() const
+{
+    for (auto pool : _projectilePools)
+    {
+        const auto& stats = pool->getStats();
+        PVZ_LOGI(LogCategory::GAME, "GameManager: Projectile pool %d - capacity %d, in use %d, high water %d, misses %d, acquires %d",
+            (int)pool->getType(), stats.capacity, stats.inUse, stats.highWater, stats.misses, stats.acquires);
+    }
+}
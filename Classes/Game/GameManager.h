@@ -3,74 +3,99 @@
 
 #include "cocos2d.h"
 #include <vector>
-#include "Entities/Projectile/Projectile.h"  // Ϊ
+#include "Entities/Projectile/Projectile.h"  // 改为完整包含
+#include "Entities/Projectile/ProjectilePool.h"
+#include "Game/LaneBroadphase.h"
+#include "Game/EntityLayers.h"
+#include "Game/Observable.h"
 
 class GameManager : public cocos2d::Ref
 {
 public:
-    // ʵ
+    // 单例访问点
     static GameManager* getInstance();
 
-    // Ϸ״̬ö
+    // 游戏状态枚举
     enum class GameState
     {
-        MENU,       // ˵״̬
-        PLAYING,    // Ϸ
-        PAUSED,     // Ϸͣ
-        GAME_OVER   // Ϸ
+        MENU,       // 菜单状态
+        PLAYING,    // 游戏进行中
+        PAUSED,     // 游戏暂停
+        GAME_OVER   // 游戏结束
     };
 
-    // Ϸ״̬
+    // 游戏状态管理
     GameState getCurrentState() const { return _currentState; }
     void setCurrentState(GameState state) { _currentState = state; }
 
-    // Դ
-    int getSunCount() const { return _sunCount; }
-    void setSunCount(int count) { _sunCount = count; }
-    void addSun(int amount) { _sunCount += amount; }
+    // 资源管理
+    int getSunCount() const { return _sunCount.get(); }
+    void setSunCount(int count) { _sunCount.set(count); }
+    void addSun(int amount) { _sunCount.set(_sunCount.get() + amount); }
     bool spendSun(int amount);
+    // 阳光数量变化时通知订阅者（HUD订阅，不再每帧轮询）
+    Observable<int>& getSunObservable() { return _sunCount; }
 
-    // Ϸ
+    // 游戏控制
     void startNewGame();
     void pauseGame();
     void resumeGame();
     void restartGame();
-    void gameOver(bool isWin);
+    void gameOver(bool isWin);          // 进入GAME_OVER并保存进度，由GameScene延迟后返回菜单
 
-    // 
+    // 场景管理
     void goToMenuScene();
+    void goToLoadingScene();    // 菜单进入游戏前的加载场景，完成后调用goToGameScene
     void goToGameScene();
 
-    //ӵ
-    void addProjectile(Projectile* projectile);
+    //子弹管理（由GameScene的逻辑流水线分阶段调用：飞行 -> 碰撞 -> 清理）
+    // 从对象池取出子弹并发射（向右飞行），池未预热时返回nullptr
+    Projectile* spawnProjectile(ProjectileType type, int damage, float speed,
+        const cocos2d::Vec2& position, int row);
     void updateProjectiles(float delta);
+    void resolveProjectileCollisions();
+    void cleanupProjectiles();
+    const std::vector<Projectile*>& getProjectiles() const { return _projectiles; }
 
     void clearAllProjectiles();
 
     void removeProjectile(Projectile* projectile);
 
+    // 子弹对象池（每种子弹一个，关卡开始时由GameScene预热，场景销毁时释放）
+    // 子弹先挂在实体层级下，发射时再按行挂到子弹层
+    void prewarmProjectilePools(EntityLayers* layers);
+    void releaseProjectilePools(EntityLayers* layers);
+    ProjectilePool* getProjectilePool(ProjectileType type);
+    void logProjectilePoolStats() const;
+
 private:
     GameManager();
     virtual ~GameManager();
 
-    // ֹ
+    // 禁止拷贝
     GameManager(const GameManager&) = delete;
     GameManager& operator=(const GameManager&) = delete;
 
-    // ʼ
+    // 初始化
     bool init();
 
 private:
     static GameManager* _instance;
     std::vector<Projectile*> _projectiles;
+    std::vector<ProjectilePool*> _projectilePools;
+    EntityLayers* _entityLayers;
+
+    // 碰撞检测（每帧复用，避免分配）
+    LaneBroadphase _broadphase;
+    std::vector<Zombie*> _collisionZombies;
 
-    // Ϸ״̬
+    // 游戏状态
     GameState _currentState;
 
-    // ϷԴ
-    int _sunCount;
+    // 游戏资源
+    Observable<int> _sunCount;
 
-    // Ϸ
+    // 游戏配置
     int _currentLevel;
     int _playerScore;
     bool _isSoundEnabled;
@@ -5,10 +5,21 @@
 #include "./Resources/ResourceLoader.h"
 #include "./UI/PlantCard.h" 
 #include "WaveManager.h"
+#include "./Game/SunManager.h"
 #include "./Entities/Zombie/ZombieNormal.h"
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
+#include "./Game/ParticleEffectPool.h"
+#include "./Game/PerfOverlay.h"
+#include "./Game/GameTuning.h"
 
 USING_NS_CC;
 
+namespace {
+    // 最后一波清完/僵尸到达终点后到结算、结算后到返回菜单的逻辑时间
+    const float RESULT_DELAY = 2.0f;
+}
+
 Scene* GameScene::createScene()
 {
     auto scene = Scene::create();
@@ -19,17 +30,23 @@ Scene* GameScene::createScene()
 
 GameScene::~GameScene()
 {
-    log("GameScene: Destructor called");
+    PVZ_LOGD(LogCategory::GAME, "GameScene: Destructor called");
+
+    if (_sunListenerId)
+    {
+        GameManager::getInstance()->getSunObservable().unsubscribe(_sunListenerId);
+        _sunListenerId = 0;
+    }
 
-    // ע⣺Ҫ release()Ϊ Cocos2d-x ʹԶü
-    // ֲڵ removeAllChildrenWithCleanup(true) ʱѾͷ
+    // 注意：不要调用 release()，因为 Cocos2d-x 使用自动引用计数
+    // 植物节点在 removeAllChildrenWithCleanup(true) 时已经被释放
 
     if (_waveManager)
     {
         _waveManager->clearAllZombies();
     }
 
-    // ָֻ
+    // 只需清空指针向量
 
     for (auto plant : _plants)
     {
@@ -39,41 +56,41 @@ GameScene::~GameScene()
         }
     }
 
-    // 
-    for (auto sun : _randomSuns)
+    // 释放绑定在本场景上的阳光池和粒子特效池
+    if (_entityLayers)
     {
-        if (sun && sun->getParent())
-        {
-            sun->removeFromParent();
-        }
+        SunManager::getInstance()->detachLayer(_entityLayers->getSunLayer());
+        ParticleEffectPool::getInstance()->detachLayer(_entityLayers->getEffectLayer());
     }
-    _randomSuns.clear();
 
     _plants.clear();
     _plantCards.clear();
     _cardBarBackground = nullptr;
     _plantPreview = nullptr;
     _pauseButton = nullptr;
+    _speedButton = nullptr;
     _sunLabel = nullptr;
     _levelLabel = nullptr;
 
-    //  WaveManager еĚ
+    // 清理 WaveManager 中的殭屍（還回對象池），並解除生成層綁定
     if (_waveManager)
     {
-        _waveManager->clearAllZombies(); // ʹ reset()  clearAllZombies()
+        _waveManager->clearAllZombies(); // 使用 reset() 而不是 clearAllZombies()
+        _waveManager->detachSpawnLayer(_entityLayers);
     }
 
-    // YԴ
+    // 清理其他資源
     if (_plantPreview && _plantPreview->getParent())
     {
         _plantPreview->removeFromParent();
     }
 
-    //  GameManager еӏ
+    // 清理 GameManager 中的子彈，并释放绑定在本场景上的子弹对象池
     auto gameManager = GameManager::getInstance();
     if (gameManager)
     {
         gameManager->clearAllProjectiles();
+        gameManager->releaseProjectilePools(_entityLayers);
     }
 }
 
@@ -84,11 +101,11 @@ bool GameScene::init()
         return false;
     }
 
-    // ȡС
+    // 获取可视区域大小
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 origin = Director::getInstance()->getVisibleOrigin();
 
-    // ʼ
+    // 初始化背景
     //auto background = LayerColor::create(Color4B(100, 180, 100, 255), visibleSize.width, visibleSize.height);
     //this->addChild(background, 0);
 
@@ -104,84 +121,105 @@ bool GameScene::init()
     this->addChild(background, 0);
 
 
-    // ȡResourceLoaderԤϷԴ
+    // 获取ResourceLoader并预加载游戏资源
     ResourceLoader* resourceLoader = ResourceLoader::getInstance();
 
     resourceLoader = ResourceLoader::getInstance();
     if (resourceLoader)
     {
-        log("GameScene: Preloading game resources...");
+        PVZ_LOGD(LogCategory::GAME, "GameScene: Preloading game resources...");
         resourceLoader->preloadResources(ResourceLoader::LoadingPhase::GAME_RESOURCES);
-        log("GameScene: Game resources preloaded");
+        PVZ_LOGI(LogCategory::GAME, "GameScene: Game resources preloaded");
 
-        // ؼǷسɹ
-        if (resourceLoader->getCachedAnimation("sunflower_idle")) {
-            CCLOG("GameScene: Sunflower idle animation loaded successfully");
+        // 检查关键动画是否加载成功
+        if (resourceLoader->getCachedAnimation(PVZ_ASSET_ID("sunflower_idle"))) {
+            PVZ_LOGD(LogCategory::GAME, "GameScene: Sunflower idle animation loaded successfully");
         }
         else {
-            CCLOG("GameScene: WARNING: Sunflower idle animation NOT loaded");
+            PVZ_LOGW(LogCategory::GAME, "GameScene: Sunflower idle animation NOT loaded");
         }
 
-        if (resourceLoader->getCachedAnimation("peashooter_idle")) {
-            CCLOG("GameScene: Peashooter idle animation loaded successfully");
+        if (resourceLoader->getCachedAnimation(PVZ_ASSET_ID("peashooter_idle"))) {
+            PVZ_LOGD(LogCategory::GAME, "GameScene: Peashooter idle animation loaded successfully");
         }
         else {
-            CCLOG("GameScene: WARNING: Peashooter idle animation NOT loaded");
+            PVZ_LOGW(LogCategory::GAME, "GameScene: Peashooter idle animation NOT loaded");
         }
     }
     else
     {
-        CCLOG("GameScene: ERROR: ResourceLoader is null!");
+        PVZ_LOGE(LogCategory::GAME, "GameScene: ResourceLoader is null!");
     }
 
-    // ʼϵͳ
+    // 初始化网格系统
     initGrid();
 
-    // ʼUI
+    // 植物、僵尸、子弹、阳光按行分层挂在实体层级下（在网格之上、卡牌栏之下）
+    _entityLayers = EntityLayers::create(GridSystem::getInstance()->getRows());
+    this->addChild(_entityLayers, 3);
+
+    // 初始化UI
     initUI();
 
-    // ʼֲ￨
+    // 初始化植物卡牌
     initPlantCards();
 
-    // ʼ
+    // 初始化触摸处理器
     initTouchHandlers();
 
-    // ʼϷ״̬
+    // 初始化游戏状态
     _selectedPlantType = PlantType::SUNFLOWER;
     _hasSelectedPlant = false;
     _plantPreview = nullptr;
+    _nextWaveTimer = 0.0f;
+    _resultTimer = 0.0f;
+    _resultIsWin = false;
+    _menuTimer = RESULT_DELAY;
+    _clock.reset();
 
-    // óʼ
+    // 阳光显示和卡牌状态绑定到阳光数量（订阅时立即刷新一次），设置初始阳光，预热子弹对象池
     auto gameManager = GameManager::getInstance();
     if (gameManager)
     {
-        gameManager->setSunCount(100); // ʼ100
-        updateSunDisplay();
+        _sunListenerId = gameManager->getSunObservable().subscribe([this](const int& sunCount) {
+            updateSunDisplay(sunCount);
+            updatePlantCards(sunCount);
+            });
+        gameManager->setSunCount(GameTuning::STARTING_SUN);
+        gameManager->prewarmProjectilePools(_entityLayers);
     }
 
-    // ű
+    // 预热爆炸、击中粒子（挂在特效层，压在冲击波之上）
+    ParticleEffectPool::getInstance()->prewarm(_entityLayers->getEffectLayer(), 10);
+
+    // 性能面板（F7切换），压在所有UI之上
+    _perfOverlay = PerfOverlay::create();
+    _perfOverlay->setPosition(origin + Vec2(8, 8));
+    this->addChild(_perfOverlay, 1000);
+
+    // 播放背景音乐
     AudioManager::getInstance()->playBackgroundMusic(
         ResourceLoader::getInstance()->getBackgroundMusicPath("sound_game_bgm"),
         true
     );
 
-    // øµ
+    // 设置更新调度
     this->scheduleUpdate();
     _waveManager = WaveManager::getInstance();
     initZombieSystem();
 
-    // ʼϵͳ
+    // 初始化随机阳光系统
     initRandomSunSystem();
 
-    log("GameScene: Initialized");
-    log("=== GAME SCENE INITIALIZATION COMPLETE ===");
-    log("WaveManager instance: %p", _waveManager);
-    log("=== GAME SCENE INITIALIZATION REPORT ===");
-    log("1. ResourceLoader: %s", resourceLoader ? "OK" : "NULL");
-    log("2. GameManager: %s", gameManager ? "OK" : "NULL");
-    log("3. WaveManager: %s", _waveManager ? "OK" : "NULL");
+    PVZ_LOGI(LogCategory::GAME, "GameScene: Initialized");
+    PVZ_LOGI(LogCategory::GAME, "=== GAME SCENE INITIALIZATION COMPLETE ===");
+    PVZ_LOGI(LogCategory::GAME, "WaveManager instance: %p", _waveManager);
+    PVZ_LOGI(LogCategory::GAME, "=== GAME SCENE INITIALIZATION REPORT ===");
+    PVZ_LOGI(LogCategory::GAME, "1. ResourceLoader: %s", resourceLoader ? "OK" : "NULL");
+    PVZ_LOGI(LogCategory::GAME, "2. GameManager: %s", gameManager ? "OK" : "NULL");
+    PVZ_LOGI(LogCategory::GAME, "3. WaveManager: %s", _waveManager ? "OK" : "NULL");
     //log("4. AudioManager: %s", audioManager ? "OK" : "NULL");
-    log("======================================");
+    PVZ_LOGI(LogCategory::GAME, "======================================");
 
     return true;
 
@@ -189,181 +227,475 @@ bool GameScene::init()
 
 void GameScene::initZombieSystem()
 {
-    log("GameScene: Initializing zombie system...");
+    PVZ_LOGD(LogCategory::GAME, "GameScene: Initializing zombie system...");
 
-    // 1. AdYԴ
-    auto resourceLoader = ResourceLoader::getInstance();
-    if (resourceLoader)
-    {
-        log("Preloading zombie resources...");
-        resourceLoader->preloadZombieResources();
-    }
+    // 1. 僵屍圖集不在這裡加載：WaveManager在準備階段預取第一波的類型，出場時才acquire
 
-    // 2. @ȡ WaveManager
+    // 2. 獲取 WaveManager
     _waveManager = WaveManager::getInstance();
     if (!_waveManager)
     {
-        log("ERROR: WaveManager::getInstance() returned null!");
+        PVZ_LOGE(LogCategory::GAME, "WaveManager::getInstance() returned null!");
         return;
     }
 
-    // 3. ãҪ initγʼ
+    // 3. 先重置（不要重新 init，避免多次初始化）
     _waveManager->reset();
 
-    // 4. Oû{
+    // 殭屍生成到本場景層，出生點在屏幕右側
+    _waveManager->setSpawnLayer(_entityLayers, Director::getInstance()->getVisibleSize().width - 20);
+
+    // 预热僵尸对象池（上一局回收的实例会迁移到本场景）
+    _waveManager->prewarmZombies(8);
+
+    // 4. 設置回調
     _waveManager->setWaveStartedCallback([this](int waveNumber) {
-        log("GameScene: Wave %d started", waveNumber);
+        PVZ_LOGI(LogCategory::GAME, "GameScene: Wave %d started", waveNumber);
+
+        if (_perfOverlay)
+        {
+            _perfOverlay->markWave(waveNumber);
+        }
 
         if (_levelLabel)
         {
             _levelLabel->setString(StringUtils::format("WAVE %d", waveNumber));
 
-            // ӵ뵭Ч
+            // 添加淡入淡出效果
             auto fadeOut = FadeOut::create(0.3f);
             auto fadeIn = FadeIn::create(0.3f);
             _levelLabel->runAction(Sequence::create(fadeOut, fadeIn, nullptr));
         }
 
-        // Ų_ʼЧ
+        // 播放波次開始音效
         auto audioManager = AudioManager::getInstance();
         if (audioManager)
         {
-            audioManager->playSoundEffect("Sounds/SFX/wave_start.mp3");
+            audioManager->playSoundEffect(PVZ_ASSET_ID("sound_wave_start"));
         }
         });
 
     _waveManager->setWaveCompletedCallback([this](int waveNumber) {
-        log("GameScene: Wave %d completed", waveNumber);
-
-        // Ҫʬ WaveManager Լ
-        // ֱӳٺʼһ
-        this->runAction(Sequence::create(
-            DelayTime::create(3.0f),
-            CallFunc::create([this]() {
-                if (_waveManager) {
-                    // Ƿиನ
-                    if (_waveManager->getCurrentWave() < _waveManager->getTotalWaves()) {
-                        log("GameScene: Starting next wave...");
-                        _waveManager->startNextWave();
-                    }
-                    else {
-                        log("GameScene: All waves completed!");
-                        // ʤ
-                        auto gameManager = GameManager::getInstance();
-                        if (gameManager) {
-                            gameManager->gameOver(true);
-                        }
-                    }
-                }
-                }),
-            nullptr
-        ));
+        PVZ_LOGI(LogCategory::GAME, "GameScene: Wave %d completed", waveNumber);
+
+        // 不要在这里清理僵尸，让 WaveManager 自己管理
+        // 延迟后开始下一波（按逻辑时间倒计时，倍速时同步加快）
+        _nextWaveTimer = GameTuning::WAVE_DELAY;
         });
 
     _waveManager->setWaveAllCompletedCallback([this]() {
-        log("GameScene: All waves completed!");
+        PVZ_LOGI(LogCategory::GAME, "GameScene: All waves completed!");
 
-        // ӳٺ󴥷ʤ
-        this->runAction(Sequence::create(
-            DelayTime::create(2.0f),
-            CallFunc::create([this]() {
-                auto gameManager = GameManager::getInstance();
-                if (gameManager) {
-                    gameManager->gameOver(true);
-                }
-                }),
-            nullptr
-        ));
+        // 延迟后触发胜利（按逻辑时间倒计时）
+        scheduleResult(true);
         });
 
     _waveManager->setGameOverCallback([this]() {
-        log("GameScene: Game Over!");
+        PVZ_LOGI(LogCategory::GAME, "GameScene: Game Over!");
 
-        // t 2 @ʾʧ
-        this->runAction(Sequence::create(
-            DelayTime::create(2.0f),
-            CallFunc::create([this]() {
-                auto gameManager = GameManager::getInstance();
-                if (gameManager)
-                {
-                    gameManager->gameOver(false);
-                }
-                }),
-            nullptr
-        ));
+        // 延遲 2 秒後顯示失敗（按逻辑时间倒计时）
+        scheduleResult(false);
         });
 
-    // 5. ӵһt 3 _ʼ
-    this->runAction(Sequence::create(
-        DelayTime::create(5.0f),
-        CallFunc::create([this]() {
-            log("=== Starting first wave ===");
-            if (_waveManager) {
-                _waveManager->startNextWave(); // _ʼһ
-            }
-            }),
-        nullptr
-    ));
+    // 5. 第一波由WaveManager的准备阶段倒计时开始（GameTuning::PREPARATION_TIME，与无头模拟一致）
+    _nextWaveTimer = 0.0f;
 
-    log("GameScene: Zombie system initialized successfully");
+    PVZ_LOGI(LogCategory::GAME, "GameScene: Zombie system initialized successfully");
 }
 
 void GameScene::update(float delta)
 {
-    // ֻ PLAYING B[߉݋
+    PVZ_PROFILE_ZONE("GameScene::update");
+
+    // 只在 PLAYING 狀態更新遊戲邏輯
     auto gameManager = GameManager::getInstance();
+    if (gameManager && gameManager->getCurrentState() == GameManager::GameState::GAME_OVER)
+    {
+        // 结算后停在当前画面，按逻辑时间倒计时返回菜单
+        _clock.beginFrame(delta);
+        while (_menuTimer > 0.0f && _clock.consumeStep())
+        {
+            _menuTimer -= _clock.getStep();
+            if (_menuTimer <= 0.0f)
+            {
+                gameManager->goToMenuScene();
+            }
+        }
+        return;
+    }
     if (gameManager && gameManager->getCurrentState() != GameManager::GameState::PLAYING)
     {
         return;
     }
 
-    // ֲ￨ƠB
-    updatePlantCards();
+    // 固定步长推进逻辑，倍速时每帧多跑几步
+    uint64_t simStart = FrameProfiler::now();
+    restoreSimPositions();
+    _clock.beginFrame(delta);
+    while (_clock.consumeStep())
+    {
+        saveSimPositions();
+        tickGame(_clock.getStep());
+
+        // 本步内游戏结束（胜利/失败）时不再继续推进
+        if (gameManager && gameManager->getCurrentState() != GameManager::GameState::PLAYING)
+        {
+            break;
+        }
+    }
+    applyRenderInterpolation(_clock.getAlpha());
+    updateTints(_clock.getStepsThisFrame() * _clock.getStep());
+
+    if (_perfOverlay)
+    {
+        _perfOverlay->recordSimTime(FrameProfiler::now() - simStart, _clock.getStepsThisFrame());
+    }
+}
+
+void GameScene::tickGame(float delta)
+{
+    PVZ_PROFILE_ZONE("GameScene::tickGame");
+
+    updateSpawnPhase(delta);
+    updateMovePhase(delta);
+    updateTargetPhase();
+    updateFirePhase(delta);
+    updateCollidePhase();
+    updateDamagePhase(delta);
+    updateCleanupPhase();
+    updateTimers(delta);
+}
+
+void GameScene::updateTimers(float delta)
+{
+    for (auto card : _plantCards)
+    {
+        if (card && card->isCoolingDown())
+        {
+            card->updateCooldown(delta);
+        }
+    }
+
+    if (_resultTimer > 0.0f)
+    {
+        _resultTimer -= delta;
+        if (_resultTimer <= 0.0f)
+        {
+            _resultTimer = 0.0f;
+            auto gameManager = GameManager::getInstance();
+            if (gameManager)
+            {
+                gameManager->gameOver(_resultIsWin);
+            }
+        }
+    }
+}
+
+void GameScene::scheduleResult(bool isWin)
+{
+    // 已经在倒计时（例如最后一波刚清完时僵尸到达终点）时以先到的结果为准
+    if (_resultTimer > 0.0f)
+    {
+        return;
+    }
+    _resultTimer = RESULT_DELAY;
+    _resultIsWin = isWin;
+}
+
+void GameScene::updateSpawnPhase(float delta)
+{
+    PVZ_PROFILE_ZONE("Phase::spawn");
 
-    // ꖹ┵
-    updateSunDisplay();
+    // 波次推进、僵尸生成（同时整理僵尸行索引）
+    if (_waveManager)
+    {
+        _waveManager->update(delta);
+    }
 
-    // 
+    // 波次之间的延迟
+    if (_nextWaveTimer > 0.0f)
+    {
+        _nextWaveTimer -= delta;
+        if (_nextWaveTimer <= 0.0f)
+        {
+            _nextWaveTimer = 0.0f;
+            startNextWave();
+        }
+    }
+
+    // 更新随机阳光
     updateRandomSuns(delta);
 
-    // ֲΪ - ʹðȫĵ
-    auto it = _plants.begin(); int i = 0;
+    // 阳光下落、浮动、超时
+    SunManager::getInstance()->update(delta);
+}
+
+void GameScene::startNextWave()
+{
+    if (!_waveManager)
+    {
+        return;
+    }
+
+    // 检查是否还有更多波次
+    if (_waveManager->getCurrentWave() < _waveManager->getTotalWaves())
+    {
+        PVZ_LOGI(LogCategory::GAME, "GameScene: Starting wave %d...", _waveManager->getCurrentWave() + 1);
+        _waveManager->startNextWave();
+    }
+    else
+    {
+        PVZ_LOGI(LogCategory::GAME, "GameScene: All waves completed!");
+        // 触发胜利条件
+        auto gameManager = GameManager::getInstance();
+        if (gameManager)
+        {
+            gameManager->gameOver(true);
+        }
+    }
+}
+
+void GameScene::updateMovePhase(float delta)
+{
+    PVZ_PROFILE_ZONE("Phase::move");
+
+    // 僵尸移动：按行遍历，到达终点的僵尸只会在行索引中置空，不影响遍历
+    if (_waveManager)
+    {
+        PVZ_PROFILE_ZONE("Zombie::updateMove");
+        for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+        {
+            for (auto zombie : _waveManager->getZombiesInRow(row))
+            {
+                if (zombie && zombie->isAlive())
+                {
+                    zombie->updateMove(delta);
+                }
+            }
+        }
+    }
+
+    // 子彈飛行
+    auto gameManager = GameManager::getInstance();
+    if (gameManager)
+    {
+        gameManager->updateProjectiles(delta);
+    }
+}
+
+void GameScene::updateTargetPhase()
+{
+    PVZ_PROFILE_ZONE("Phase::target");
+
+    // 僵尸寻找前方的植物
+    if (_waveManager)
+    {
+        for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+        {
+            for (auto zombie : _waveManager->getZombiesInRow(row))
+            {
+                if (zombie && zombie->isAlive())
+                {
+                    zombie->updateTarget();
+                }
+            }
+        }
+    }
+}
+
+void GameScene::updateFirePhase(float delta)
+{
+    PVZ_PROFILE_ZONE("Phase::fire");
+
+    // 植物攻击/生产计时，射手在这里发射子弹
+    for (auto plant : _plants)
+    {
+        if (plant && plant->isAlive())
+        {
+            plant->update(delta);
+        }
+    }
+}
+
+void GameScene::updateCollidePhase()
+{
+    PVZ_PROFILE_ZONE("Phase::collide");
+
+    auto gameManager = GameManager::getInstance();
+    if (gameManager)
+    {
+        gameManager->resolveProjectileCollisions();
+    }
+}
+
+void GameScene::updateDamagePhase(float delta)
+{
+    PVZ_PROFILE_ZONE("Phase::damage");
+
+    // 僵尸啃食植物
+    if (_waveManager)
+    {
+        for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+        {
+            for (auto zombie : _waveManager->getZombiesInRow(row))
+            {
+                if (zombie && zombie->isAlive())
+                {
+                    zombie->updateAttack(delta);
+                }
+            }
+        }
+    }
+}
+
+void GameScene::updateCleanupPhase()
+{
+    PVZ_PROFILE_ZONE("Phase::cleanup");
+
+    // 移除死亡的植物 - 使用安全的迭代器
+    auto it = _plants.begin();
     while (it != _plants.end())
     {
         if (!*it) {
             it = _plants.erase(it);
             continue;
         }
-            
-        Plant* plant = *it; i++;
-        //log("Plants: %d Check plant %s at %d row %d col",i, (*it)->getName(),(*it)->getRow(), (*it)->getRow());
-        if (plant && plant->isAlive())  // ֲǷȻڳ
+
+        Plant* plant = *it;
+        if (plant->isAlive())
         {
-            plant->update(delta);
             ++it;
         }
         else
         {
-            // ֲѱƳбɾ
-            log("Remove plant at %d row %d col", (*it)->getRow(), (*it)->getCol());
+            // 植物已被移除，从列表中删除
+            PVZ_LOGD(LogCategory::GAME, "Remove plant at %d row %d col", plant->getRow(), plant->getCol());
             auto gridsystem = GridSystem::getInstance();
-            gridsystem->removePlant((*it)->getRow(), (*it)->getCol());
+            gridsystem->removePlant(plant->getRow(), plant->getCol());
             plant->removeFromParent();
             it = _plants.erase(it);
+        }
+    }
+
+    // 移除已销毁的子彈
+    auto gameManager = GameManager::getInstance();
+    if (gameManager)
+    {
+        gameManager->cleanupProjectiles();
+    }
+}
 
+void GameScene::restoreSimPositions()
+{
+    if (_waveManager)
+    {
+        for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+        {
+            for (auto zombie : _waveManager->getZombiesInRow(row))
+            {
+                if (zombie)
+                {
+                    zombie->restoreSimPosition();
+                }
+            }
         }
     }
 
-    // ӏ
+    auto gameManager = GameManager::getInstance();
     if (gameManager)
     {
-        gameManager->updateProjectiles(delta);
+        for (auto projectile : gameManager->getProjectiles())
+        {
+            if (projectile)
+            {
+                projectile->restoreSimPosition();
+            }
+        }
     }
+}
 
-    //  WaveManager
+void GameScene::saveSimPositions()
+{
     if (_waveManager)
     {
-        _waveManager->update(delta);
+        for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+        {
+            for (auto zombie : _waveManager->getZombiesInRow(row))
+            {
+                if (zombie)
+                {
+                    zombie->saveSimPosition();
+                }
+            }
+        }
+    }
+
+    auto gameManager = GameManager::getInstance();
+    if (gameManager)
+    {
+        for (auto projectile : gameManager->getProjectiles())
+        {
+            if (projectile)
+            {
+                projectile->saveSimPosition();
+            }
+        }
+    }
+}
+
+void GameScene::applyRenderInterpolation(float alpha)
+{
+    if (_waveManager)
+    {
+        for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+        {
+            for (auto zombie : _waveManager->getZombiesInRow(row))
+            {
+                if (zombie)
+                {
+                    zombie->applyRenderInterpolation(alpha);
+                }
+            }
+        }
+    }
+
+    auto gameManager = GameManager::getInstance();
+    if (gameManager)
+    {
+        for (auto projectile : gameManager->getProjectiles())
+        {
+            if (projectile && projectile->isAlive())
+            {
+                projectile->applyRenderInterpolation(alpha);
+            }
+        }
+    }
+}
+
+void GameScene::updateTints(float delta)
+{
+    PVZ_PROFILE_ZONE("GameScene::updateTints");
+
+    if (_waveManager)
+    {
+        for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+        {
+            for (auto zombie : _waveManager->getZombiesInRow(row))
+            {
+                if (zombie)
+                {
+                    zombie->updateTint(delta);
+                }
+            }
+        }
+    }
+
+    for (auto plant : _plants)
+    {
+        if (plant)
+        {
+            plant->updateTint(delta);
+        }
     }
 }
 
@@ -372,7 +704,7 @@ void GameScene::initUI()
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 origin = Director::getInstance()->getVisibleOrigin();
 
-    // Ϸ
+    // 游戏标题
     auto titleLabel = Label::createWithTTF("WAVE 0", "fonts/Marker Felt.ttf", 24);
     titleLabel->setPosition(Vec2(visibleSize.width / 2 + origin.x+200, visibleSize.height - 30 + origin.y));
     titleLabel->setColor(Color3B::YELLOW);
@@ -380,7 +712,7 @@ void GameScene::initUI()
     this->addChild(titleLabel, 10);
     _levelLabel = titleLabel;
 
-    // 
+    // 创建卡牌栏背景
     _cardBarBackground = Sprite::create(
         ResourceLoader::getInstance()->getTexture("card_bar_bg") ?
         ResourceLoader::getInstance()->getTexture("card_bar_bg")->getPath() :
@@ -388,20 +720,20 @@ void GameScene::initUI()
     );
 
     if (_cardBarBackground) {
-        // ĻϽ
+        // 将背景放在屏幕左上角
         _cardBarBackground->setAnchorPoint(Vec2(0, 1));
         _cardBarBackground->setPosition(Vec2(origin.x, origin.y + visibleSize.height));
         //this->addChild(_cardBarBackground, 0);
 
         
-        // СͿ
+        // 调整大小以容纳阳光数量和卡牌
         _cardBarBackground->setScaleX(1.2f);
         _cardBarBackground->setScaleY(1.2f);
         this->addChild(_cardBarBackground, 0);
         
     }
 
-    // ʾ
+    // 阳光显示
     _sunLabel = Label::createWithTTF("50", "fonts/Marker Felt.ttf", 24);
     _sunLabel->setPosition(Vec2(115 + origin.x, visibleSize.height - 85 + origin.y));
     _sunLabel->setColor(Color3B::YELLOW);
@@ -409,19 +741,19 @@ void GameScene::initUI()
     this->addChild(_sunLabel, 10);
 
     /*
-    // ͼ
+    // 阳光图标
     auto sunIcon = Sprite::create();
     sunIcon->setTextureRect(Rect(0, 0, 30, 30));
     sunIcon->setColor(Color3B(255, 255, 0));
     sunIcon->setPosition(Vec2(30 + origin.x, visibleSize.height - 40 + origin.y));
     this->addChild(sunIcon, 10);
 
-    // ͼ궯
+    // 阳光图标动画
     auto rotateAction = RepeatForever::create(RotateBy::create(2.0f, 360));
     sunIcon->runAction(rotateAction);
     */
 
-    // ͣť
+    // 暂停按钮
     _pauseButton = ui::Button::create();
     _pauseButton->setTitleText("Pause");
     _pauseButton->setTitleFontName("fonts/Marker Felt.ttf");
@@ -435,7 +767,7 @@ void GameScene::initUI()
     _pauseButton->addTouchEventListener(CC_CALLBACK_2(GameScene::onPauseButtonClicked, this));
     this->addChild(_pauseButton, 10);
 
-    // ز˵ť
+    // 返回菜单按钮
     auto backButton = ui::Button::create();
     backButton->setTitleText("Menu");
     backButton->setTitleFontName("fonts/Marker Felt.ttf");
@@ -449,8 +781,22 @@ void GameScene::initUI()
     backButton->addTouchEventListener(CC_CALLBACK_2(GameScene::onBackButtonClicked, this));
     this->addChild(backButton, 10);
 
+    // 倍速按钮：1x -> 2x -> 4x -> 16x -> MAX 循环
+    _speedButton = ui::Button::create();
+    _speedButton->setTitleText(FixedStepClock::getSpeedName(_clock.getSpeed()));
+    _speedButton->setTitleFontName("fonts/Marker Felt.ttf");
+    _speedButton->setTitleFontSize(20);
+    _speedButton->setTitleColor(Color3B::WHITE);
+    _speedButton->setContentSize(Size(80, 40));
+    _speedButton->setScale9Enabled(true);
+    _speedButton->setCapInsets(Rect(5, 5, 5, 5));
+    _speedButton->setColor(Color3B(100, 200, 100));
+    _speedButton->setPosition(Vec2(visibleSize.width - 230 + origin.x, visibleSize.height - 30 + origin.y));
+    _speedButton->addTouchEventListener(CC_CALLBACK_2(GameScene::onSpeedButtonClicked, this));
+    this->addChild(_speedButton, 10);
+
     /*
-    // ӲƺӾǿ
+    // 添加草坪纹理（视觉增强）
     for (int i = 0; i < 8; i++)
     {
         for (int j = 0; j < 5; j++)
@@ -469,7 +815,7 @@ void GameScene::initUI()
     */
 
     /*
-    // Ӝyԇo
+    // 添加測試按鈕
     auto testButton = ui::Button::create();
     testButton->setTitleText("TEST: Spawn Zombie");
     testButton->setTitleFontName("fonts/Marker Felt.ttf");
@@ -483,21 +829,21 @@ void GameScene::initUI()
     testButton->addTouchEventListener([this](Ref* sender, ui::Widget::TouchEventType type) {
         if (type == ui::Widget::TouchEventType::ENDED)
         {
-            log("=== MANUAL ZOMBIE SPAWN TEST ===");
+            PVZ_LOGD(LogCategory::GAME, "=== MANUAL ZOMBIE SPAWN TEST ===");
 
-            // քһ
+            // 手動生成一個殭屍
             auto waveManager = WaveManager::getInstance();
             if (waveManager) {
                 Zombie* zombie = waveManager->spawnRandomZombie();
                 if (zombie) {
-                    log("Manual spawn SUCCESS!");
+                    PVZ_LOGD(LogCategory::GAME, "Manual spawn SUCCESS!");
                 }
                 else {
-                    log("Manual spawn FAILED!");
+                    PVZ_LOGE(LogCategory::GAME, "Manual spawn FAILED!");
                 }
             }
             else {
-                log("ERROR: WaveManager is null!");
+                PVZ_LOGE(LogCategory::GAME, "WaveManager is null!");
             }
         }
         });
@@ -510,16 +856,18 @@ void GameScene::initGrid()
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 origin = Director::getInstance()->getVisibleOrigin();
 
-    // ʼϵͳ59Уÿ90x130
+    // 初始化网格系统：5行9列，每格90x130像素（与无头模拟共用GameTuning）
     auto gridSystem = GridSystem::getInstance();
-    gridSystem->init(5, 9, Size(90, 130), Vec2(145 + origin.x, 25 + origin.y));
+    gridSystem->init(GameTuning::GRID_ROWS, GameTuning::GRID_COLS,
+        Size(GameTuning::CELL_WIDTH, GameTuning::CELL_HEIGHT),
+        Vec2(GameTuning::GRID_ORIGIN_X + origin.x, GameTuning::GRID_ORIGIN_Y + origin.y));
 
-    // ص
+    // 设置网格点击回调
     gridSystem->setClickCallback([this](int row, int col, const Vec2& worldPos) {
         this->onGridClicked(row, col, worldPos);
         });
 
-    // Ƶ񣨿ʱʹãʱע͵
+    // 绘制调试网格（开发时使用，发布时可注释掉）
     gridSystem->drawDebugGrid(this);
 }
 
@@ -528,7 +876,7 @@ void GameScene::initPlantCards()
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 origin = Director::getInstance()->getVisibleOrigin();
 
-    // ֲ￨
+    // 植物卡牌类型
     std::vector<PlantType> plantTypes = {
         PlantType::SUNFLOWER,
         PlantType::PEASHOOTER,
@@ -538,11 +886,11 @@ void GameScene::initPlantCards()
         PlantType::POTATO_MINE,
     };
 
-    // ֲ￨
-     // ʼλãǩҲ
+    // 创建植物卡牌
+     // 计算起始位置：阳光数量标签的右侧
     float startX = _sunLabel->getPosition().x + _sunLabel->getContentSize().width + 50;
     float cardY = _sunLabel->getPosition().y + 30;
-    float cardSpacing = 60; // Ƽ
+    float cardSpacing = 60; // 卡牌间距
 
     for (size_t i = 0; i < plantTypes.size(); i++)
     {
@@ -553,7 +901,13 @@ void GameScene::initPlantCards()
             this->addChild(card, 5);
             _plantCards.push_back(card);
 
-            // ÿƵ¼
+            // 冷却开始/结束时按当前阳光刷新卡牌（卡牌随场景销毁，不需要退订）
+            card->getCooldownObservable().subscribe([card](const bool&) {
+                auto gameManager = GameManager::getInstance();
+                card->updateCardState(gameManager ? gameManager->getSunCount() : 0);
+                }, false);
+
+            // 设置卡牌点击事件
             card->addTouchEventListener([this, plantType = plantTypes[i]](Ref* sender, ui::Widget::TouchEventType type) {
                 if (type == ui::Widget::TouchEventType::ENDED)
                 {
@@ -562,16 +916,14 @@ void GameScene::initPlantCards()
             });
         }
     }
-
-    updatePlantCards();
 }
 
 void GameScene::initTouchHandlers()
 {
-    // ¼PCƽ̨
+    // 创建鼠标事件监听器（PC平台）
     auto mouseListener = EventListenerMouse::create();
 
-    // ƶ¼ - ׷λ
+    // 鼠标移动事件处理 - 追踪鼠标位置
     mouseListener->onMouseMove = [this](EventMouse* event) {
         if (_hasSelectedPlant && _plantPreview)
         {
@@ -580,12 +932,12 @@ void GameScene::initTouchHandlers()
         }
     };
 
-    // 갴¼
+    // 鼠标按下事件处理
     mouseListener->onMouseDown = [this](EventMouse* event) {
         if (event->getMouseButton() == EventMouse::MouseButton::BUTTON_LEFT) {
             Vec2 mousePos(event->getCursorX(), event->getCursorY());
 
-            // Ƿֲ￨ƣɿ
+            // 检查是否点击了植物卡牌（由卡牌自身处理）
             bool clickedOnCard = false;
             for (auto card : _plantCards) {
                 if (card && card->getBoundingBox().containsPoint(mousePos)) {
@@ -594,12 +946,12 @@ void GameScene::initTouchHandlers()
                 }
             }
 
-            // ûеƣ
+            // 如果没有点击卡牌，处理网格点击
             if (!clickedOnCard) {
                 auto gridSystem = GridSystem::getInstance();
                 gridSystem->handleTouch(mousePos);
 
-                // ѡֲȡѡ
+                // 如果正在选择植物，点击后取消选择
                 if (_hasSelectedPlant)
                 {
                     hidePlantPreview();
@@ -609,35 +961,43 @@ void GameScene::initTouchHandlers()
         }
     };
 
-    // ¼
+    // 添加事件监听器
     _eventDispatcher->addEventListenerWithSceneGraphPriority(mouseListener, this);
+
+    // 阳光收集：整个场景只注册一个触摸监听器，由SunManager做命中检测
+    auto sunListener = EventListenerTouchOneByOne::create();
+    sunListener->setSwallowTouches(true);
+    sunListener->onTouchBegan = [](Touch* touch, Event* event) {
+        return SunManager::getInstance()->handleTouch(touch->getLocation());
+    };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(sunListener, this);
+
+    // F7切换性能面板
+    auto keyListener = EventListenerKeyboard::create();
+    keyListener->onKeyReleased = [this](EventKeyboard::KeyCode keyCode, Event* event) {
+        if (keyCode == EventKeyboard::KeyCode::KEY_F7 && _perfOverlay)
+        {
+            _perfOverlay->toggle();
+        }
+    };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(keyListener, this);
 }
 
-void GameScene::updateSunDisplay()
+void GameScene::updateSunDisplay(int sunCount)
 {
-    auto gameManager = GameManager::getInstance();
-    if (gameManager && _sunLabel)
+    if (_sunLabel)
     {
-        int sunCount = gameManager->getSunCount();
         _sunLabel->setString(StringUtils::toString(sunCount));
     }
 }
 
-void GameScene::updatePlantCards()
+void GameScene::updatePlantCards(int sunCount)
 {
-    auto gameManager = GameManager::getInstance();
-    if (!gameManager)
-    {
-        return;
-    }
-
-    int currentSun = gameManager->getSunCount();
-
     for (auto card : _plantCards)
     {
         if (card)
         {
-            card->updateCardState(currentSun);
+            card->updateCardState(sunCount);
         }
     }
 }
@@ -650,31 +1010,31 @@ void GameScene::onPlantCardSelected(PlantType plantType)
         return;
     }
 
-    // Ƿ㹻
+    // 检查阳光是否足够
     int sunCost = PlantFactory::getSunCost(plantType);
     if (gameManager->getSunCount() < sunCost)
     {
-        log("GameScene: Not enough sun to select plant");
+        PVZ_LOGD(LogCategory::GAME, "GameScene: Not enough sun to select plant");
         return;
     }
-    //ȴ
+    //检查冷却
     for (auto card : _plantCards)
     {
         if (card->getPlantType()==plantType)
         {
             if (card->isCoolingDown()) {
-                log("GameScene: Selected plant is cooling");
+                PVZ_LOGD(LogCategory::GAME, "GameScene: Selected plant is cooling");
                 return;
             }
             else {
-                // ѡеֲ
+                // 设置选中的植物类型
                 _selectedPlantType = plantType;
                 _hasSelectedPlant = true;
 
-                // ʾֲԤ
+                // 显示植物预览
                 showPlantPreview(plantType, card->getPosition());
 
-                log("GameScene: Selected plant type %d", (int)plantType);
+                PVZ_LOGD(LogCategory::GAME, "GameScene: Selected plant type %d", (int)plantType);
             }
         }
     }
@@ -682,9 +1042,9 @@ void GameScene::onPlantCardSelected(PlantType plantType)
 
 void GameScene::onGridClicked(int row, int col, const Vec2& worldPos)
 {
-    log("GameScene: Grid clicked at row %d, col %d", row, col);
+    PVZ_LOGT(LogCategory::GAME, "GameScene: Grid clicked at row %d, col %d", row, col);
 
-    // ѡֲԷֲ
+    // 如果正在选择植物，则尝试放置植物
     if (_hasSelectedPlant)
     {
         placePlant(_selectedPlantType, row, col);
@@ -702,6 +1062,19 @@ void GameScene::onPauseButtonClicked(Ref* sender, ui::Widget::TouchEventType typ
     }
 }
 
+void GameScene::onSpeedButtonClicked(Ref* sender, ui::Widget::TouchEventType type)
+{
+    if (type == ui::Widget::TouchEventType::ENDED)
+    {
+        _clock.setSpeed(FixedStepClock::getNextSpeed(_clock.getSpeed()));
+        if (_speedButton)
+        {
+            _speedButton->setTitleText(FixedStepClock::getSpeedName(_clock.getSpeed()));
+        }
+        PVZ_LOGI(LogCategory::GAME, "GameScene: Speed %s", FixedStepClock::getSpeedName(_clock.getSpeed()));
+    }
+}
+
 void GameScene::onBackButtonClicked(Ref* sender, ui::Widget::TouchEventType type)
 {
     if (type == ui::Widget::TouchEventType::ENDED)
@@ -720,107 +1093,102 @@ void GameScene::placePlant(PlantType plantType, int row, int col)
         return;
     }
 
-    // Ƿ
+    // 检查格子是否可用
     if (!gridSystem->canPlantAt(row, col))
     {
-        // ŴЧ
+        // 播放错误音效
         auto audioManager = AudioManager::getInstance();
         if (audioManager)
         {
-            audioManager->playSoundEffect("Sounds/SFX/plant_fail.mp3");
+            audioManager->playSoundEffect(PVZ_ASSET_ID("sound_plant_fail"));
         }
 
-        log("GameScene: Cannot plant at row %d, col %d", row, col);
+        PVZ_LOGD(LogCategory::GAME, "GameScene: Cannot plant at row %d, col %d", row, col);
         return;
     }
 
-    // ֲȴ
+    // 检查植物冷却
     for (auto plantcard : _plantCards) {
         if (_selectedPlantType == plantcard->getPlantType()) {
             if (plantcard->isCoolingDown()) {
-                log("GameScene: Plant is cooling");
+                PVZ_LOGD(LogCategory::GAME, "GameScene: Plant is cooling");
                 return;
             }
         }
     }
 
-    // Ƿ㹻
+    // 检查阳光是否足够
     int sunCost = PlantFactory::getSunCost(plantType);
     if (!gameManager->spendSun(sunCost))
     {
-        log("GameScene: Not enough sun to plant");
+        PVZ_LOGD(LogCategory::GAME, "GameScene: Not enough sun to plant");
         return;
     }
 
-    // ֲ - ȷʹԶͷ
+    // 创建植物 - 确保使用自动释放
     Plant* plant = PlantFactory::createPlant(plantType);
     if (!plant)
     {
-        log("GameScene: Failed to create plant");
+        PVZ_LOGE(LogCategory::GAME, "GameScene: Failed to create plant");
         return;
     }
 
-    // ֲλ
+    // 设置植物位置
     Vec2 plantPos = gridSystem->gridToWorldCenter(row, col);
     plant->setPosition(plantPos);
     plant->setGridPosition(row, col);
 
-    // ӵ - ʹ addChildCocos2d-x Զڴ
-    this->addChild(plant, 3);
+    // 挂到所在行的植物层 - Cocos2d-x 会自动管理内存
+    _entityLayers->place(plant, EntityLayer::PLANT, row);
 
-    // ӵϵͳ
+    // 添加到网格系统
     gridSystem->plantAt(plant, row, col);
 
-    // ӵֲб - Ҫ retainΪڵѾ
+    // 添加到植物列表 - 不要 retain，因为父节点已经持有引用
     _plants.push_back(plant);
 
-    // ֲЧ
-    AudioManager::getInstance()->playSoundEffect(
-        ResourceLoader::getInstance()->getSoundEffectPath("sound_plant_planted")
-    );
-
-    // ʾ
-    updateSunDisplay();
+    // 播放种植音效
+    AudioManager::getInstance()->playSoundEffect(PVZ_ASSET_ID("sound_plant_planted"));
 
-    // ʼȴ
+    // 开始冷却
     for (auto plantcard : _plantCards) {
         if (_selectedPlantType == plantcard->getPlantType())
             plantcard->startCooldown();
     }
 
-    // ֲ Tofix
+    // 种植动画 Tofix
     /*
     plant->setScale(0.1f);
     auto scaleAction = ScaleTo::create(0.3f, 1.0f);
     plant->runAction(scaleAction);
     */
-    log("GameScene: Plant placed at row %d, col %d", row, col);
+    PVZ_LOGD(LogCategory::GAME, "GameScene: Plant placed at row %d, col %d", row, col);
 }
 
 void GameScene::showPlantPreview(PlantType plantType, const Vec2& position)
 {
-    // ԤƳ
+    // 如果已有预览，先移除
     hidePlantPreview();
 
-    // Ԥֲ
+    // 创建预览植物
     _plantPreview = PlantFactory::createPlant(plantType);
     if (!_plantPreview)
     {
         return;
     }
 
-    // ʹôλã굱ǰλã
+    // 使用传入的位置（鼠标当前位置）
     _plantPreview->setPosition(position);
-    _plantPreview->setOpacity(150); // ͸
+    _plantPreview->setOpacity(150); // 半透明
     _plantPreview->unscheduleUpdate();
 
-    // ӵ - ʹ addChildCocos2d-x Զڴ
+    // 添加到场景 - 使用 addChild，Cocos2d-x 会自动管理内存
     this->addChild(_plantPreview, 4);
 
-    // һԤλúɫ
+    // 立即更新一次预览位置和颜色
     updatePlantPreviewPosition(position);
 
-    log("GameScene: Plant preview shown");
+    PVZ_LOGD(LogCategory::GAME, "GameScene: Plant preview shown");
 }
 
 void GameScene::hidePlantPreview()
@@ -836,15 +1204,15 @@ void GameScene::updatePlantPreviewPosition(const Vec2& position)
 {
     if (_plantPreview)
     {
-        // ֱλã꣩
+        // 直接设置位置（跟随鼠标）
         _plantPreview->setPosition(position);
 
-        // 鵱ǰλǷԷ
+        // 检查当前位置是否可以放置
         int row, col;
         auto gridSystem = GridSystem::getInstance();
         if (gridSystem && gridSystem->worldToGrid(position, row, col))
         {
-            // ֲȴ
+            // 检查植物冷却
             bool isCooling = false;
             for (auto plantcard : _plantCards) {
                 if (_selectedPlantType == plantcard->getPlantType()) {
@@ -857,16 +1225,16 @@ void GameScene::updatePlantPreviewPosition(const Vec2& position)
 
             if (gridSystem->canPlantAt(row, col) && !isCooling)
             {
-                _plantPreview->setColor(Color3B::WHITE); // Էãɫ
+                _plantPreview->setColor(Color3B::WHITE); // 可以放置：白色
             }
             else
             {
-                _plantPreview->setColor(Color3B::RED);   // ܷãɫ
+                _plantPreview->setColor(Color3B::RED);   // 不能放置：红色
             }
         }
         else
         {
-            // ڣʾΪɫ
+            // 如果不在网格内，显示为红色
             _plantPreview->setColor(Color3B::RED);
         }
     }
@@ -878,7 +1246,6 @@ void GameScene::addSun(int amount)
     if (gameManager)
     {
         gameManager->addSun(amount);
-        updateSunDisplay();
     }
 }
 
@@ -888,7 +1255,6 @@ void GameScene::spendSun(int amount)
     if (gameManager)
     {
         gameManager->spendSun(amount);
-        updateSunDisplay();
     }
 }
 
@@ -902,7 +1268,7 @@ void GameScene::pauseGame()
         audioManager->pauseBackgroundMusic();
     }
 
-    log("GameScene: Game paused");
+    PVZ_LOGI(LogCategory::GAME, "GameScene: Game paused");
 }
 
 void GameScene::resumeGame()
@@ -915,7 +1281,7 @@ void GameScene::resumeGame()
         audioManager->resumeBackgroundMusic();
     }
 
-    log("GameScene: Game resumed");
+    PVZ_LOGI(LogCategory::GAME, "GameScene: Game resumed");
 }
 
 void GameScene::showPauseMenu()
@@ -923,29 +1289,29 @@ void GameScene::showPauseMenu()
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 origin = Director::getInstance()->getVisibleOrigin();
 
-    // ͸ǲ
+    // 创建半透明覆盖层
     auto overlay = LayerColor::create(Color4B(0, 0, 0, 150), visibleSize.width, visibleSize.height);
     overlay->setPosition(origin);
     overlay->setTag(100);
     this->addChild(overlay, 100);
 
-    // ͣ˵壨ԭʼ룩
+    // 创建暂停菜单面板（保持原始代码）
     auto panel = ui::Button::create();
     panel->setContentSize(Size(300, 200));
     panel->setScale9Enabled(true);
     panel->setCapInsets(Rect(10, 10, 10, 10));
     panel->setColor(Color3B(50, 50, 100));
     panel->setPosition(Vec2(visibleSize.width / 2 + origin.x, visibleSize.height / 2 + origin.y));
-    panel->setEnabled(true); // Ϊ¼
+    panel->setEnabled(true); // 作为背景，不接收事件
     overlay->addChild(panel);
 
-    // ͣ
+    // 暂停标题
     auto pauseLabel = Label::createWithTTF("PAUSED", "fonts/Marker Felt.ttf", 36);
     pauseLabel->setPosition(Vec2(panel->getContentSize().width / 2, 150));
     pauseLabel->setColor(Color3B::YELLOW);
     panel->addChild(pauseLabel);
 
-    // ť - ȷ¼Դ
+    // 继续按钮 - 确保事件可以传递
     auto resumeButton = ui::Button::create();
     resumeButton->setTitleText("Resume");
     resumeButton->setTitleFontName("fonts/Marker Felt.ttf");
@@ -957,23 +1323,23 @@ void GameScene::showPauseMenu()
     resumeButton->setColor(Color3B(100, 200, 100));
     resumeButton->setPosition(Vec2(panel->getContentSize().width / 2, 100));
 
-    // ؼȷťԽմ¼
+    // 关键：确保按钮可以接收触摸事件
     resumeButton->setTouchEnabled(true);
     resumeButton->setEnabled(true);
-    resumeButton->setSwallowTouches(true); // ֹ¼ݵڵ
+    resumeButton->setSwallowTouches(true); // 阻止事件传递到父节点
 
     resumeButton->addTouchEventListener([this](Ref* sender, ui::Widget::TouchEventType type) {
-        log("GameScene: Resume button event type: %d", (int)type);
+        PVZ_LOGT(LogCategory::GAME, "GameScene: Resume button event type: %d", (int)type);
         if (type == ui::Widget::TouchEventType::ENDED)
         {
-            log("GameScene: Resume button clicked");
+            PVZ_LOGD(LogCategory::GAME, "GameScene: Resume button clicked");
             hidePauseMenu();
             resumeGame();
         }
         });
     panel->addChild(resumeButton);
 
-    // ¿ʼť - ȷ¼Դ
+    // 重新开始按钮 - 确保事件可以传递
     auto restartButton = ui::Button::create();
     restartButton->setTitleText("Restart");
     restartButton->setTitleFontName("fonts/Marker Felt.ttf");
@@ -985,40 +1351,40 @@ void GameScene::showPauseMenu()
     restartButton->setColor(Color3B(200, 200, 100));
     restartButton->setPosition(Vec2(panel->getContentSize().width / 2, 50));
 
-    // ؼȷťԽմ¼
+    // 关键：确保按钮可以接收触摸事件
     restartButton->setTouchEnabled(true);
     restartButton->setEnabled(true);
-    restartButton->setSwallowTouches(true); // ֹ¼ݵڵ
+    restartButton->setSwallowTouches(true); // 阻止事件传递到父节点
 
     restartButton->addTouchEventListener([this](Ref* sender, ui::Widget::TouchEventType type) {
-        log("GameScene: Restart button event type: %d", (int)type);
+        PVZ_LOGT(LogCategory::GAME, "GameScene: Restart button event type: %d", (int)type);
         if (type == ui::Widget::TouchEventType::ENDED)
         {
-            log("GameScene: Restart button clicked");
+            PVZ_LOGD(LogCategory::GAME, "GameScene: Restart button clicked");
             hidePauseMenu();
             restartGame();
         }
         });
     panel->addChild(restartButton);
 
-    log("GameScene: Pause menu shown");
+    PVZ_LOGD(LogCategory::GAME, "GameScene: Pause menu shown");
 }
 
 void GameScene::hidePauseMenu()
 {
-    // Ƴͣ˵
+    // 移除暂停菜单
     auto overlay = this->getChildByTag(100);
     if (overlay)
     {
         overlay->removeFromParent();
     }
 
-    log("GameScene: Pause menu hidden");
+    PVZ_LOGD(LogCategory::GAME, "GameScene: Pause menu hidden");
 }
 
 void GameScene::exitToMenu()
 {
-    log("GameScene: Exiting to menu");
+    PVZ_LOGI(LogCategory::GAME, "GameScene: Exiting to menu");
 
     auto gameManager = GameManager::getInstance();
     if (gameManager)
@@ -1029,21 +1395,21 @@ void GameScene::exitToMenu()
 
 void GameScene::restartGame()
 {
-    log("GameScene: Restarting game via GameManager");
+    PVZ_LOGI(LogCategory::GAME, "GameScene: Restarting game via GameManager");
 
-    // ָϷ״̬֮ǰͣģ
+    // 恢复游戏状态（如果之前是暂停的）
     resumeGame();
 
-    // ͣ˵
+    // 隐藏暂停菜单
     hidePauseMenu();
 
-    // ֹͣе
+    // 停止所有调度器
     this->unscheduleAllCallbacks();
 
-    // ֹͣж
+    // 停止所有动作
     this->stopAllActions();
 
-    // ֲбҪ releaseΪ Cocos2d-x Զ
+    // 清理植物列表（不要调用 release，因为 Cocos2d-x 会自动管理）
     for (auto plant : _plants)
     {
         if (plant)
@@ -1053,31 +1419,32 @@ void GameScene::restartGame()
     }
     _plants.clear();
 
-    // ֲ￨Ƭб
+    // 清理植物卡片列表
     _plantCards.clear();
 
-    // Ԥ
+    // 清理预览
     if (_plantPreview)
     {
         _plantPreview->removeFromParent();
         _plantPreview = nullptr;
     }
 
-    // ñ
+    // 重置变量
     _selectedPlantType = PlantType::SUNFLOWER;
     _hasSelectedPlant = false;
     _pauseButton = nullptr;
+    _speedButton = nullptr;
     _sunLabel = nullptr;
     _levelLabel = nullptr;
 
-    // ϵͳ
+    // 重置网格系统
     auto gridSystem = GridSystem::getInstance();
     if (gridSystem)
     {
         gridSystem->clearAll();
     }
 
-    // ʹ GameManager Ϸ
+    // 使用 GameManager 重启游戏
     auto gameManager = GameManager::getInstance();
     if (gameManager)
     {
@@ -1085,12 +1452,12 @@ void GameScene::restartGame()
     }
     else
     {
-        // ÷ֱ滻
+        // 备用方案：直接替换场景
         auto scene = GameScene::createScene();
         Director::getInstance()->replaceScene(TransitionFade::create(0.5f, scene));
     }
 
-    // WaveManager
+    // 重置WaveManager
     auto waveManager = WaveManager::getInstance();
     if (waveManager)
     {
@@ -1098,241 +1465,58 @@ void GameScene::restartGame()
     }
 }
 
-// ʼϵͳ
+// 初始化随机阳光系统
 void GameScene::initRandomSunSystem()
 {
-    log("GameScene: Initializing random sun system...");
+    PVZ_LOGD(LogCategory::GAME, "GameScene: Initializing random sun system...");
 
-    // ʼ
+    // 初始化参数
     _randomSunTimer = 0.0f;
-    _randomSunInterval = 8.0f;  // ʼ8һ
-    _randomSunSpeed = 60.0f;    // ٶ
+    _randomSunInterval = GameTuning::RANDOM_SUN_FIRST;
 
-    _randomSuns.clear();
+    // 阳光池绑定到实体层级的阳光层（收集后阳光显示由GameManager的变化通知刷新）
+    auto sunManager = SunManager::getInstance();
+    sunManager->init(_entityLayers->getSunLayer(), 0, 16);
+    sunManager->setSunCollectedCallback(nullptr);
 
-    log("GameScene: Random sun system initialized");
+    PVZ_LOGI(LogCategory::SUN, "GameScene: Random sun system initialized");
 }
 
-// 
+// 更新随机阳光
 void GameScene::updateRandomSuns(float delta)
 {
-    // ¼ʱ
+    // 更新计时器
     _randomSunTimer += delta;
 
-    // ǷҪµ
+    // 检查是否需要生成新的随机阳光
     if (_randomSunTimer >= _randomSunInterval)
     {
         _randomSunTimer = 0.0f;
         spawnRandomSun();
 
-        // һɼ (5-12)
-        _randomSunInterval = 5.0f + CCRANDOM_0_1() * 7.0f;
-    }
-
-    // λ
-    auto it = _randomSuns.begin();
-    while (it != _randomSuns.end())
-    {
-        if (!*it)
-        {
-            it = _randomSuns.erase(it);
-            continue;
-        }
-
-        cocos2d::Sprite* sun = *it;
-
-        // ǷռѾƳˣ
-        if (!sun->getParent())
-        {
-            it = _randomSuns.erase(it);
-            continue;
-        }
-
-        // һ
-        ++it;
+        // 随机化下一次生成间隔 (5-12秒)
+        _randomSunInterval = GameTuning::RANDOM_SUN_MIN + CCRANDOM_0_1() * GameTuning::RANDOM_SUN_VAR;
     }
 }
 
-// 
+// 生成随机阳光
 void GameScene::spawnRandomSun()
 {
     auto visibleSize = Director::getInstance()->getVisibleSize();
     auto origin = Director::getInstance()->getVisibleOrigin();
 
-    // λãĻλ£
+    // 随机生成位置（从屏幕顶部随机位置落下）
     float randomX = origin.x + 50.0f + CCRANDOM_0_1() * (visibleSize.width - 100.0f);
-    float startY = origin.y + visibleSize.height + 30.0f;  // ĻϷʼ
-
-    createRandomSunAtPosition(cocos2d::Vec2(randomX, startY));
+    float startY = origin.y + visibleSize.height + 30.0f;  // 从屏幕顶部上方开始
 
-    log("GameScene: Random sun spawned at (%.0f, %.0f)", randomX, startY);
-}
-
-// ָλô
-void GameScene::createRandomSunAtPosition(const cocos2d::Vec2& startPos)
-{
-    log("GameScene: Creating random sun at position (%.0f, %.0f)", startPos.x, startPos.y);
-
-    // ȡResourceLoaderʵ
-    auto resourceLoader = ResourceLoader::getInstance();
-
-    // ̫
-    cocos2d::Sprite* sun = nullptr;
-
-    if (resourceLoader && resourceLoader->hasAnimation("sun_floating"))
-    {
-        // ʹö̫
-        log("GameScene: Creating sun with sun_floating animation");
-
-        // ȡ
-        auto animation = resourceLoader->getCachedAnimation("sun_floating");
-        if (animation)
-        {
-            // һŶ
-            sun = cocos2d::Sprite::create();
-
-            // һAnimate
-            auto animate = cocos2d::Animate::create(animation);
-            if (animate)
-            {
-                // ѭŶ
-                auto repeatAnimation = cocos2d::RepeatForever::create(animate);
-                sun->runAction(repeatAnimation);
-            }
-        }
-    }
-
-    // ʧܣʹü򵥵ͼΪ
-    if (!sun)
-    {
-        log("GameScene: Using fallback sun graphic for random sun");
-        sun = cocos2d::Sprite::create();
-        sun->setTextureRect(cocos2d::Rect(0, 0, 30, 30));
-        sun->setColor(cocos2d::Color3B(255, 255, 0));
-    }
-
-    // λ
-    sun->setPosition(startPos);
-
-    // ӵ
-    this->addChild(sun, 10); // ߲㼶
-
-    // ӵб
-    _randomSuns.push_back(sun);
-
-    // ⸡
-    auto floatAction = cocos2d::RepeatForever::create(
-        cocos2d::Sequence::create(
-            cocos2d::MoveBy::create(0.5f, cocos2d::Vec2(0, 10)),
-            cocos2d::MoveBy::create(0.5f, cocos2d::Vec2(0, -10)),
-            nullptr
-        )
-    );
-    sun->runAction(floatAction);
-
-    // ת
-    auto rotateAction = cocos2d::RepeatForever::create(
-        cocos2d::RotateBy::create(4.0f, 360)
-    );
-    sun->runAction(rotateAction);
-
-    // ӵռ
-    auto listener = cocos2d::EventListenerTouchOneByOne::create();
-    listener->setSwallowTouches(true);
-    listener->onTouchBegan = [sun, this](cocos2d::Touch* touch, cocos2d::Event* event) {
-        cocos2d::Vec2 locationInNode = sun->convertToNodeSpace(touch->getLocation());
-        cocos2d::Size s = sun->getContentSize();
-        cocos2d::Rect rect = cocos2d::Rect(0, 0, s.width, s.height);
-
-        if (rect.containsPoint(locationInNode))
-        {
-            collectRandomSun(sun);
-            return true;
-        }
-        return false;
-    };
-
-    this->getEventDispatcher()->addEventListenerWithSceneGraphPriority(listener, sun);
-
-    // Զʧ15
-    sun->runAction(cocos2d::Sequence::create(
-        cocos2d::DelayTime::create(15.0f),
-        cocos2d::FadeOut::create(0.5f),
-        cocos2d::CallFunc::create([sun, this]() {
-            // бƳ
-            auto it = std::find(_randomSuns.begin(), _randomSuns.end(), sun);
-            if (it != _randomSuns.end())
-            {
-                _randomSuns.erase(it);
-            }
-            }),
-        cocos2d::RemoveSelf::create(),
-                nullptr
-                ));
-
-    // 䶯
-    auto visibleSize = Director::getInstance()->getVisibleSize();
-    auto origin = Director::getInstance()->getVisibleOrigin();
-
-    // λãƺ
+    // 计算落点位置（草坪区域）
     float endY = origin.y + 100.0f + CCRANDOM_0_1() * 300.0f;
-    float endX = startPos.x + (CCRANDOM_MINUS1_1() * 50.0f); // ΢ƫ
-    cocos2d::Vec2 endPos = cocos2d::Vec2(endX, endY);
-
-    // Ч
-    float fallDuration = 3.0f + CCRANDOM_0_1() * 0.5f; // 2.5-3.5
-
-    auto fallAction = cocos2d::Sequence::create(
-        cocos2d::Spawn::create(
-            cocos2d::MoveTo::create(fallDuration, endPos),
-            cocos2d::ScaleTo::create(fallDuration * 0.3f, 1.2f),  // ȷŴ
-            cocos2d::ScaleTo::create(fallDuration * 0.7f, 1.0f),  // ٻָ
-            nullptr
-        ),
-        nullptr
-    );
+    float endX = randomX + (CCRANDOM_MINUS1_1() * 50.0f); // 轻微左右偏移
 
-    sun->runAction(fallAction);
-}
+    // 下落时间 3-3.5秒
+    float fallDuration = 3.0f + CCRANDOM_0_1() * 0.5f;
 
-// ռ
-void GameScene::collectRandomSun(cocos2d::Sprite* sun)
-{
-    if (!sun) return;
-
-    // ռЧ
-    auto audioManager = AudioManager::getInstance();
-    if (audioManager)
-    {
-        audioManager->playSoundEffect("Sounds/SFX/sun_collected.mp3");
-    }
-
-    // 
-    auto gameManager = GameManager::getInstance();
-    if (gameManager)
-    {
-        gameManager->addSun(25);
-        updateSunDisplay();
-    }
-
-    // ռ
-    auto scaleUp = cocos2d::ScaleTo::create(0.1f, 1.5f);
-    auto fadeOut = cocos2d::FadeOut::create(0.1f);
-    auto remove = cocos2d::RemoveSelf::create();
-
-    auto sequence = cocos2d::Sequence::create(
-        cocos2d::Spawn::create(scaleUp, fadeOut, nullptr),
-        cocos2d::CallFunc::create([sun, this]() {
-            // бƳ
-            auto it = std::find(_randomSuns.begin(), _randomSuns.end(), sun);
-            if (it != _randomSuns.end())
-            {
-                _randomSuns.erase(it);
-            }
-            }),
-        remove,
-                nullptr
-                );
+    SunManager::getInstance()->spawnFallingSun(Vec2(randomX, startY), Vec2(endX, endY), fallDuration);
 
-    sun->runAction(sequence);
+    PVZ_LOGD(LogCategory::SUN, "GameScene: Random sun spawned at (%.0f, %.0f)", randomX, startY);
 }
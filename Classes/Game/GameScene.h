@@ -8,6 +8,10 @@
 #include <UI/PlantCard.h>
 #include <Entities/Plants/Plant.h>
 #include "./Game/WaveManager.h"
+#include "./Game/FixedStepClock.h"
+#include "./Game/EntityLayers.h"
+
+class PerfOverlay;
 
 class GameScene : public cocos2d::Scene {
 public:
@@ -22,35 +26,48 @@ public:
 private:
 
     WaveManager* _waveManager;
+
+    // 实体层级（按行、按种类分层，层内按纹理排序）
+    EntityLayers* _entityLayers = nullptr;
+
+    // 性能面板（F7切换）
+    PerfOverlay* _perfOverlay = nullptr;
+
+    // 阳光数量订阅ID（析构时退订）
+    int _sunListenerId = 0;
+
+    // 固定步长时钟（逻辑按1/120秒步进，支持倍速）
+    FixedStepClock _clock;
+    float _nextWaveTimer;     // 距离下一波开始的逻辑时间（0表示未计时）
+    float _resultTimer;       // 距离结算（胜利/失败）的逻辑时间（0表示未计时）
+    bool _resultIsWin;
+    float _menuTimer;         // 结算后距离返回菜单的逻辑时间
     
-    // UIԪ
+    // UI元素
     cocos2d::ui::Button* _pauseButton;
+    cocos2d::ui::Button* _speedButton;
     cocos2d::Label* _sunLabel;
     cocos2d::Label* _levelLabel;
 
-    // ֲ￨
+    // 植物卡牌
     std::vector<PlantCard*> _plantCards;
     PlantType _selectedPlantType;
     bool _hasSelectedPlant;
 
-    // ʱֲԤ
+    // 临时植物预览
     cocos2d::Sprite* _plantPreview;
 
-    // ϷԪ
+    // 游戏元素
     std::vector<Plant*> _plants;
 
-    // 
-    std::vector<cocos2d::Sprite*> _randomSuns;
-
-    // 
+    // 随机阳光参数（阳光节点由SunManager管理）
     float _randomSunTimer;
     float _randomSunInterval;
-    float _randomSunSpeed;
 
-    // 
+    // 卡牌栏背景
     cocos2d::Sprite* _cardBarBackground;   
 
-    // ʼ
+    // 初始化方法
     void initUI();
     void initGrid();
     void initPlantCards();
@@ -58,32 +75,54 @@ private:
     void initZombieSystem();
     void initRandomSunSystem();
 
-    // Ϸ߼
-    void updateSunDisplay();
-    void updatePlantCards();
+    // 游戏逻辑
+    // HUD：订阅GameManager的阳光数量，只在变化时刷新
+    void updateSunDisplay(int sunCount);
+    void updatePlantCards(int sunCount);
     void updateRandomSuns(float delta);
 
-    // ¼
+    // 逻辑流水线：每帧按 生成 -> 移动 -> 索敌 -> 开火 -> 碰撞 -> 结算伤害 -> 清理 的顺序执行，
+    // 实体自身不再scheduleUpdate
+    void tickGame(float delta);
+    void updateSpawnPhase(float delta);
+    void updateMovePhase(float delta);
+    void updateTargetPhase();
+    void updateFirePhase(float delta);
+    void updateCollidePhase();
+    void updateDamagePhase(float delta);
+    void updateCleanupPhase();
+    void startNextWave();
+    // 卡牌冷却和结算倒计时，与逻辑步同步（倍速时一起加快，暂停时停止）
+    void updateTimers(float delta);
+    void scheduleResult(bool isWin);
+
+    // 渲染插值：帧开始还原逻辑位置，每步前记录位置，帧末按alpha混合显示
+    void restoreSimPositions();
+    void saveSimPositions();
+    void applyRenderInterpolation(float alpha);
+    // 每帧按本帧推进的逻辑时间统一推进实体着色并写回颜色（颜色没变的实体不写）
+    void updateTints(float delta);
+
+    // 事件处理
     void onPlantCardSelected(PlantType plantType);
     void onGridClicked(int row, int col, const cocos2d::Vec2& worldPos);
     void onPauseButtonClicked(cocos2d::Ref* sender, cocos2d::ui::Widget::TouchEventType type);
+    void onSpeedButtonClicked(cocos2d::Ref* sender, cocos2d::ui::Widget::TouchEventType type);
     void onBackButtonClicked(cocos2d::Ref* sender, cocos2d::ui::Widget::TouchEventType type);
 
-    // ֲ
+    // 植物操作
     void placePlant(PlantType plantType, int row, int col);
     void showPlantPreview(PlantType plantType, const cocos2d::Vec2& position);
     void hidePlantPreview();
     void updatePlantPreviewPosition(const cocos2d::Vec2& position);
 
-    // 
+    // 阳光相关
     void spawnRandomSun();
-    void createRandomSunAtPosition(const cocos2d::Vec2& position);
-    void collectRandomSun(cocos2d::Sprite* sun);
-    // 
+    // 阳光操作
     void addSun(int amount);
     void spendSun(int amount);
 
-    // Ϸ
+    // 游戏控制
     void pauseGame();
     void resumeGame();
     void showPauseMenu();
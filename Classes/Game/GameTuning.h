@@ -0,0 +1,67 @@
+#pragma once
+#ifndef __GAME_TUNING_H__
+#define __GAME_TUNING_H__
+
+#include "Entities/EntityTypes.h"
+
+// GameTuning - 对局数值表
+// 场景一侧（GameScene、WaveManager、PlantFactory）和无头模拟（SimWorld）都从这里取网格、波次、阳光和卡牌数值，
+// 调平衡只改这一处，CI上跑出的胜率才对应游戏里的实际手感。
+// 不依赖cocos2d。
+
+namespace GameTuning {
+
+// 网格：5行9列，每格90x130像素，原点为网格左下角（相对可视区域原点）
+const int GRID_ROWS = 5;
+const int GRID_COLS = 9;
+const float CELL_WIDTH = 90.0f;
+const float CELL_HEIGHT = 130.0f;
+const float GRID_ORIGIN_X = 145.0f;
+const float GRID_ORIGIN_Y = 25.0f;
+
+// 波次
+const int TOTAL_WAVES = 10;
+const float PREPARATION_TIME = 5.0f;     // 开局到第一波的时间
+const float WAVE_DELAY = 3.0f;           // 一波清完到下一波的时间
+const float SPAWN_INTERVAL = 2.0f;       // 同一波内的出怪间隔
+
+// 每波僵尸数：前3波依次1、2、3只，之后每波多1.5只
+inline int waveZombieCount(int waveNumber) {
+    return waveNumber > 3 ? static_cast<int>((waveNumber - 2) * 1.5f + 2) : waveNumber;
+}
+
+// 阳光
+const int STARTING_SUN = 100;
+const float RANDOM_SUN_FIRST = 8.0f;     // 开局后第一个随机阳光
+const float RANDOM_SUN_MIN = 5.0f;       // 之后的间隔为 MIN ~ MIN + VAR
+const float RANDOM_SUN_VAR = 7.0f;
+const float SUNFLOWER_INTERVAL = 25.0f;  // 向日葵生产间隔
+
+// 卡牌
+inline int plantSunCost(PlantType type) {
+    switch (type) {
+    case PlantType::SUNFLOWER:   return 50;
+    case PlantType::PEASHOOTER:  return 100;
+    case PlantType::WALLNUT:     return 50;
+    case PlantType::CHERRY_BOMB: return 150;
+    case PlantType::SNOW_PEA:    return 150;
+    case PlantType::POTATO_MINE: return 25;
+    }
+    return 0;
+}
+
+inline float plantCooldown(PlantType type) {
+    switch (type) {
+    case PlantType::SUNFLOWER:   return 7.5f;
+    case PlantType::PEASHOOTER:  return 7.5f;
+    case PlantType::WALLNUT:     return 15.0f;
+    case PlantType::CHERRY_BOMB: return 22.5f;
+    case PlantType::SNOW_PEA:    return 7.5f;
+    case PlantType::POTATO_MINE: return 15.0f;
+    }
+    return 0.0f;
+}
+
+} // namespace GameTuning
+
+#endif // __GAME_TUNING_H__
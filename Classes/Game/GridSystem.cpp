@@ -1,5 +1,6 @@
 #include "GridSystem.h"
 #include "./Classes/Entities/Plants/Plant.h"
+#include "./Game/Logger.h"
 
 USING_NS_CC;
 
@@ -30,7 +31,7 @@ bool GridSystem::init(int rows, int cols, const Size& cellSize, const Vec2& grid
 {
     if (rows <= 0 || cols <= 0 || cellSize.width <= 0 || cellSize.height <= 0)
     {
-        log("GridSystem: Invalid parameters");
+        PVZ_LOGE(LogCategory::GRID, "GridSystem: Invalid parameters");
         return false;
     }
 
@@ -39,7 +40,7 @@ bool GridSystem::init(int rows, int cols, const Size& cellSize, const Vec2& grid
     _cellSize = cellSize;
     _gridOrigin = gridOrigin;
 
-    // ʼ
+    // 初始化格子
     _grid.resize(rows);
     for (int i = 0; i < rows; i++)
     {
@@ -51,14 +52,14 @@ bool GridSystem::init(int rows, int cols, const Size& cellSize, const Vec2& grid
             _grid[i][j].isOccupied = false;
             _grid[i][j].plant = nullptr;
 
-            // Ӿ
+            // 计算格子矩形区域
             float x = _gridOrigin.x + j * _cellSize.width;
             float y = _gridOrigin.y + i * _cellSize.height;
             _grid[i][j].rect = Rect(x, y, _cellSize.width, _cellSize.height);
         }
     }
 
-    log("GridSystem: Initialized %d rows x %d cols", rows, cols);
+    PVZ_LOGI(LogCategory::GRID, "GridSystem: Initialized %d rows x %d cols", rows, cols);
     return true;
 }
 
@@ -69,22 +70,22 @@ bool GridSystem::isValidGrid(int row, int col) const
 
 bool GridSystem::worldToGrid(const Vec2& worldPos, int& outRow, int& outCol) const
 {
-    // ԭλ
+    // 计算相对于网格原点的位置
     float relX = worldPos.x - _gridOrigin.x;
     float relY = worldPos.y - _gridOrigin.y;
 
-    // ǷΧ
+    // 检查是否在网格范围内
     if (relX < 0 || relX >= _cols * _cellSize.width ||
         relY < 0 || relY >= _rows * _cellSize.height)
     {
         return false;
     }
 
-    // 
+    // 计算行列
     outCol = static_cast<int>(relX / _cellSize.width);
     outRow = static_cast<int>(relY / _cellSize.height);
 
-    // ȷЧΧ
+    // 确保在有效范围内
     if (!isValidGrid(outRow, outCol))
     {
         return false;
@@ -114,7 +115,7 @@ Vec2 GridSystem::gridToWorldCenter(int row, int col) const
         return Vec2::ZERO;
     }
 
-    // ظĵ
+    // 返回格子中心点
     return Vec2(worldPos.x + _cellSize.width / 2,
         worldPos.y + _cellSize.height * 1 / 3);
 }
@@ -123,7 +124,7 @@ bool GridSystem::isGridOccupied(int row, int col) const
 {
     if (!isValidGrid(row, col))
     {
-        return true; // ЧΪռ
+        return true; // 无效格子视为已占用
     }
 
     return _grid[row][col].isOccupied;
@@ -138,14 +139,14 @@ bool GridSystem::plantAt(Plant* plant, int row, int col)
 {
     if (!plant || !canPlantAt(row, col))
     {
-        log("GridSystem: Cannot plant at row %d, col %d", row, col);
+        PVZ_LOGD(LogCategory::GRID, "GridSystem: Cannot plant at row %d, col %d", row, col);
         return false;
     }
 
     _grid[row][col].isOccupied = true;
     _grid[row][col].plant = plant;
 
-    log("GridSystem: Plant placed at row %d, col %d", row, col);
+    PVZ_LOGD(LogCategory::GRID, "GridSystem: Plant placed at row %d, col %d", row, col);
     return true;
 }
 
@@ -159,7 +160,7 @@ void GridSystem::removePlant(int row, int col)
     _grid[row][col].isOccupied = false;
     _grid[row][col].plant = nullptr;
 
-    log("GridSystem: Plant removed from row %d, col %d", row, col);
+    PVZ_LOGD(LogCategory::GRID, "GridSystem: Plant removed from row %d, col %d", row, col);
 }
 
 Plant* GridSystem::getPlantAt(int row, int col) const
@@ -177,26 +178,26 @@ void GridSystem::handleTouch(const Vec2& touchPos)
     int row, col;
     if (worldToGrid(touchPos, row, col))
     {
-        // ûص
+        // 调用回调函数
         if (_clickCallback)
         {
             _clickCallback(row, col, gridToWorldCenter(row, col));
         }
 
-        log("GridSystem: Grid clicked at row %d, col %d", row, col);
+        PVZ_LOGT(LogCategory::GRID, "GridSystem: Grid clicked at row %d, col %d", row, col);
     }
 }
 
 void GridSystem::reset()
 {
-    // ƳԽڵ
+    // 移除调试节点
     if (_debugNode)
     {
         _debugNode->removeFromParent();
         _debugNode = nullptr;
     }
 
-    // 
+    // 重置网格数据
     for (int i = 0; i < _rows; i++)
     {
         for (int j = 0; j < _cols; j++)
@@ -205,10 +206,10 @@ void GridSystem::reset()
         }
     }
 
-    // õص
+    // 重置点击回调
     _clickCallback = nullptr;
 
-    log("GridSystem: Reset completed");
+    PVZ_LOGI(LogCategory::GRID, "GridSystem: Reset completed");
 }
 
 void GridSystem::drawDebugGrid(Node* parent)
@@ -220,26 +221,26 @@ void GridSystem::drawDebugGrid(Node* parent)
 
     
     /*
-    // ƳɵĵԽڵ
+    // 移除旧的调试节点
     if (_debugNode && _debugNode->getParent())
     {
         _debugNode->removeFromParent();
     }
     
     _debugNode = DrawNode::create();
-    parent->addChild(_debugNode, 9999); // ߲㼶ʾ
+    parent->addChild(_debugNode, 9999); // 最高层级显示
 
-    // ɫ
-    Color4F gridColor(1.0f, 1.0f, 0.0f, 0.5f); // ɫ͸
+    // 设置网格颜色
+    Color4F gridColor(1.0f, 1.0f, 0.0f, 0.5f); // 黄色半透明
 
-    // и
+    // 绘制所有格子
     for (int i = 0; i < _rows; i++)
     {
         for (int j = 0; j < _cols; j++)
 {
             const Rect& rect = _grid[i][j].rect;
 
-            // Ƹӱ߿
+            // 绘制格子边框
             Vec2 vertices[] = {
                 Vec2(rect.origin.x, rect.origin.y),
                 Vec2(rect.origin.x + rect.size.width, rect.origin.y),
@@ -249,16 +250,16 @@ void GridSystem::drawDebugGrid(Node* parent)
 
             _debugNode->drawPoly(vertices, 4, true, gridColor);
 
-            // ӱռã
+            // 如果格子被占用，绘制填充
             if (_grid[i][j].isOccupied)
     {
-                Color4F occupiedColor(1.0f, 0.0f, 0.0f, 0.2f); // ɫ͸
+                Color4F occupiedColor(1.0f, 0.0f, 0.0f, 0.2f); // 红色半透明
                 _debugNode->drawSolidRect(rect.origin,
                     Vec2(rect.origin.x + rect.size.width, rect.origin.y + rect.size.height),
                     occupiedColor);
             }
 
-            // ʾб
+            // 显示行列编号
             std::string gridText = StringUtils::format("%d,%d", i, j);
             auto label = Label::createWithTTF(gridText, "fonts/Marker Felt.ttf", 12);
             label->setPosition(rect.origin.x + rect.size.width / 2,
@@ -268,7 +269,7 @@ void GridSystem::drawDebugGrid(Node* parent)
         }
     }
 
-    log("GridSystem: Debug grid drawn");
+    PVZ_LOGD(LogCategory::GRID, "GridSystem: Debug grid drawn");
     */
 }
 
@@ -282,5 +283,5 @@ void GridSystem::clearAll()
         }
     }
 
-    log("GridSystem: All grids cleared");
+    PVZ_LOGD(LogCategory::GRID, "GridSystem: All grids cleared");
 }
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "LaneBroadphase.h"
+#include <algorithm>
+
+LaneBroadphase::LaneBroadphase()
+    : _laneCount(0)
+{
+}
+
+void LaneBroadphase::reset(int laneCount)
+{
+    if (laneCount < 0) {
+        laneCount = 0;
+    }
+    if (static_cast<int>(_lanes.size()) < laneCount) {
+        _lanes.resize(laneCount);
+    }
+    _laneCount = laneCount;
+
+    for (int i = 0; i < _laneCount; i++) {
+        _lanes[i].bodies.clear();
+        _lanes[i].sweeps.clear();
+        _lanes[i].maxBodyWidth = 0.0f;
+    }
+    _hits.clear();
+}
+
+void LaneBroadphase::addBody(int lane, float minX, float maxX, uint32_t bodyId)
+{
+    if (lane < 0 || lane >= _laneCount || maxX < minX) {
+        return;
+    }
+
+    Lane& target = _lanes[lane];
+    Body body = { minX, maxX, bodyId };
+    target.bodies.push_back(body);
+    target.maxBodyWidth = std::max(target.maxBodyWidth, maxX - minX);
+}
+
+void LaneBroadphase::addSweep(int lane, float fromX, float toX, float halfWidth, uint32_t sweepId)
+{
+    if (lane < 0 || lane >= _laneCount) {
+        return;
+    }
+
+    Sweep sweep;
+    sweep.minX = std::min(fromX, toX) - halfWidth;
+    sweep.maxX = std::max(fromX, toX) + halfWidth;
+    sweep.fromX = fromX;
+    sweep.toX = toX;
+    sweep.halfWidth = halfWidth;
+    sweep.id = sweepId;
+    _lanes[lane].sweeps.push_back(sweep);
+}
+
+const std::vector<LaneHit>& LaneBroadphase::solve()
+{
+    _hits.clear();
+
+    for (int i = 0; i < _laneCount; i++) {
+        Lane& lane = _lanes[i];
+        if (lane.bodies.empty() || lane.sweeps.empty()) {
+            continue;
+        }
+
+        std::sort(lane.bodies.begin(), lane.bodies.end(),
+            [](const Body& a, const Body& b) { return a.minX < b.minX; });
+        std::sort(lane.sweeps.begin(), lane.sweeps.end(),
+            [](const Sweep& a, const Sweep& b) { return a.minX < b.minX; });
+
+        const size_t bodyCount = lane.bodies.size();
+        size_t cursor = 0;
+
+        for (const auto& sweep : lane.sweeps) {
+            // minX比扫掠区间左端还小一个最大宽度的僵尸不可能再与之后的子弹重叠
+            while (cursor < bodyCount &&
+                lane.bodies[cursor].minX + lane.maxBodyWidth < sweep.minX) {
+                cursor++;
+            }
+
+            size_t firstHit = _hits.size();
+            float delta = sweep.toX - sweep.fromX;
+
+            for (size_t j = cursor; j < bodyCount && lane.bodies[j].minX <= sweep.maxX; j++) {
+                const Body& body = lane.bodies[j];
+                if (body.maxX < sweep.minX) {
+                    continue;
+                }
+
+                // 沿位移方向求进入时间，起点已重叠时为0
+                float time = 0.0f;
+                if (delta > 0.0f) {
+                    time = (body.minX - sweep.halfWidth - sweep.fromX) / delta;
+                }
+                else if (delta < 0.0f) {
+                    time = (sweep.fromX - sweep.halfWidth - body.maxX) / -delta;
+                }
+                time = std::min(1.0f, std::max(0.0f, time));
+
+                LaneHit hit;
+                hit.sweepId = sweep.id;
+                hit.bodyId = body.id;
+                hit.time = time;
+                hit.hitX = sweep.fromX + delta * time;
+                _hits.push_back(hit);
+            }
+
+            if (_hits.size() - firstHit > 1) {
+                std::sort(_hits.begin() + firstHit, _hits.end(),
+                    [](const LaneHit& a, const LaneHit& b) { return a.time < b.time; });
+            }
+        }
+    }
+
+    return _hits;
+}
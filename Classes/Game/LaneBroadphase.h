@@ -0,0 +1,67 @@
+#pragma once
+#ifndef __LANE_BROADPHASE_H__
+#define __LANE_BROADPHASE_H__
+
+#include <vector>
+#include <cstdint>
+
+// LaneBroadphase - 按行分桶的子弹/僵尸碰撞检测
+// 子弹和僵尸都只在所在行内检测：每行的僵尸按minX排序，子弹按扫掠区间排序，
+// 用单调推进的游标做区间扫描（sweep and prune），复杂度约为 O(P log P + Z log Z + 命中数)。
+// 子弹使用本帧起点到终点的扫掠区间做连续检测，高速或大delta时不会穿过僵尸。
+// 不依赖cocos2d，场景(GameManager)和无头模拟(SimWorld)共用。
+
+// 一次命中（按子弹分组，组内按进入时间升序）
+struct LaneHit {
+    uint32_t sweepId;     // 子弹的调用方索引
+    uint32_t bodyId;      // 僵尸的调用方索引
+    float time;           // 沿本帧位移进入碰撞的比例 [0, 1]
+    float hitX;           // 进入碰撞时子弹中心的x
+};
+
+class LaneBroadphase {
+public:
+    LaneBroadphase();
+
+    // 清空并设置行数（保留已分配的容量，每帧复用不再分配）
+    void reset(int laneCount);
+
+    // 僵尸的x区间
+    void addBody(int lane, float minX, float maxX, uint32_t bodyId);
+
+    // 子弹本帧从fromX移动到toX，halfWidth为子弹半宽
+    void addSweep(int lane, float fromX, float toX, float halfWidth, uint32_t sweepId);
+
+    // 计算所有命中，结果按子弹分组、组内按进入时间排序
+    const std::vector<LaneHit>& solve();
+
+    const std::vector<LaneHit>& getHits() const { return _hits; }
+
+private:
+    struct Body {
+        float minX;
+        float maxX;
+        uint32_t id;
+    };
+
+    struct Sweep {
+        float minX;       // 扫掠区间（含半宽）
+        float maxX;
+        float fromX;
+        float toX;
+        float halfWidth;
+        uint32_t id;
+    };
+
+    struct Lane {
+        std::vector<Body> bodies;
+        std::vector<Sweep> sweeps;
+        float maxBodyWidth;
+    };
+
+    std::vector<Lane> _lanes;
+    int _laneCount;
+    std::vector<LaneHit> _hits;
+};
+
+#endif // __LANE_BROADPHASE_H__
@@ -0,0 +1,409 @@
+#include "Logger.h"
+#include <chrono>
+
+namespace {
+    const int RING_MASK = Logger::RING_CAPACITY - 1;
+    const int FLUSH_INTERVAL_MS = 20;       // 后台线程空闲时的轮询间隔
+
+    uint64_t nowNanoseconds()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void writeBytes(FILE* file, const void* data, size_t size)
+    {
+        fwrite(data, 1, size, file);
+    }
+
+    template <typename T>
+    void writePod(FILE* file, const T& value)
+    {
+        fwrite(&value, sizeof(T), 1, file);
+    }
+
+    const char* const LEVEL_NAMES[] = { "TRACE", "DEBUG", "INFO", "WARN", "ERROR" };
+
+    const char* const CATEGORY_NAMES[] = {
+        "GENERAL", "GAME", "WAVE", "PLANT", "ZOMBIE", "PROJECTILE",
+        "SUN", "GRID", "RESOURCE", "AUDIO", "UI"
+    };
+    static_assert(sizeof(CATEGORY_NAMES) / sizeof(CATEGORY_NAMES[0]) == (size_t)LogCategory::COUNT,
+        "CATEGORY_NAMES must match LogCategory");
+}
+
+const char Logger::FILE_MAGIC[8] = { 'P', 'V', 'Z', 'L', 'O', 'G', '\0', '\0' };
+const uint32_t Logger::FILE_VERSION;
+const int Logger::PAYLOAD_SIZE;
+const int Logger::RING_CAPACITY;
+
+Logger* Logger::_instance = nullptr;
+
+Logger* Logger::getInstance()
+{
+    if (_instance == nullptr) {
+        _instance = new Logger();
+    }
+    return _instance;
+}
+
+Logger::Logger()
+    : _ring(new Slot[RING_CAPACITY])
+    , _enqueuePos(0)
+    , _dequeuePos(0)
+    , _running(false)
+    , _consoleEcho(false)
+    , _dropped(0)
+    , _stopRequested(false)
+    , _file(nullptr)
+    , _startTime(0)
+    , _droppedWritten(0)
+{
+    static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "RING_CAPACITY must be a power of two");
+
+    for (int i = 0; i < RING_CAPACITY; i++) {
+        _ring[i].sequence.store((uint64_t)i, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < (int)LogCategory::COUNT; i++) {
+        _categoryLevels[i].store(PVZ_LOG_LEVEL, std::memory_order_relaxed);
+    }
+}
+
+Logger::~Logger()
+{
+    shutdown();
+    delete[] _ring;
+    _instance = nullptr;
+}
+
+bool Logger::start(const std::string& filePath)
+{
+    shutdown();
+
+    _file = fopen(filePath.c_str(), "wb");
+    if (!_file) {
+        fprintf(stderr, "Logger: Failed to open %s\n", filePath.c_str());
+        return false;
+    }
+
+    _startTime = nowNanoseconds();
+    _formats.clear();
+    _droppedWritten = _dropped.load(std::memory_order_relaxed);
+
+    // 文件头：魔数、版本、模块名表（解码器不依赖枚举顺序）
+    writeBytes(_file, FILE_MAGIC, sizeof(FILE_MAGIC));
+    writePod(_file, FILE_VERSION);
+    writePod(_file, (uint32_t)LogCategory::COUNT);
+    for (int i = 0; i < (int)LogCategory::COUNT; i++) {
+        uint8_t length = (uint8_t)strlen(CATEGORY_NAMES[i]);
+        writePod(_file, length);
+        writeBytes(_file, CATEGORY_NAMES[i], length);
+    }
+    uint64_t startUnixMs = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    writePod(_file, startUnixMs);
+    fflush(_file);
+
+    _stopRequested = false;
+    _running.store(true, std::memory_order_release);
+    _thread = std::thread(&Logger::run, this);
+    return true;
+}
+
+void Logger::shutdown()
+{
+    if (!_thread.joinable()) {
+        return;
+    }
+
+    _running.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _stopRequested = true;
+    }
+    _wakeCondition.notify_one();
+    _thread.join();
+
+    if (_file) {
+        fclose(_file);
+        _file = nullptr;
+    }
+}
+
+void Logger::setCategoryLevel(LogCategory category, int level)
+{
+    if (category >= LogCategory::COUNT) {
+        return;
+    }
+    _categoryLevels[(int)category].store(level < PVZ_LOG_LEVEL ? PVZ_LOG_LEVEL : level,
+        std::memory_order_relaxed);
+}
+
+const char* Logger::getLevelName(int level)
+{
+    if (level < PVZ_LOG_LEVEL_TRACE || level > PVZ_LOG_LEVEL_ERROR) {
+        return "?";
+    }
+    return LEVEL_NAMES[level];
+}
+
+const char* Logger::getCategoryName(LogCategory category)
+{
+    if (category >= LogCategory::COUNT) {
+        return "?";
+    }
+    return CATEGORY_NAMES[(int)category];
+}
+
+uint32_t Logger::getThreadId()
+{
+    // 线程按首次写日志的顺序编号，比系统线程id短，解码后也更好读
+    static std::atomic<uint32_t> nextId(1);
+    thread_local uint32_t threadId = nextId.fetch_add(1, std::memory_order_relaxed);
+    return threadId;
+}
+
+// 有界多生产者队列：每个槽位的sequence表示它当前可以被哪一轮写入/读取
+Logger::Slot* Logger::claimSlot()
+{
+    uint64_t pos = _enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot* slot = &_ring[pos & RING_MASK];
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        int64_t diff = (int64_t)sequence - (int64_t)pos;
+        if (diff == 0) {
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot->timestamp = nowNanoseconds() - _startTime;
+                slot->threadId = getThreadId();
+                return slot;
+            }
+        } else if (diff < 0) {
+            // 缓冲区满（后台线程跟不上）
+            return nullptr;
+        } else {
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::publishSlot(Slot* slot)
+{
+    uint64_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(sequence + 1, std::memory_order_release);
+}
+
+void Logger::appendValue(Slot* slot, uint8_t type, const void* data, size_t size)
+{
+    if (slot->size + 1 + size > (size_t)PAYLOAD_SIZE) {
+        return;
+    }
+    slot->payload[slot->size++] = type;
+    memcpy(slot->payload + slot->size, data, size);
+    slot->size = (uint16_t)(slot->size + size);
+}
+
+void Logger::appendString(Slot* slot, const char* value)
+{
+    // 类型(1) + 长度(2) + 内容，放不下的部分截断
+    int available = PAYLOAD_SIZE - slot->size - 3;
+    if (available < 0) {
+        return;
+    }
+    size_t length = strlen(value);
+    uint16_t stored = (uint16_t)(length < (size_t)available ? length : (size_t)available);
+
+    slot->payload[slot->size++] = ARG_STRING;
+    memcpy(slot->payload + slot->size, &stored, sizeof(stored));
+    slot->size = (uint16_t)(slot->size + sizeof(stored));
+    memcpy(slot->payload + slot->size, value, stored);
+    slot->size = (uint16_t)(slot->size + stored);
+}
+
+void Logger::run()
+{
+    for (;;) {
+        bool wrote = drain();
+        if (wrote) {
+            fflush(_file);
+        }
+
+        std::unique_lock<std::mutex> lock(_wakeMutex);
+        if (_stopRequested) {
+            lock.unlock();
+            // 停止前把已发布的记录写完
+            drain();
+            fflush(_file);
+            return;
+        }
+        _wakeCondition.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS));
+    }
+}
+
+bool Logger::drain()
+{
+    bool wrote = false;
+    for (;;) {
+        Slot& slot = _ring[_dequeuePos & RING_MASK];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != _dequeuePos + 1) {
+            break;
+        }
+
+        writeSlot(slot);
+        slot.sequence.store(_dequeuePos + RING_CAPACITY, std::memory_order_release);
+        _dequeuePos++;
+        wrote = true;
+    }
+
+    uint64_t dropped = _dropped.load(std::memory_order_relaxed);
+    if (dropped != _droppedWritten) {
+        writePod(_file, (uint8_t)BLOCK_DROPPED);
+        writePod(_file, (uint32_t)(dropped - _droppedWritten));
+        _droppedWritten = dropped;
+        wrote = true;
+    }
+    return wrote;
+}
+
+void Logger::writeSlot(const Slot& slot)
+{
+    uint32_t formatId = getFormatId(slot.format);
+
+    writePod(_file, (uint8_t)BLOCK_MESSAGE);
+    writePod(_file, formatId);
+    writePod(_file, slot.timestamp);
+    writePod(_file, slot.level);
+    writePod(_file, slot.category);
+    writePod(_file, slot.threadId);
+    writePod(_file, slot.size);
+    writeBytes(_file, slot.payload, slot.size);
+
+    if (_consoleEcho.load(std::memory_order_relaxed)) {
+        std::string text = formatMessage(slot.format, slot.payload, slot.size);
+        fprintf(stdout, "[%s][%s] %s\n", getLevelName(slot.level),
+            getCategoryName((LogCategory)slot.category), text.c_str());
+    }
+}
+
+uint32_t Logger::getFormatId(const char* format)
+{
+    // 格式串是字面量，按指针去重；种类不多，线性查找即可
+    for (size_t i = 0; i < _formats.size(); i++) {
+        if (_formats[i] == format) {
+            return (uint32_t)i;
+        }
+    }
+
+    uint32_t id = (uint32_t)_formats.size();
+    _formats.push_back(format);
+
+    uint16_t length = (uint16_t)strlen(format);
+    writePod(_file, (uint8_t)BLOCK_FORMAT);
+    writePod(_file, id);
+    writePod(_file, length);
+    writeBytes(_file, format, length);
+    return id;
+}
+
+std::string Logger::formatMessage(const char* format, const uint8_t* payload, size_t size)
+{
+    std::string result;
+    size_t offset = 0;
+    char buffer[256];
+
+    const char* p = format;
+    while (*p) {
+        if (*p != '%') {
+            result += *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            result += '%';
+            p += 2;
+            continue;
+        }
+
+        // 取出标志/宽度/精度，丢掉长度修饰符，按实际编码的类型重新拼格式
+        std::string spec = "%";
+        p++;
+        while (*p && strchr("-+ #0123456789.", *p)) {
+            spec += *p++;
+        }
+        while (*p && strchr("hlLqjzt", *p)) {
+            p++;
+        }
+        char conversion = *p ? *p++ : 'd';
+
+        if (offset >= size) {
+            result += "<missing>";
+            continue;
+        }
+
+        uint8_t type = payload[offset++];
+        if (type == ARG_STRING) {
+            uint16_t length = 0;
+            memcpy(&length, payload + offset, sizeof(length));
+            offset += sizeof(length);
+            std::string value((const char*)payload + offset, length);
+            offset += length;
+            if (conversion == 's') {
+                snprintf(buffer, sizeof(buffer), (spec + "s").c_str(), value.c_str());
+                result += buffer;
+            } else {
+                result += value;
+            }
+            continue;
+        }
+
+        uint64_t raw = 0;
+        memcpy(&raw, payload + offset, sizeof(raw));
+        offset += sizeof(raw);
+
+        int64_t asInt = 0;
+        uint64_t asUint = 0;
+        double asDouble = 0.0;
+        if (type == ARG_DOUBLE) {
+            memcpy(&asDouble, &raw, sizeof(asDouble));
+            asInt = (int64_t)asDouble;
+            asUint = (uint64_t)asInt;
+        } else {
+            asUint = raw;
+            asInt = (int64_t)raw;
+            asDouble = type == ARG_INT ? (double)asInt : (double)asUint;
+        }
+
+        switch (conversion) {
+        case 'd':
+        case 'i':
+            snprintf(buffer, sizeof(buffer), (spec + "lld").c_str(), (long long)asInt);
+            break;
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            snprintf(buffer, sizeof(buffer), (spec + "ll" + conversion).c_str(), (unsigned long long)asUint);
+            break;
+        case 'c':
+            snprintf(buffer, sizeof(buffer), (spec + "c").c_str(), (int)asInt);
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(), asDouble);
+            break;
+        case 'p':
+            snprintf(buffer, sizeof(buffer), "0x%llx", (unsigned long long)asUint);
+            break;
+        default:
+            snprintf(buffer, sizeof(buffer), "<%%%c?>", conversion);
+            break;
+        }
+        result += buffer;
+    }
+    return result;
+}
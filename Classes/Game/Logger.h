@@ -0,0 +1,271 @@
+#pragma once
+#ifndef __LOGGER_H__
+#define __LOGGER_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Logger - 分级、分模块的异步日志
+// 调用方只把格式串指针和参数按类型编码进一个无锁环形缓冲区（不格式化、不加锁、不做IO），
+// 后台线程批量取出写成紧凑的二进制文件，格式串每种只写一次；用proj.headless的pvz_logdecode离线还原成文本。
+// 低于编译期阈值PVZ_LOG_LEVEL的宏展开为永不执行的分支，参数不会求值但仍算作被引用（发布版不会出现只为日志计算的变量未使用的警告）；缓冲区满时丢弃并计数，不阻塞游戏线程。
+// 格式串必须是字符串字面量（记录里只存指针）。不依赖cocos2d，场景和无头运行器共用。
+
+#define PVZ_LOG_LEVEL_TRACE 0
+#define PVZ_LOG_LEVEL_DEBUG 1
+#define PVZ_LOG_LEVEL_INFO  2
+#define PVZ_LOG_LEVEL_WARN  3
+#define PVZ_LOG_LEVEL_ERROR 4
+#define PVZ_LOG_LEVEL_OFF   5
+
+// 编译期阈值：调试版默认DEBUG，发布版默认INFO（可在工程里用预处理器定义覆盖）
+#ifndef PVZ_LOG_LEVEL
+#if defined(_DEBUG) || (defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0)
+#define PVZ_LOG_LEVEL PVZ_LOG_LEVEL_DEBUG
+#else
+#define PVZ_LOG_LEVEL PVZ_LOG_LEVEL_INFO
+#endif
+#endif
+
+// 模块（写进每条记录，解码时可按模块过滤）
+enum class LogCategory : uint8_t {
+    GENERAL,
+    GAME,
+    WAVE,
+    PLANT,
+    ZOMBIE,
+    PROJECTILE,
+    SUN,
+    GRID,
+    RESOURCE,
+    AUDIO,
+    UI,
+    COUNT
+};
+
+class Logger {
+public:
+    // 记录里参数的类型标记
+    enum ArgType : uint8_t {
+        ARG_INT = 1,
+        ARG_UINT = 2,
+        ARG_DOUBLE = 3,
+        ARG_STRING = 4,
+        ARG_POINTER = 5
+    };
+
+    // 二进制文件中的块类型
+    enum BlockType : uint8_t {
+        BLOCK_FORMAT = 'F',     // 格式串定义：id + 文本
+        BLOCK_MESSAGE = 'M',    // 一条日志：格式串id + 时间 + 级别 + 模块 + 线程 + 参数
+        BLOCK_DROPPED = 'D'     // 缓冲区满丢弃的条数
+    };
+
+    static const char FILE_MAGIC[8];
+    static const uint32_t FILE_VERSION = 1;
+    static const int PAYLOAD_SIZE = 200;    // 单条记录参数区大小，超出的字符串截断
+    static const int RING_CAPACITY = 4096;  // 槽位数，必须是2的幂
+
+    static Logger* getInstance();
+
+    // 打开日志文件并启动后台线程；重复调用会先关闭上一个文件
+    bool start(const std::string& filePath);
+    // 写完缓冲区剩余的记录后停止后台线程并关闭文件
+    void shutdown();
+    bool isRunning() const { return _running.load(std::memory_order_acquire); }
+
+    // 后台线程写文件时同时把文本打印到stdout（调试用，发布版不开）
+    void setConsoleEcho(bool echo) { _consoleEcho.store(echo, std::memory_order_relaxed); }
+
+    // 运行期按模块提高级别（只能比编译期阈值更严格）
+    void setCategoryLevel(LogCategory category, int level);
+    bool isEnabled(int level, LogCategory category) const
+    {
+        return level >= _categoryLevels[(int)category].load(std::memory_order_relaxed);
+    }
+
+    uint64_t getDroppedCount() const { return _dropped.load(std::memory_order_relaxed); }
+
+    // 宏调用的入口：编码参数并放入环形缓冲区
+    template <typename... Args>
+    void write(int level, LogCategory category, const char* format, const Args&... args)
+    {
+        if (!isRunning() || !isEnabled(level, category)) {
+            return;
+        }
+
+        Slot* slot = claimSlot();
+        if (!slot) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        slot->format = format;
+        slot->level = (uint8_t)level;
+        slot->category = (uint8_t)category;
+        slot->size = 0;
+        encodeArgs(slot, args...);
+        publishSlot(slot);
+    }
+
+    static const char* getLevelName(int level);
+    static const char* getCategoryName(LogCategory category);
+
+    // 按printf格式串和编码后的参数生成文本（后台线程回显和解码器共用）
+    static std::string formatMessage(const char* format, const uint8_t* payload, size_t size);
+
+private:
+    Logger();
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        uint64_t timestamp;         // 相对start()的纳秒数
+        const char* format;
+        uint32_t threadId;
+        uint16_t size;
+        uint8_t level;
+        uint8_t category;
+        uint8_t payload[PAYLOAD_SIZE];
+    };
+
+    Slot* claimSlot();
+    void publishSlot(Slot* slot);
+
+    void run();
+    bool drain();
+    void writeSlot(const Slot& slot);
+    uint32_t getFormatId(const char* format);
+
+    static uint32_t getThreadId();
+
+    // 参数编码：整数统一为64位，浮点统一为double，字符串拷贝内容（带长度）
+    static void encodeArgs(Slot*) {}
+
+    template <typename T, typename... Rest>
+    static void encodeArgs(Slot* slot, const T& value, const Rest&... rest)
+    {
+        encodeArg(slot, value);
+        encodeArgs(slot, rest...);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+    encodeArg(Slot* slot, T value)
+    {
+        int64_t v = (int64_t)value;
+        appendValue(slot, ARG_INT, &v, sizeof(v));
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+    encodeArg(Slot* slot, T value)
+    {
+        uint64_t v = (uint64_t)value;
+        appendValue(slot, ARG_UINT, &v, sizeof(v));
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_enum<T>::value>::type
+    encodeArg(Slot* slot, T value)
+    {
+        int64_t v = (int64_t)value;
+        appendValue(slot, ARG_INT, &v, sizeof(v));
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_floating_point<T>::value>::type
+    encodeArg(Slot* slot, T value)
+    {
+        double v = (double)value;
+        appendValue(slot, ARG_DOUBLE, &v, sizeof(v));
+    }
+
+    static void encodeArg(Slot* slot, const char* value) { appendString(slot, value ? value : "(null)"); }
+    static void encodeArg(Slot* slot, char* value) { appendString(slot, value ? value : "(null)"); }
+    static void encodeArg(Slot* slot, const std::string& value) { appendString(slot, value.c_str()); }
+
+    template <size_t N>
+    static void encodeArg(Slot* slot, const char (&value)[N]) { appendString(slot, value); }
+
+    template <typename T>
+    static void encodeArg(Slot* slot, T* value)
+    {
+        uint64_t v = (uint64_t)(uintptr_t)value;
+        appendValue(slot, ARG_POINTER, &v, sizeof(v));
+    }
+
+    static void appendValue(Slot* slot, uint8_t type, const void* data, size_t size);
+    static void appendString(Slot* slot, const char* value);
+
+    static Logger* _instance;
+
+    Slot* _ring;
+    std::atomic<uint64_t> _enqueuePos;
+    uint64_t _dequeuePos;                   // 只有后台线程访问
+
+    std::atomic<bool> _running;
+    std::atomic<bool> _consoleEcho;
+    std::atomic<uint64_t> _dropped;
+    std::atomic<int> _categoryLevels[(int)LogCategory::COUNT];
+
+    std::thread _thread;
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+    bool _stopRequested;
+
+    FILE* _file;
+    uint64_t _startTime;
+    uint64_t _droppedWritten;
+    std::vector<const char*> _formats;      // 已写入文件的格式串，下标即id
+};
+
+#define PVZ_LOG_WRITE(level, category, format, ...) \
+    Logger::getInstance()->write(level, category, format, ##__VA_ARGS__)
+
+// 编译期关闭的级别：保留参数的引用，但不求值
+#define PVZ_LOG_DISCARD(level, category, format, ...) \
+    do { if (0) PVZ_LOG_WRITE(level, category, format, ##__VA_ARGS__); } while (0)
+
+#if PVZ_LOG_LEVEL <= PVZ_LOG_LEVEL_TRACE
+#define PVZ_LOGT(category, format, ...) PVZ_LOG_WRITE(PVZ_LOG_LEVEL_TRACE, category, format, ##__VA_ARGS__)
+#else
+#define PVZ_LOGT(category, format, ...) PVZ_LOG_DISCARD(PVZ_LOG_LEVEL_TRACE, category, format, ##__VA_ARGS__)
+#endif
+
+#if PVZ_LOG_LEVEL <= PVZ_LOG_LEVEL_DEBUG
+#define PVZ_LOGD(category, format, ...) PVZ_LOG_WRITE(PVZ_LOG_LEVEL_DEBUG, category, format, ##__VA_ARGS__)
+#else
+#define PVZ_LOGD(category, format, ...) PVZ_LOG_DISCARD(PVZ_LOG_LEVEL_DEBUG, category, format, ##__VA_ARGS__)
+#endif
+
+#if PVZ_LOG_LEVEL <= PVZ_LOG_LEVEL_INFO
+#define PVZ_LOGI(category, format, ...) PVZ_LOG_WRITE(PVZ_LOG_LEVEL_INFO, category, format, ##__VA_ARGS__)
+#else
+#define PVZ_LOGI(category, format, ...) PVZ_LOG_DISCARD(PVZ_LOG_LEVEL_INFO, category, format, ##__VA_ARGS__)
+#endif
+
+#if PVZ_LOG_LEVEL <= PVZ_LOG_LEVEL_WARN
+#define PVZ_LOGW(category, format, ...) PVZ_LOG_WRITE(PVZ_LOG_LEVEL_WARN, category, format, ##__VA_ARGS__)
+#else
+#define PVZ_LOGW(category, format, ...) PVZ_LOG_DISCARD(PVZ_LOG_LEVEL_WARN, category, format, ##__VA_ARGS__)
+#endif
+
+#if PVZ_LOG_LEVEL <= PVZ_LOG_LEVEL_ERROR
+#define PVZ_LOGE(category, format, ...) PVZ_LOG_WRITE(PVZ_LOG_LEVEL_ERROR, category, format, ##__VA_ARGS__)
+#else
+#define PVZ_LOGE(category, format, ...) PVZ_LOG_DISCARD(PVZ_LOG_LEVEL_ERROR, category, format, ##__VA_ARGS__)
+#endif
+
+#endif // __LOGGER_H__
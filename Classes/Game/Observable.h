@@ -0,0 +1,96 @@
+#pragma once
+#ifndef __OBSERVABLE_H__
+#define __OBSERVABLE_H__
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Observable - 可订阅的游戏状态值
+// 值真正变化时才通知订阅者，HUD据此刷新，不再每帧轮询GameManager并重设Label/透明度。
+// 通知过程中可以安全地订阅/退订（退订只置空，通知结束后再压缩列表）。
+// 只在主线程使用；不依赖cocos2d。
+
+template <typename T>
+class Observable {
+public:
+    typedef std::function<void(const T& value)> Listener;
+
+    explicit Observable(const T& value = T())
+        : _value(value)
+        , _nextId(1)
+        , _notifying(0)
+        , _hasRemoved(false) {
+    }
+
+    const T& get() const { return _value; }
+
+    // 新值与旧值相同时不通知
+    void set(const T& value) {
+        if (_value == value) {
+            return;
+        }
+        _value = value;
+        notify();
+    }
+
+    // 返回订阅ID，退订时使用；immediate为true时立即用当前值回调一次（绑定UI时省去一次手动刷新）
+    int subscribe(Listener listener, bool immediate = true) {
+        int id = _nextId++;
+        _listeners.push_back(std::make_pair(id, std::move(listener)));
+        if (immediate) {
+            _listeners.back().second(_value);
+        }
+        return id;
+    }
+
+    void unsubscribe(int id) {
+        for (auto& entry : _listeners) {
+            if (entry.first == id) {
+                entry.second = nullptr;
+                _hasRemoved = true;
+            }
+        }
+        compact();
+    }
+
+    size_t getListenerCount() const { return _listeners.size(); }
+
+private:
+    void notify() {
+        _notifying++;
+        // 按下标遍历：回调里新增的订阅者本次也会收到通知
+        for (size_t i = 0; i < _listeners.size(); i++) {
+            if (_listeners[i].second) {
+                // 拷贝一份，回调里退订自己时不会销毁正在执行的函数对象
+                Listener listener = _listeners[i].second;
+                listener(_value);
+            }
+        }
+        _notifying--;
+        compact();
+    }
+
+    void compact() {
+        if (_notifying > 0 || !_hasRemoved) {
+            return;
+        }
+        std::vector<std::pair<int, Listener>> alive;
+        alive.reserve(_listeners.size());
+        for (auto& entry : _listeners) {
+            if (entry.second) {
+                alive.push_back(std::move(entry));
+            }
+        }
+        _listeners.swap(alive);
+        _hasRemoved = false;
+    }
+
+    T _value;
+    int _nextId;
+    int _notifying;
+    bool _hasRemoved;
+    std::vector<std::pair<int, Listener>> _listeners;
+};
+
+#endif // __OBSERVABLE_H__
@@ -0,0 +1,368 @@
+#include "ParticleEffectPool.h"
+#include "json/document.h"
+#include "json/error/en.h"
+#include <algorithm>
+#include <cstring>
+#include "./Resources/ResourceLoader.h"
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
+
+USING_NS_CC;
+
+namespace {
+    const char* const PARTICLE_PRESET_PATH = "Configs/particles.json";
+
+    // 与ParticleEffect枚举顺序一致
+    const char* const EFFECT_NAMES[] = {
+        "cherry_explosion",
+        "mine_explosion",
+        "pea_hit",
+        "snow_pea_hit",
+        "fire_pea_hit"
+    };
+
+    float readFloat(const rapidjson::Value& item, const char* key, float defaultValue)
+    {
+        if (item.HasMember(key) && item[key].IsNumber())
+        {
+            return item[key].GetFloat();
+        }
+        return defaultValue;
+    }
+
+    // 颜色为[r, g, b, a]数组（0~1）
+    Color4F readColor(const rapidjson::Value& item, const char* key, const Color4F& defaultValue)
+    {
+        if (!item.HasMember(key) || !item[key].IsArray() || item[key].Size() != 4)
+        {
+            return defaultValue;
+        }
+        const rapidjson::Value& color = item[key];
+        for (rapidjson::SizeType i = 0; i < 4; i++)
+        {
+            if (!color[i].IsNumber())
+            {
+                return defaultValue;
+            }
+        }
+        return Color4F(color[0].GetFloat(), color[1].GetFloat(), color[2].GetFloat(), color[3].GetFloat());
+    }
+}
+
+ParticleEffectPool* ParticleEffectPool::_instance = nullptr;
+
+ParticleEffectPool* ParticleEffectPool::getInstance()
+{
+    if (_instance == nullptr)
+    {
+        _instance = new ParticleEffectPool();
+    }
+    return _instance;
+}
+
+ParticleEffectPool::ParticleEffectPool()
+    : _presetsLoaded(false)
+    , _additive(false)
+    , _layer(nullptr)
+    , _zOrder(0)
+    , _texture(nullptr)
+{
+    for (auto& slot : _slots)
+    {
+        slot.preset.loaded = false;
+    }
+    resetStats();
+}
+
+ParticleEffectPool::~ParticleEffectPool()
+{
+    clear();
+    CC_SAFE_RELEASE_NULL(_texture);
+    _instance = nullptr;
+}
+
+bool ParticleEffectPool::loadPresets()
+{
+    PVZ_PROFILE_ZONE("ParticleEffectPool::loadPresets");
+
+    std::string text = FileUtils::getInstance()->getStringFromFile(PARTICLE_PRESET_PATH);
+    if (text.empty())
+    {
+        PVZ_LOGE(LogCategory::RESOURCE, "ParticleEffectPool: %s not found", PARTICLE_PRESET_PATH);
+        return false;
+    }
+
+    rapidjson::Document document;
+    document.Parse<rapidjson::kParseCommentsFlag>(text.c_str(), text.size());
+    if (document.HasParseError())
+    {
+        PVZ_LOGE(LogCategory::RESOURCE, "ParticleEffectPool: JSON parse error at offset %d: %s",
+            (int)document.GetErrorOffset(), rapidjson::GetParseError_En(document.GetParseError()));
+        return false;
+    }
+    if (!document.IsObject() || !document.HasMember("presets") || !document["presets"].IsArray())
+    {
+        PVZ_LOGE(LogCategory::RESOURCE, "ParticleEffectPool: missing \"presets\" array");
+        return false;
+    }
+
+    _frameName = document.HasMember("frame") && document["frame"].IsString() ? document["frame"].GetString() : "";
+    _additive = document.HasMember("additive") && document["additive"].IsBool() && document["additive"].GetBool();
+
+    const rapidjson::Value& presets = document["presets"];
+    for (rapidjson::SizeType i = 0; i < presets.Size(); i++)
+    {
+        const rapidjson::Value& item = presets[i];
+        if (!item.IsObject() || !item.HasMember("name") || !item["name"].IsString())
+        {
+            continue;
+        }
+
+        int index = -1;
+        for (int e = 0; e < (int)ParticleEffect::COUNT; e++)
+        {
+            if (strcmp(item["name"].GetString(), EFFECT_NAMES[e]) == 0)
+            {
+                index = e;
+                break;
+            }
+        }
+        if (index < 0)
+        {
+            PVZ_LOGW(LogCategory::RESOURCE, "ParticleEffectPool: unknown preset '%s'", item["name"].GetString());
+            continue;
+        }
+
+        // 未写的字段按ParticleExplosion的默认值
+        Preset& preset = _slots[index].preset;
+        preset.loaded = true;
+        preset.poolSize = std::max((int)readFloat(item, "poolSize", 2.0f), 0);
+        preset.totalParticles = std::max((int)readFloat(item, "totalParticles", 50.0f), 1);
+        preset.duration = std::max(readFloat(item, "duration", 0.1f), 0.01f);
+        preset.emissionRate = readFloat(item, "emissionRate", preset.totalParticles / preset.duration);
+        preset.speed = readFloat(item, "speed", 70.0f);
+        preset.speedVar = readFloat(item, "speedVar", 40.0f);
+        preset.life = readFloat(item, "life", 1.0f);
+        preset.lifeVar = readFloat(item, "lifeVar", 0.0f);
+        preset.angleVar = readFloat(item, "angleVar", 360.0f);
+        preset.startSize = readFloat(item, "startSize", 15.0f);
+        preset.startSizeVar = readFloat(item, "startSizeVar", 10.0f);
+        preset.endSize = readFloat(item, "endSize", (float)ParticleSystem::START_SIZE_EQUAL_TO_END_SIZE);
+        preset.startColor = readColor(item, "startColor", Color4F::WHITE);
+        preset.startColorVar = readColor(item, "startColorVar", Color4F(0.0f, 0.0f, 0.0f, 0.0f));
+        preset.endColor = readColor(item, "endColor", Color4F(1.0f, 1.0f, 1.0f, 0.0f));
+        preset.endColorVar = readColor(item, "endColorVar", Color4F(0.0f, 0.0f, 0.0f, 0.0f));
+    }
+
+    for (int e = 0; e < (int)ParticleEffect::COUNT; e++)
+    {
+        if (!_slots[e].preset.loaded)
+        {
+            PVZ_LOGW(LogCategory::RESOURCE, "ParticleEffectPool: preset '%s' missing, effect disabled", EFFECT_NAMES[e]);
+        }
+    }
+
+    _presetsLoaded = true;
+    return true;
+}
+
+void ParticleEffectPool::resolveTexture()
+{
+    if (_texture)
+    {
+        return;
+    }
+
+    // 共用的图集帧（projectiles图集常驻，粒子系统持有纹理引用，图集组被淘汰后也能继续画）
+    auto frame = _frameName.empty() ? nullptr : ResourceLoader::getInstance()->getSpriteFrame(_frameName);
+    if (frame && !frame->isRotated())
+    {
+        _texture = frame->getTexture();
+        _textureRect = frame->getRect();
+    }
+    else
+    {
+        // 找不到图集帧时退回cocos内置的粒子纹理，所有系统仍然共用这一张
+        PVZ_LOGW(LogCategory::RESOURCE, "ParticleEffectPool: frame '%s' unavailable, using built-in particle texture",
+            _frameName.c_str());
+        auto fallback = ParticleExplosion::createWithTotalParticles(1);
+        _texture = fallback ? fallback->getTexture() : nullptr;
+        _textureRect = _texture ? Rect(Vec2::ZERO, _texture->getContentSize()) : Rect::ZERO;
+    }
+    CC_SAFE_RETAIN(_texture);
+}
+
+void ParticleEffectPool::prewarm(Node* layer, int zOrder)
+{
+    PVZ_PROFILE_ZONE("ParticleEffectPool::prewarm");
+
+    if (_layer && _layer != layer)
+    {
+        clear();
+    }
+    if (!_presetsLoaded)
+    {
+        loadPresets();
+    }
+    resolveTexture();
+    if (!layer || !_texture)
+    {
+        return;
+    }
+
+    _layer = layer;
+    _zOrder = zOrder;
+
+    int created = 0;
+    for (auto& slot : _slots)
+    {
+        if (!slot.preset.loaded)
+        {
+            continue;
+        }
+        while ((int)slot.systems.size() < slot.preset.poolSize)
+        {
+            slot.systems.push_back(createSystem(slot.preset));
+            created++;
+        }
+        slot.stats.capacity = (int)slot.systems.size();
+    }
+
+    PVZ_LOGD(LogCategory::GAME, "ParticleEffectPool: Prewarmed %d particle systems", created);
+}
+
+ParticleSystemQuad* ParticleEffectPool::createSystem(const Preset& preset)
+{
+    auto system = ParticleSystemQuad::createWithTotalParticles(preset.totalParticles);
+    system->retain();
+
+    // 与ParticleExplosion相同的发射方式：原地向四周喷射、无重力
+    system->setEmitterMode(ParticleSystem::Mode::GRAVITY);
+    system->setGravity(Vec2::ZERO);
+    system->setRadialAccel(0.0f);
+    system->setRadialAccelVar(0.0f);
+    system->setTangentialAccel(0.0f);
+    system->setTangentialAccelVar(0.0f);
+    system->setAngle(90.0f);
+    system->setAngleVar(preset.angleVar);
+    system->setPosVar(Vec2::ZERO);
+    system->setPositionType(ParticleSystem::PositionType::FREE);
+
+    system->setDuration(preset.duration);
+    system->setEmissionRate(preset.emissionRate);
+    system->setSpeed(preset.speed);
+    system->setSpeedVar(preset.speedVar);
+    system->setLife(preset.life);
+    system->setLifeVar(preset.lifeVar);
+    system->setStartSize(preset.startSize);
+    system->setStartSizeVar(preset.startSizeVar);
+    system->setEndSize(preset.endSize);
+    system->setEndSizeVar(0.0f);
+    system->setStartColor(preset.startColor);
+    system->setStartColorVar(preset.startColorVar);
+    system->setEndColor(preset.endColor);
+    system->setEndColorVar(preset.endColorVar);
+
+    // 纹理和混合方式全池一致，材质相同才能合批
+    system->setTextureWithRect(_texture, _textureRect);
+    system->setBlendAdditive(_additive);
+    system->setAutoRemoveOnFinish(false);
+
+    // 空闲状态：不发射、没有粒子，draw时不提交渲染命令
+    system->stopSystem();
+    _layer->addChild(system, _zOrder);
+    return system;
+}
+
+void ParticleEffectPool::play(ParticleEffect effect, const Vec2& position)
+{
+    if (!_layer || effect == ParticleEffect::COUNT)
+    {
+        return;
+    }
+
+    Slot& slot = _slots[(int)effect];
+    if (!slot.preset.loaded)
+    {
+        return;
+    }
+
+    // 发射结束且粒子全部消失的系统即为空闲
+    ParticleSystemQuad* system = nullptr;
+    int inUse = 0;
+    for (auto candidate : slot.systems)
+    {
+        if (candidate->isActive() || candidate->getParticleCount() > 0)
+        {
+            inUse++;
+        }
+        else if (!system)
+        {
+            system = candidate;
+        }
+    }
+
+    if (!system)
+    {
+        // 池空时临时扩容，之后留在池中复用
+        system = createSystem(slot.preset);
+        slot.systems.push_back(system);
+        slot.stats.capacity = (int)slot.systems.size();
+        slot.stats.misses++;
+    }
+
+    system->setPosition(position);
+    system->resetSystem();
+
+    slot.stats.plays++;
+    slot.stats.inUse = inUse + 1;
+    slot.stats.highWater = std::max(slot.stats.highWater, slot.stats.inUse);
+}
+
+void ParticleEffectPool::detachLayer(Node* layer)
+{
+    if (_layer == layer)
+    {
+        logStats();
+        clear();
+        resetStats();
+    }
+}
+
+void ParticleEffectPool::clear()
+{
+    for (auto& slot : _slots)
+    {
+        for (auto system : slot.systems)
+        {
+            system->removeFromParent();
+            system->release();
+        }
+        slot.systems.clear();
+        slot.stats.capacity = 0;
+        slot.stats.inUse = 0;
+    }
+    _layer = nullptr;
+}
+
+void ParticleEffectPool::resetStats()
+{
+    for (auto& slot : _slots)
+    {
+        slot.stats.capacity = (int)slot.systems.size();
+        slot.stats.inUse = 0;
+        slot.stats.highWater = 0;
+        slot.stats.misses = 0;
+        slot.stats.plays = 0;
+    }
+}
+
+void ParticleEffectPool::logStats() const
+{
+    for (int e = 0; e < (int)ParticleEffect::COUNT; e++)
+    {
+        const Stats& stats = _slots[e].stats;
+        PVZ_LOGI(LogCategory::GAME, "ParticleEffectPool: %s - capacity %d, high water %d, misses %d, plays %d",
+            EFFECT_NAMES[e], stats.capacity, stats.highWater, stats.misses, stats.plays);
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+#ifndef __PARTICLE_EFFECT_POOL_H__
+#define __PARTICLE_EFFECT_POOL_H__
+
+#include "cocos2d.h"
+#include <string>
+#include <vector>
+
+// 粒子特效种类（预设名见Configs/particles.json）
+enum class ParticleEffect
+{
+    CHERRY_EXPLOSION,   // 樱桃炸弹爆炸
+    MINE_EXPLOSION,     // 土豆地雷爆炸
+    PEA_HIT,            // 豌豆击中
+    SNOW_PEA_HIT,       // 寒冰豌豆击中
+    FIRE_PEA_HIT,       // 火焰豌豆击中
+    COUNT
+};
+
+// ParticleEffectPool - 粒子特效对象池
+// 参数（粒子数、速度、寿命、颜色等）来自Configs/particles.json，不再在每次爆炸时create一个ParticleExplosion再逐项设置。
+// 关卡开始时每种特效按预设的poolSize预热粒子系统，隐藏地挂在特效层上；播放时取一个空闲的系统移到目标位置后resetSystem，
+// 播完（发射结束且粒子全部消失）自动变回空闲，不再RemoveSelf。
+// 所有预设共用同一张图集帧作纹理、同一种混合方式，同时播放的多个系统材质相同，渲染器可以合批。
+class ParticleEffectPool
+{
+public:
+    // 池统计（用于调整预热数量）
+    struct Stats
+    {
+        int capacity;       // 池中粒子系统总数
+        int inUse;          // 上次播放时正在播放的数量
+        int highWater;      // inUse的历史最大值
+        int misses;         // 没有空闲系统时临时创建的次数
+        int plays;          // 总播放次数
+    };
+
+    static ParticleEffectPool* getInstance();
+
+    // 读入粒子预设（首次预热时自动调用），失败时保留已有预设
+    bool loadPresets();
+
+    // 绑定特效层并按预设数量预热（已绑定其它层时先清空）
+    void prewarm(cocos2d::Node* layer, int zOrder);
+
+    // 在position（特效层坐标）播放一次特效，池未绑定特效层时忽略
+    void play(ParticleEffect effect, const cocos2d::Vec2& position);
+
+    // 层被销毁前调用：释放所有粒子系统并解除绑定（只处理绑定在该层上的情况）
+    void detachLayer(cocos2d::Node* layer);
+
+    const Stats& getStats(ParticleEffect effect) const { return _slots[(int)effect].stats; }
+    void resetStats();
+    void logStats() const;
+
+private:
+    ParticleEffectPool();
+    ~ParticleEffectPool();
+
+    // 禁止复制
+    ParticleEffectPool(const ParticleEffectPool&) = delete;
+    ParticleEffectPool& operator=(const ParticleEffectPool&) = delete;
+
+    struct Preset
+    {
+        bool loaded;
+        int poolSize;
+        int totalParticles;
+        float duration;
+        float emissionRate;
+        float speed;
+        float speedVar;
+        float life;
+        float lifeVar;
+        float angleVar;
+        float startSize;
+        float startSizeVar;
+        float endSize;
+        cocos2d::Color4F startColor;
+        cocos2d::Color4F startColorVar;
+        cocos2d::Color4F endColor;
+        cocos2d::Color4F endColorVar;
+    };
+
+    struct Slot
+    {
+        Preset preset;
+        std::vector<cocos2d::ParticleSystemQuad*> systems;  // 持有引用
+        Stats stats;
+    };
+
+    cocos2d::ParticleSystemQuad* createSystem(const Preset& preset);
+    void resolveTexture();
+    void clear();
+
+    static ParticleEffectPool* _instance;
+
+    Slot _slots[(int)ParticleEffect::COUNT];
+    bool _presetsLoaded;
+    std::string _frameName;                 // 共用的图集帧
+    bool _additive;
+
+    cocos2d::Node* _layer;
+    int _zOrder;
+    cocos2d::Texture2D* _texture;           // 持有引用
+    cocos2d::Rect _textureRect;
+};
+
+#endif // __PARTICLE_EFFECT_POOL_H__
@@ -0,0 +1,401 @@
+#include "PerfOverlay.h"
+#include <algorithm>
+#include "./Game/GameManager.h"
+#include "./Game/WaveManager.h"
+#include "./Game/SunManager.h"
+#include "./Game/EntityLayers.h"
+#include "./Game/SpriteAnimator.h"
+#include "./Game/ParticleEffectPool.h"
+#include "./Game/FrameProfiler.h"
+#include "./Entities/Zombie/ZombiePool.h"
+#include "./Resources/ResourceLoader.h"
+
+USING_NS_CC;
+
+namespace {
+    const float REFRESH_INTERVAL = 0.5f;    // 文字和曲线的刷新间隔（秒）
+    const int GRAPH_SAMPLES = 120;          // 曲线显示的帧数
+    const float GRAPH_WIDTH = 240.0f;
+    const float GRAPH_HEIGHT = 60.0f;
+    const float GRAPH_MAX_MS = 50.0f;       // 曲线顶部对应的帧耗时
+    const float PADDING = 6.0f;
+
+    const float NS_PER_MS = 1000000.0f;
+
+    const ZombieType ZOMBIE_POOL_TYPES[] = { ZombieType::NORMAL, ZombieType::CONEHEAD, ZombieType::BUCKETHEAD };
+    const ProjectileType PROJECTILE_POOL_TYPES[] = { ProjectileType::PEA, ProjectileType::SNOW_PEA };
+}
+
+PerfOverlay::PerfOverlay()
+    : _shown(false)
+    , _refreshTimer(0.0f)
+    , _background(nullptr)
+    , _label(nullptr)
+    , _graph(nullptr)
+    , _beforeDrawListener(nullptr)
+    , _afterDrawListener(nullptr)
+    , _lastFrameEnd(0)
+    , _drawStart(0)
+    , _pendingSimNs(0)
+    , _pendingSimSteps(0)
+    , _lastSimSteps(0)
+    , _lastDrawCalls(0)
+    , _lastVertices(0)
+    , _particleCapacity(0)
+    , _particleHighWater(0)
+    , _textureCount(0)
+    , _predictedBatches(0)
+    , _sampleHead(0)
+    , _sampleCount(0)
+    , _wave(0)
+    , _hasBaseline(false)
+{
+    std::fill(std::begin(_values), std::end(_values), 0);
+    std::fill(std::begin(_baseline), std::end(_baseline), 0);
+}
+
+bool PerfOverlay::init()
+{
+    if (!Node::init())
+    {
+        return false;
+    }
+
+    _samples.resize(GRAPH_SAMPLES);
+
+    _background = LayerColor::create(Color4B(0, 0, 0, 170));
+    this->addChild(_background, 0);
+
+    _graph = DrawNode::create();
+    _graph->setPosition(Vec2(PADDING, PADDING));
+    this->addChild(_graph, 1);
+
+    _label = Label::createWithTTF("", "fonts/arial.ttf", 12);
+    _label->setAnchorPoint(Vec2(0.0f, 0.0f));
+    _label->setAlignment(TextHAlignment::LEFT);
+    _label->setPosition(Vec2(PADDING, PADDING * 2 + GRAPH_HEIGHT));
+    this->addChild(_label, 1);
+
+    this->setVisible(false);
+    return true;
+}
+
+void PerfOverlay::onEnter()
+{
+    Node::onEnter();
+
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    _beforeDrawListener = dispatcher->addCustomEventListener(Director::EVENT_BEFORE_DRAW, [this](EventCustom*) {
+        onBeforeDraw();
+    });
+    _afterDrawListener = dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW, [this](EventCustom*) {
+        onAfterDraw();
+    });
+    this->scheduleUpdate();
+}
+
+void PerfOverlay::onExit()
+{
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    if (_beforeDrawListener)
+    {
+        dispatcher->removeEventListener(_beforeDrawListener);
+        _beforeDrawListener = nullptr;
+    }
+    if (_afterDrawListener)
+    {
+        dispatcher->removeEventListener(_afterDrawListener);
+        _afterDrawListener = nullptr;
+    }
+    this->unscheduleUpdate();
+
+    Node::onExit();
+}
+
+void PerfOverlay::setShown(bool shown)
+{
+    if (_shown == shown)
+    {
+        return;
+    }
+    _shown = shown;
+    this->setVisible(shown);
+
+    // 重新显示时从空曲线开始，隐藏期间的帧不采样
+    _sampleHead = 0;
+    _sampleCount = 0;
+    _lastFrameEnd = 0;
+    _pendingSimNs = 0;
+    _pendingSimSteps = 0;
+    if (shown)
+    {
+        refresh();
+    }
+}
+
+void PerfOverlay::recordSimTime(uint64_t nanoseconds, int steps)
+{
+    if (_shown)
+    {
+        _pendingSimNs += nanoseconds;
+        _pendingSimSteps += steps;
+    }
+}
+
+void PerfOverlay::markWave(int wave)
+{
+    _wave = wave;
+    // 只取计数作为基准，文字和曲线留到显示时再刷新
+    collectCounters();
+    std::copy(std::begin(_values), std::end(_values), std::begin(_baseline));
+    _hasBaseline = true;
+}
+
+void PerfOverlay::onBeforeDraw()
+{
+    if (_shown)
+    {
+        _drawStart = FrameProfiler::now();
+    }
+}
+
+void PerfOverlay::onAfterDraw()
+{
+    // 渲染器在每帧开始时清零，这里读到的是本帧提交的批次（显示时含面板自身）；
+    // 隐藏时也记录，每波的基准才是真实值
+    auto renderer = Director::getInstance()->getRenderer();
+    _lastDrawCalls = (int)renderer->getDrawnBatches();
+    _lastVertices = (int)renderer->getDrawnVertices();
+
+    if (!_shown)
+    {
+        return;
+    }
+
+    uint64_t now = FrameProfiler::now();
+    if (_lastFrameEnd != 0 && _drawStart != 0)
+    {
+        FrameSample& sample = _samples[_sampleHead];
+        sample.frameMs = (now - _lastFrameEnd) / NS_PER_MS;
+        sample.simMs = _pendingSimNs / NS_PER_MS;
+        sample.renderMs = (now - _drawStart) / NS_PER_MS;
+        _sampleHead = (_sampleHead + 1) % GRAPH_SAMPLES;
+        _sampleCount = std::min(_sampleCount + 1, GRAPH_SAMPLES);
+    }
+    _lastFrameEnd = now;
+    _lastSimSteps = _pendingSimSteps;
+    _pendingSimNs = 0;
+    _pendingSimSteps = 0;
+}
+
+void PerfOverlay::update(float delta)
+{
+    if (!_shown)
+    {
+        return;
+    }
+
+    _refreshTimer += delta;
+    if (_refreshTimer >= REFRESH_INTERVAL)
+    {
+        _refreshTimer = 0.0f;
+        refresh();
+    }
+}
+
+std::string PerfOverlay::formatCounter(const char* name, Counter counter) const
+{
+    int value = _values[counter];
+    int delta = _hasBaseline ? value - _baseline[counter] : 0;
+    if (delta == 0)
+    {
+        return StringUtils::format("%s %d", name, value);
+    }
+    return StringUtils::format("%s %d (%+d)", name, value, delta);
+}
+
+int PerfOverlay::countNodes(Node* node) const
+{
+    int count = 1;
+    for (auto child : node->getChildren())
+    {
+        count += countNodes(child);
+    }
+    return count;
+}
+
+void PerfOverlay::collectCounters()
+{
+    PVZ_PROFILE_ZONE("PerfOverlay::collectCounters");
+
+    auto director = Director::getInstance();
+    auto waveManager = WaveManager::getInstance();
+    auto gameManager = GameManager::getInstance();
+    auto entityLayers = EntityLayers::getActive();
+
+    // 实体计数
+    _laneText.clear();
+    int zombies = 0;
+    for (int row = 0; row < WaveManager::LANE_COUNT; row++)
+    {
+        int laneCount = 0;
+        for (auto zombie : waveManager->getZombiesInRow(row))
+        {
+            if (zombie)
+            {
+                laneCount++;
+            }
+        }
+        zombies += laneCount;
+        _laneText += StringUtils::format(" %d", laneCount);
+    }
+
+    int plants = 0;
+    if (entityLayers)
+    {
+        for (int row = 0; row < entityLayers->getLaneCount(); row++)
+        {
+            plants += (int)entityLayers->getLaneLayer(EntityLayer::PLANT, row)->getChildrenCount();
+        }
+    }
+
+    // 对象池
+    _poolText.clear();
+    int poolMisses = 0;
+    for (auto type : PROJECTILE_POOL_TYPES)
+    {
+        const auto& stats = gameManager->getProjectilePool(type)->getStats();
+        _poolText += StringUtils::format(" %d/%d", stats.inUse, stats.capacity);
+        poolMisses += stats.misses;
+    }
+    _poolText += "  zombie";
+    if (auto zombiePool = waveManager->getZombiePool())
+    {
+        for (auto type : ZOMBIE_POOL_TYPES)
+        {
+            const auto& stats = zombiePool->getStats(type);
+            _poolText += StringUtils::format(" %d/%d", stats.inUse, stats.capacity);
+            poolMisses += stats.misses;
+        }
+    }
+    _particleCapacity = 0;
+    _particleHighWater = 0;
+    auto particlePool = ParticleEffectPool::getInstance();
+    for (int e = 0; e < (int)ParticleEffect::COUNT; e++)
+    {
+        const auto& stats = particlePool->getStats((ParticleEffect)e);
+        _particleCapacity += stats.capacity;
+        _particleHighWater += stats.highWater;
+        poolMisses += stats.misses;
+    }
+
+    // 纹理内存
+    size_t textureBytes = 0;
+    _textureCount = 0;
+    for (const auto& stat : ResourceLoader::getInstance()->getTextureMemoryStats())
+    {
+        textureBytes += stat.bytes;
+        _textureCount += stat.textureCount;
+    }
+
+    // EntityLayers按绘制顺序预计的批次
+    _predictedBatches = 0;
+    if (entityLayers)
+    {
+        std::vector<EntityLayers::LayerStats> layerStats;
+        entityLayers->collectBatchStats(layerStats);
+        for (const auto& stat : layerStats)
+        {
+            _predictedBatches += stat.batches;
+        }
+    }
+
+    _values[ZOMBIES] = zombies;
+    _values[PLANTS] = plants;
+    _values[PROJECTILES] = (int)gameManager->getProjectiles().size();
+    _values[SUNS] = SunManager::getInstance()->getActiveSunCount();
+    _values[NODES] = director->getRunningScene() ? countNodes(director->getRunningScene()) : 0;
+    _values[ACTIONS] = (int)director->getActionManager()->getNumberOfRunningActions();
+    _values[ANIM_TRACKS] = SpriteAnimator::getInstance()->getTrackCount();
+    _values[POOL_MISSES] = poolMisses;
+    _values[TEXTURE_KB] = (int)(textureBytes / 1024);
+    _values[DRAW_CALLS] = _lastDrawCalls;
+}
+
+void PerfOverlay::refresh()
+{
+    PVZ_PROFILE_ZONE("PerfOverlay::refresh");
+
+    collectCounters();
+
+    // 帧耗时：曲线窗口内的平均和最大值
+    float frameSum = 0.0f, frameMax = 0.0f, simSum = 0.0f, renderSum = 0.0f;
+    for (int i = 0; i < _sampleCount; i++)
+    {
+        const FrameSample& sample = _samples[i];
+        frameSum += sample.frameMs;
+        frameMax = std::max(frameMax, sample.frameMs);
+        simSum += sample.simMs;
+        renderSum += sample.renderMs;
+    }
+    float samples = (float)std::max(_sampleCount, 1);
+
+    std::string text;
+    text += StringUtils::format("wave %d   %s   lanes%s\n", _wave, formatCounter("zombies", ZOMBIES).c_str(), _laneText.c_str());
+    text += formatCounter("plants", PLANTS) + "   " + formatCounter("projectiles", PROJECTILES) + "   " + formatCounter("suns", SUNS) + "\n";
+    text += formatCounter("nodes", NODES) + "   " + formatCounter("actions", ACTIONS) + "   " + formatCounter("anim tracks", ANIM_TRACKS) + "\n";
+    text += StringUtils::format("pools pea/snow%s   particles %d (peak %d)   ", _poolText.c_str(), _particleCapacity, _particleHighWater);
+    text += formatCounter("misses", POOL_MISSES) + "\n";
+    text += formatCounter("texture KB", TEXTURE_KB) + StringUtils::format(" in %d", _textureCount) + "\n";
+    text += formatCounter("draw calls", DRAW_CALLS) + StringUtils::format("   verts %d   predicted batches %d\n", _lastVertices, _predictedBatches);
+    text += StringUtils::format("frame %.1f ms (max %.1f)   sim %.2f ms (%d ticks)   render %.2f ms",
+        frameSum / samples, frameMax, simSum / samples, _lastSimSteps, renderSum / samples);
+    _label->setString(text);
+
+    refreshGraph();
+
+    // 背景跟随文字大小
+    Size labelSize = _label->getContentSize();
+    float width = std::max(labelSize.width, GRAPH_WIDTH) + PADDING * 2;
+    float height = labelSize.height + GRAPH_HEIGHT + PADDING * 3;
+    _background->setContentSize(Size(width, height));
+    this->setContentSize(Size(width, height));
+}
+
+void PerfOverlay::refreshGraph()
+{
+    _graph->clear();
+
+    // 16.7ms（60fps）和33.3ms（30fps）参考线
+    float y60 = GRAPH_HEIGHT * (1000.0f / 60.0f) / GRAPH_MAX_MS;
+    float y30 = GRAPH_HEIGHT * (1000.0f / 30.0f) / GRAPH_MAX_MS;
+    _graph->drawRect(Vec2::ZERO, Vec2(GRAPH_WIDTH, GRAPH_HEIGHT), Color4F(1.0f, 1.0f, 1.0f, 0.3f));
+    _graph->drawLine(Vec2(0.0f, y60), Vec2(GRAPH_WIDTH, y60), Color4F(0.3f, 1.0f, 0.3f, 0.5f));
+    _graph->drawLine(Vec2(0.0f, y30), Vec2(GRAPH_WIDTH, y30), Color4F(1.0f, 0.8f, 0.2f, 0.5f));
+
+    // 从最旧到最新，每帧一根柱：整帧耗时按阈值着色，底部叠画逻辑步耗时
+    float barWidth = GRAPH_WIDTH / GRAPH_SAMPLES;
+    int oldest = (_sampleHead - _sampleCount + GRAPH_SAMPLES) % GRAPH_SAMPLES;
+    for (int i = 0; i < _sampleCount; i++)
+    {
+        const FrameSample& sample = _samples[(oldest + i) % GRAPH_SAMPLES];
+        float x = (GRAPH_SAMPLES - _sampleCount + i) * barWidth;
+        float frameHeight = std::min(sample.frameMs / GRAPH_MAX_MS, 1.0f) * GRAPH_HEIGHT;
+        float simHeight = std::min(sample.simMs / GRAPH_MAX_MS, 1.0f) * GRAPH_HEIGHT;
+
+        Color4F color(0.3f, 0.9f, 0.3f, 0.8f);
+        if (sample.frameMs > 1000.0f / 30.0f)
+        {
+            color = Color4F(1.0f, 0.3f, 0.3f, 0.9f);
+        }
+        else if (sample.frameMs > 1000.0f / 60.0f + 1.0f)
+        {
+            color = Color4F(1.0f, 0.8f, 0.2f, 0.9f);
+        }
+        _graph->drawSolidRect(Vec2(x, 0.0f), Vec2(x + barWidth, frameHeight), color);
+        if (simHeight > 0.0f)
+        {
+            _graph->drawSolidRect(Vec2(x, 0.0f), Vec2(x + barWidth, simHeight), Color4F(0.3f, 0.6f, 1.0f, 0.9f));
+        }
+    }
+}
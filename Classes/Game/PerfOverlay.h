@@ -0,0 +1,110 @@
+#pragma once
+#ifndef __PERF_OVERLAY_H__
+#define __PERF_OVERLAY_H__
+
+#include "cocos2d.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// PerfOverlay - 游戏场景的性能面板（F7切换显示）
+// 比cocos2d自带的FPS/draw call显示多了对局相关的计数：每行僵尸数、植物、子弹、阳光，场景节点数、运行中的Action数、
+// 帧动画轨道数，各对象池的占用和miss，纹理内存，渲染器实际提交的批次与EntityLayers预计的批次，
+// 逻辑步耗时与渲染耗时，以及最近若干帧的帧耗时曲线。
+// 每波开始时记下各计数的基准，面板上显示相对本波开始的增量，长局后期变卡时一眼能看出是哪个数在涨。
+// 隐藏时只记录每帧的批次数（每波的基准要用），不采样耗时、不刷新文字和曲线；显示时文字和曲线按固定间隔刷新。
+class PerfOverlay : public cocos2d::Node
+{
+public:
+    CREATE_FUNC(PerfOverlay);
+
+    virtual bool init() override;
+    virtual void onEnter() override;
+    virtual void onExit() override;
+    virtual void update(float delta) override;
+
+    void setShown(bool shown);
+    bool isShown() const { return _shown; }
+    void toggle() { setShown(!_shown); }
+
+    // GameScene每帧报告逻辑步的总耗时（纳秒）和步数
+    void recordSimTime(uint64_t nanoseconds, int steps);
+
+    // 新一波开始：记下当前各计数作为基准
+    void markWave(int wave);
+
+private:
+    // 显示增量的计数
+    enum Counter
+    {
+        ZOMBIES,
+        PLANTS,
+        PROJECTILES,
+        SUNS,
+        NODES,
+        ACTIONS,
+        ANIM_TRACKS,
+        POOL_MISSES,
+        TEXTURE_KB,
+        DRAW_CALLS,
+        COUNTER_COUNT
+    };
+
+    struct FrameSample
+    {
+        float frameMs;      // 两次AFTER_DRAW之间的墙钟时间
+        float simMs;        // 本帧逻辑步耗时
+        float renderMs;     // BEFORE_DRAW到AFTER_DRAW
+    };
+
+    PerfOverlay();
+
+    void onBeforeDraw();
+    void onAfterDraw();
+
+    // 收集各计数（不碰文字和曲线），每波开始时隐藏状态下也会调用
+    void collectCounters();
+    void refresh();
+    void refreshGraph();
+    std::string formatCounter(const char* name, Counter counter) const;
+    int countNodes(cocos2d::Node* node) const;
+
+    bool _shown;
+    float _refreshTimer;
+
+    cocos2d::LayerColor* _background;
+    cocos2d::Label* _label;
+    cocos2d::DrawNode* _graph;
+
+    cocos2d::EventListenerCustom* _beforeDrawListener;
+    cocos2d::EventListenerCustom* _afterDrawListener;
+
+    // 当前帧的采样
+    uint64_t _lastFrameEnd;
+    uint64_t _drawStart;
+    uint64_t _pendingSimNs;
+    int _pendingSimSteps;
+    int _lastSimSteps;
+    int _lastDrawCalls;
+    int _lastVertices;
+
+    // 只用于显示的统计（collectCounters填写）
+    std::string _laneText;
+    std::string _poolText;
+    int _particleCapacity;
+    int _particleHighWater;
+    int _textureCount;
+    int _predictedBatches;
+
+    // 帧耗时环形缓冲区
+    std::vector<FrameSample> _samples;
+    int _sampleHead;
+    int _sampleCount;
+
+    int _wave;
+    int _values[COUNTER_COUNT];
+    int _baseline[COUNTER_COUNT];
+    bool _hasBaseline;
+};
+
+#endif // __PERF_OVERLAY_H__
@@ -0,0 +1,783 @@
+#include "SimWorld.h"
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // 植物数值
+    const float SHOOTER_RANGE = 800.0f;        // 射手攻击范围
+    const float SHOOTER_INTERVAL = 4.0f;       // 射手攻击间隔（1 / 0.25）
+    const float LAUNCH_OFFSET_X = 30.0f;       // 子弹发射偏移
+    const float LAUNCH_OFFSET_Y = 55.0f;
+    const int SUN_VALUE = 25;
+    const float CHERRY_FUSE = 1.5f;
+    const float CHERRY_RANGE = 150.0f;
+    const int CHERRY_DAMAGE = 500;
+    const float MINE_ARM_TIME = 20.0f;
+    const float MINE_TRIGGER_RANGE = 30.0f;
+    const float MINE_RANGE = 80.0f;
+    const int MINE_DAMAGE = 200;
+
+    // 子弹数值
+    const float PROJECTILE_SPEED = 200.0f;
+    const int PROJECTILE_DAMAGE = 15;
+    const float PROJECTILE_LIFETIME = 4.0f;
+    const float FREEZE_DURATION = 2.5f;
+    const float PROJECTILE_HALF_WIDTH = 7.5f;  // 子弹半宽（15x8）
+
+    // 僵尸数值
+    const int ZOMBIE_HEALTH = 100;
+    const float ZOMBIE_SPEED = 20.0f;
+    const int ZOMBIE_DAMAGE = 20;
+    const float ZOMBIE_ATTACK_INTERVAL = 1.0f;
+    const float ZOMBIE_SPAWN_OFFSET = 20.0f;   // 距离右边缘的出生偏移
+    const float ZOMBIE_END_X = -50.0f;         // 到达终点的x坐标
+    const float ZOMBIE_LANE_OFFSET = 50.0f;    // 僵尸相对格子底边的y偏移
+    const float ZOMBIE_BODY_LEFT = 18.0f;      // 碰撞盒（60x100，锚点0.3）
+    const float ZOMBIE_BODY_RIGHT = 42.0f;
+    const float ZOMBIE_BITE_RANGE = 5.0f;
+    const float ZOMBIE_BITE_RANGE_FRONT = 25.0f;
+
+    // 阳光数值
+    const float SUN_LIFETIME = 10.5f;
+    const float RANDOM_SUN_LIFETIME = 15.5f;
+
+    const int PLANT_TYPE_COUNT = static_cast<int>(PlantType::POTATO_MINE) + 1;
+}
+
+SimWorld::SimWorld(const SimConfig& config)
+    : _config(config)
+{
+    reset();
+}
+
+void SimWorld::reset()
+{
+    _outcome = SimOutcome::RUNNING;
+    _time = 0.0f;
+    _tickCount = 0;
+    // 打散相邻种子，避免xorshift前几个输出高度相关
+    _rngState = _config.seed * 2654435761u ^ 0x9E3779B9u;
+    if (_rngState == 0) {
+        _rngState = 0x9E3779B9u;
+    }
+    nextRandom();
+    nextRandom();
+    _nextId = 1;
+    _sunCount = _config.startingSun;
+
+    _wavePhase = WavePhase::PREPARING;
+    _currentWave = 0;
+    _waveZombieCount = 0;
+    _zombiesSpawned = 0;
+    _zombiesKilled = 0;
+    _waveTimer = _config.preparationTime;
+    _spawnTimer = 0.0f;
+
+    _randomSunTimer = 0.0f;
+    _randomSunInterval = GameTuning::RANDOM_SUN_FIRST;
+
+    _cooldowns.assign(PLANT_TYPE_COUNT, 0.0f);
+
+    _plants.clear();
+    _zombies.clear();
+    _projectiles.clear();
+    _suns.clear();
+    _gridPlants.assign(_config.rows * _config.cols, 0);
+}
+
+void SimWorld::reset(uint32_t seed)
+{
+    _config.seed = seed;
+    reset();
+}
+
+// ===================================================================
+// 主循环
+// ===================================================================
+
+void SimWorld::tick(float delta)
+{
+    if (_outcome != SimOutcome::RUNNING || delta <= 0.0f) {
+        return;
+    }
+
+    PVZ_PROFILE_ZONE("SimWorld::tick");
+
+    _time += delta;
+    _tickCount++;
+
+    for (float& cooldown : _cooldowns) {
+        cooldown = std::max(0.0f, cooldown - delta);
+    }
+
+    // 生成
+    {
+        PVZ_PROFILE_ZONE("Sim::spawn");
+        updateWaves(delta);
+        updateRandomSun(delta);
+    }
+    // 移动
+    {
+        PVZ_PROFILE_ZONE("Sim::move");
+        moveZombies(delta);
+        moveProjectiles(delta);
+    }
+    // 索敌
+    {
+        PVZ_PROFILE_ZONE("Sim::target");
+        targetZombies();
+    }
+    // 开火
+    {
+        PVZ_PROFILE_ZONE("Sim::fire");
+        updatePlants(delta);
+    }
+    // 碰撞
+    {
+        PVZ_PROFILE_ZONE("Sim::collide");
+        collideProjectiles();
+    }
+    // 结算伤害
+    {
+        PVZ_PROFILE_ZONE("Sim::damage");
+        attackZombies(delta);
+    }
+    // 清理
+    {
+        PVZ_PROFILE_ZONE("Sim::cleanup");
+        updateSuns(delta);
+        cleanup();
+    }
+
+    // 所有波次结束且场上没有僵尸 -> 胜利
+    if (_outcome == SimOutcome::RUNNING &&
+        _wavePhase == WavePhase::FINISHED && _zombies.empty()) {
+        _outcome = SimOutcome::WON;
+    }
+}
+
+// ===================================================================
+// 波次
+// ===================================================================
+
+void SimWorld::updateWaves(float delta)
+{
+    switch (_wavePhase) {
+    case WavePhase::PREPARING:
+    case WavePhase::BETWEEN_WAVES:
+        _waveTimer -= delta;
+        if (_waveTimer <= 0.0f) {
+            startWave(_currentWave + 1);
+        }
+        break;
+
+    case WavePhase::SPAWNING:
+        if (_zombiesSpawned < _waveZombieCount) {
+            _spawnTimer += delta;
+            if (_spawnTimer >= GameTuning::SPAWN_INTERVAL) {
+                _spawnTimer = 0.0f;
+                spawnZombie();
+            }
+        }
+        else if (_zombies.empty()) {
+            emit(SimEventType::WAVE_COMPLETED, 0, -1, -1, 0.0f, 0.0f);
+            if (_currentWave >= _config.totalWaves) {
+                _wavePhase = WavePhase::FINISHED;
+            }
+            else {
+                _wavePhase = WavePhase::BETWEEN_WAVES;
+                _waveTimer = _config.waveDelay;
+            }
+        }
+        break;
+
+    case WavePhase::FINISHED:
+        break;
+    }
+}
+
+void SimWorld::startWave(int waveNumber)
+{
+    _currentWave = waveNumber;
+    _waveZombieCount = GameTuning::waveZombieCount(waveNumber);
+    _zombiesSpawned = 0;
+    _spawnTimer = GameTuning::SPAWN_INTERVAL;  // 开波立即出第一只
+    _wavePhase = WavePhase::SPAWNING;
+
+    emit(SimEventType::WAVE_STARTED, 0, -1, -1, 0.0f, 0.0f);
+}
+
+void SimWorld::spawnZombie()
+{
+    // 与WaveManager::spawnRandomZombie的类型概率一致
+    int roll = static_cast<int>(nextRandom() % 100) + std::min(0, (_currentWave - 4) * 10);
+    ZombieType type = ZombieType::NORMAL;
+    if (roll > 90) {
+        type = ZombieType::BUCKETHEAD;
+    }
+    else if (roll > 60) {
+        type = ZombieType::CONEHEAD;
+    }
+
+    SimZombie zombie;
+    zombie.id = _nextId++;
+    zombie.type = type;
+    zombie.row = static_cast<int>(nextRandom() % _config.rows);
+    zombie.x = _config.worldWidth - ZOMBIE_SPAWN_OFFSET;
+    zombie.y = laneY(zombie.row);
+    zombie.health = ZOMBIE_HEALTH;
+    zombie.armor = type == ZombieType::CONEHEAD ? 100 : (type == ZombieType::BUCKETHEAD ? 200 : 0);
+    zombie.damage = type == ZombieType::BUCKETHEAD ? 25 : ZOMBIE_DAMAGE;
+    zombie.speed = ZOMBIE_SPEED;
+    zombie.attackTimer = 0.0f;
+    zombie.freezeTimer = 0.0f;
+    zombie.targetPlantId = 0;
+    zombie.attacking = false;
+    zombie.alive = true;
+    _zombies.push_back(zombie);
+    _zombiesSpawned++;
+
+    emit(SimEventType::ZOMBIE_SPAWNED, zombie.id, zombie.row, -1, zombie.x, zombie.y);
+}
+
+// ===================================================================
+// 阳光
+// ===================================================================
+
+void SimWorld::updateRandomSun(float delta)
+{
+    _randomSunTimer += delta;
+    if (_randomSunTimer < _randomSunInterval) {
+        return;
+    }
+    _randomSunTimer = 0.0f;
+    _randomSunInterval = GameTuning::RANDOM_SUN_MIN + nextRandom01() * GameTuning::RANDOM_SUN_VAR;
+
+    float x = _config.originX + nextRandom01() * (_config.cols * _config.cellWidth);
+    float y = _config.originY + nextRandom01() * (_config.rows * _config.cellHeight);
+    spawnSun(x, y, RANDOM_SUN_LIFETIME);
+}
+
+void SimWorld::spawnSun(float x, float y, float lifeTime)
+{
+    SimSun sun;
+    sun.id = _nextId++;
+    sun.x = x;
+    sun.y = y;
+    sun.value = SUN_VALUE;
+    sun.lifeTime = lifeTime;
+    sun.alive = true;
+    _suns.push_back(sun);
+
+    emit(SimEventType::SUN_SPAWNED, sun.id, -1, -1, x, y);
+
+    if (_config.autoCollectSun) {
+        collectSun(sun.id);
+    }
+}
+
+void SimWorld::updateSuns(float delta)
+{
+    for (auto& sun : _suns) {
+        if (!sun.alive) continue;
+        sun.lifeTime -= delta;
+        if (sun.lifeTime <= 0.0f) {
+            sun.alive = false;
+            emit(SimEventType::SUN_EXPIRED, sun.id, -1, -1, sun.x, sun.y);
+        }
+    }
+}
+
+bool SimWorld::collectSun(uint32_t sunId)
+{
+    for (auto& sun : _suns) {
+        if (sun.id == sunId && sun.alive) {
+            sun.alive = false;
+            _sunCount += sun.value;
+            emit(SimEventType::SUN_COLLECTED, sun.id, -1, -1, sun.x, sun.y);
+            return true;
+        }
+    }
+    return false;
+}
+
+int SimWorld::collectAllSuns()
+{
+    int collected = 0;
+    for (auto& sun : _suns) {
+        if (sun.alive) {
+            sun.alive = false;
+            _sunCount += sun.value;
+            collected += sun.value;
+            emit(SimEventType::SUN_COLLECTED, sun.id, -1, -1, sun.x, sun.y);
+        }
+    }
+    return collected;
+}
+
+// ===================================================================
+// 植物
+// ===================================================================
+
+void SimWorld::updatePlants(float delta)
+{
+    // 射击/爆炸会向容器追加元素，按下标遍历
+    for (size_t i = 0; i < _plants.size(); i++) {
+        if (!_plants[i].alive) continue;
+
+        SimPlant& plant = _plants[i];
+        switch (plant.type) {
+        case PlantType::PEASHOOTER:
+        case PlantType::SNOW_PEA:
+            plant.attackTimer += delta;
+            if (plant.attackTimer >= SHOOTER_INTERVAL && hasZombieAhead(plant, SHOOTER_RANGE)) {
+                plant.attackTimer = 0.0f;
+                fireProjectile(_plants[i]);
+            }
+            break;
+
+        case PlantType::SUNFLOWER:
+            plant.produceTimer += delta;
+            if (plant.produceTimer >= GameTuning::SUNFLOWER_INTERVAL) {
+                plant.produceTimer = 0.0f;
+                spawnSun(plant.x, plant.y, SUN_LIFETIME);
+            }
+            break;
+
+        case PlantType::CHERRY_BOMB:
+            plant.fuseTimer += delta;
+            if (plant.fuseTimer >= CHERRY_FUSE) {
+                explode(plant, CHERRY_RANGE, CHERRY_DAMAGE, false);
+            }
+            break;
+
+        case PlantType::POTATO_MINE:
+            if (!plant.armed) {
+                plant.fuseTimer += delta;
+                if (plant.fuseTimer >= MINE_ARM_TIME) {
+                    plant.armed = true;
+                }
+            }
+            else {
+                for (const auto& zombie : _zombies) {
+                    if (zombie.alive && zombie.row == plant.row &&
+                        std::fabs(zombie.x - plant.x) <= MINE_TRIGGER_RANGE) {
+                        explode(plant, MINE_RANGE, MINE_DAMAGE, true);
+                        break;
+                    }
+                }
+            }
+            break;
+
+        case PlantType::WALLNUT:
+            break;
+        }
+    }
+}
+
+bool SimWorld::hasZombieAhead(const SimPlant& plant, float range) const
+{
+    for (const auto& zombie : _zombies) {
+        if (zombie.alive && zombie.row == plant.row &&
+            zombie.x > plant.x && zombie.x - plant.x <= range) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SimWorld::fireProjectile(const SimPlant& plant)
+{
+    SimProjectile projectile;
+    projectile.id = _nextId++;
+    projectile.type = plant.type == PlantType::SNOW_PEA ? ProjectileType::SNOW_PEA : ProjectileType::PEA;
+    projectile.row = plant.row;
+    projectile.x = plant.x + LAUNCH_OFFSET_X;
+    projectile.y = plant.y + LAUNCH_OFFSET_Y;
+    projectile.prevX = projectile.x;
+    projectile.velocityX = PROJECTILE_SPEED;
+    projectile.damage = PROJECTILE_DAMAGE;
+    projectile.lifeTime = PROJECTILE_LIFETIME;
+    projectile.alive = true;
+    _projectiles.push_back(projectile);
+
+    emit(SimEventType::PROJECTILE_FIRED, projectile.id, projectile.row, -1, projectile.x, projectile.y);
+}
+
+void SimWorld::explode(const SimPlant& plant, float range, int damage, bool sameRowOnly)
+{
+    emit(SimEventType::EXPLOSION, plant.id, plant.row, plant.col, plant.x, plant.y);
+
+    for (auto& zombie : _zombies) {
+        if (!zombie.alive) continue;
+        if (sameRowOnly && zombie.row != plant.row) continue;
+
+        float dx = zombie.x - plant.x;
+        float dy = zombie.y - plant.y;
+        if (dx * dx + dy * dy <= range * range) {
+            damageZombie(zombie, damage);
+        }
+    }
+
+    // 爆炸类植物一次性使用
+    for (auto& target : _plants) {
+        if (target.id == plant.id && target.alive) {
+            damagePlant(target, target.health);
+            break;
+        }
+    }
+}
+
+void SimWorld::damagePlant(SimPlant& plant, int damage)
+{
+    if (!plant.alive) return;
+
+    plant.health -= damage;
+    if (plant.health <= 0) {
+        plant.alive = false;
+        _gridPlants[plant.row * _config.cols + plant.col] = 0;
+        emit(SimEventType::PLANT_DIED, plant.id, plant.row, plant.col, plant.x, plant.y);
+    }
+}
+
+// ===================================================================
+// 子弹
+// ===================================================================
+
+void SimWorld::moveProjectiles(float delta)
+{
+    for (auto& projectile : _projectiles) {
+        if (!projectile.alive) continue;
+
+        projectile.prevX = projectile.x;
+        projectile.x += projectile.velocityX * delta;
+        projectile.lifeTime -= delta;
+    }
+}
+
+void SimWorld::collideProjectiles()
+{
+    _broadphase.reset(_config.rows);
+
+    for (size_t i = 0; i < _zombies.size(); i++) {
+        const SimZombie& zombie = _zombies[i];
+        if (zombie.alive) {
+            _broadphase.addBody(zombie.row, zombie.x - ZOMBIE_BODY_LEFT, zombie.x + ZOMBIE_BODY_RIGHT,
+                static_cast<uint32_t>(i));
+        }
+    }
+
+    // 用本帧位移做扫掠检测（本帧新发射的子弹起点即终点）
+    for (size_t i = 0; i < _projectiles.size(); i++) {
+        const SimProjectile& projectile = _projectiles[i];
+        if (projectile.alive) {
+            _broadphase.addSweep(projectile.row, projectile.prevX, projectile.x, PROJECTILE_HALF_WIDTH,
+                static_cast<uint32_t>(i));
+        }
+    }
+
+    // 命中按子弹分组、组内按进入先后排序；前面的僵尸已死时顺延到下一个
+    const auto& hits = _broadphase.solve();
+    for (const auto& hit : hits) {
+        SimProjectile& projectile = _projectiles[hit.sweepId];
+        SimZombie& zombie = _zombies[hit.bodyId];
+        if (!projectile.alive || !zombie.alive) continue;
+
+        projectile.alive = false;
+        projectile.x = hit.hitX;
+        emit(SimEventType::PROJECTILE_HIT, projectile.id, projectile.row, -1, projectile.x, projectile.y);
+
+        damageZombie(zombie, projectile.damage);
+        if (projectile.type == ProjectileType::SNOW_PEA && zombie.alive) {
+            zombie.freezeTimer = FREEZE_DURATION;
+        }
+    }
+
+    for (auto& projectile : _projectiles) {
+        if (!projectile.alive) continue;
+
+        if (projectile.lifeTime <= 0.0f || projectile.x > _config.worldWidth + 100.0f) {
+            projectile.alive = false;
+            emit(SimEventType::PROJECTILE_EXPIRED, projectile.id, projectile.row, -1, projectile.x, projectile.y);
+        }
+    }
+}
+
+// ===================================================================
+// 僵尸
+// ===================================================================
+
+void SimWorld::moveZombies(float delta)
+{
+    for (auto& zombie : _zombies) {
+        if (!zombie.alive) continue;
+
+        float speedScale = 1.0f;
+        if (zombie.freezeTimer > 0.0f) {
+            zombie.freezeTimer -= delta;
+            speedScale = 0.5f;
+        }
+
+        // 攻击中的僵尸不移动
+        if (zombie.attacking) continue;
+
+        zombie.x -= zombie.speed * speedScale * delta;
+        if (zombie.x < ZOMBIE_END_X) {
+            zombie.alive = false;
+            emit(SimEventType::ZOMBIE_REACHED_END, zombie.id, zombie.row, -1, zombie.x, zombie.y);
+            _outcome = SimOutcome::LOST;
+        }
+    }
+}
+
+void SimWorld::targetZombies()
+{
+    for (auto& zombie : _zombies) {
+        if (!zombie.alive) continue;
+
+        SimPlant* plant = findPlantInFront(zombie);
+        zombie.targetPlantId = plant ? plant->id : 0;
+        zombie.attacking = plant != nullptr;
+    }
+}
+
+void SimWorld::attackZombies(float delta)
+{
+    for (auto& zombie : _zombies) {
+        if (!zombie.alive || !zombie.attacking) continue;
+
+        SimPlant* plant = findPlant(zombie.targetPlantId);
+        if (!plant || !plant->alive) continue;
+
+        zombie.attackTimer += delta;
+        if (zombie.attackTimer >= ZOMBIE_ATTACK_INTERVAL) {
+            zombie.attackTimer = 0.0f;
+            damagePlant(*plant, zombie.damage);
+        }
+    }
+}
+
+SimPlant* SimWorld::findPlantInFront(const SimZombie& zombie)
+{
+    int row = 0;
+    int col = 0;
+    if (!worldToGrid(zombie.x, cellCenterY(zombie.row), row, col)) {
+        return nullptr;
+    }
+
+    // 当前格子
+    SimPlant* plant = findPlant(_gridPlants[row * _config.cols + col]);
+    if (plant && plant->alive && std::fabs(plant->x - zombie.x) <= ZOMBIE_BITE_RANGE) {
+        return plant;
+    }
+
+    // 前方格子（左侧），检测范围稍大
+    if (col > 0) {
+        plant = findPlant(_gridPlants[row * _config.cols + col - 1]);
+        if (plant && plant->alive && std::fabs(plant->x - zombie.x) <= ZOMBIE_BITE_RANGE_FRONT) {
+            return plant;
+        }
+    }
+    return nullptr;
+}
+
+SimPlant* SimWorld::findPlant(uint32_t plantId)
+{
+    if (plantId == 0) {
+        return nullptr;
+    }
+
+    for (auto& plant : _plants) {
+        if (plant.id == plantId) {
+            return &plant;
+        }
+    }
+    return nullptr;
+}
+
+void SimWorld::damageZombie(SimZombie& zombie, int damage)
+{
+    if (!zombie.alive) return;
+
+    if (zombie.armor > 0) {
+        int absorbed = std::min(zombie.armor, damage);
+        zombie.armor -= absorbed;
+        damage -= absorbed;
+    }
+
+    zombie.health -= damage;
+    if (zombie.health <= 0) {
+        zombie.alive = false;
+        _zombiesKilled++;
+        emit(SimEventType::ZOMBIE_DIED, zombie.id, zombie.row, -1, zombie.x, zombie.y);
+    }
+}
+
+// ===================================================================
+// 清理
+// ===================================================================
+
+void SimWorld::cleanup()
+{
+    _plants.erase(std::remove_if(_plants.begin(), _plants.end(),
+        [](const SimPlant& p) { return !p.alive; }), _plants.end());
+    _zombies.erase(std::remove_if(_zombies.begin(), _zombies.end(),
+        [](const SimZombie& z) { return !z.alive; }), _zombies.end());
+    _projectiles.erase(std::remove_if(_projectiles.begin(), _projectiles.end(),
+        [](const SimProjectile& p) { return !p.alive; }), _projectiles.end());
+    _suns.erase(std::remove_if(_suns.begin(), _suns.end(),
+        [](const SimSun& s) { return !s.alive; }), _suns.end());
+}
+
+// ===================================================================
+// 种植
+// ===================================================================
+
+bool SimWorld::canPlantAt(int row, int col) const
+{
+    if (row < 0 || row >= _config.rows || col < 0 || col >= _config.cols) {
+        return false;
+    }
+    return _gridPlants[row * _config.cols + col] == 0;
+}
+
+bool SimWorld::placePlant(PlantType type, int row, int col)
+{
+    if (_outcome != SimOutcome::RUNNING || !canPlantAt(row, col)) {
+        return false;
+    }
+
+    int cost = plantSunCost(type);
+    if (_sunCount < cost || getCooldownRemaining(type) > 0.0f) {
+        return false;
+    }
+
+    SimPlant plant;
+    plant.id = _nextId++;
+    plant.type = type;
+    plant.row = row;
+    plant.col = col;
+    plant.x = cellCenterX(col);
+    plant.y = cellCenterY(row);
+    plant.health = plantHealth(type);
+    plant.attackTimer = 0.0f;
+    plant.produceTimer = 0.0f;
+    plant.fuseTimer = 0.0f;
+    plant.armed = false;
+    plant.alive = true;
+    _plants.push_back(plant);
+
+    _gridPlants[row * _config.cols + col] = plant.id;
+    _sunCount -= cost;
+    _cooldowns[cooldownIndex(type)] = plantCooldown(type);
+
+    emit(SimEventType::PLANT_PLACED, plant.id, row, col, plant.x, plant.y);
+    return true;
+}
+
+float SimWorld::getCooldownRemaining(PlantType type) const
+{
+    return _cooldowns[cooldownIndex(type)];
+}
+
+const SimPlant* SimWorld::getPlantAt(int row, int col) const
+{
+    if (!canPlantAt(row, col) && row >= 0 && row < _config.rows && col >= 0 && col < _config.cols) {
+        uint32_t plantId = _gridPlants[row * _config.cols + col];
+        for (const auto& plant : _plants) {
+            if (plant.id == plantId) {
+                return &plant;
+            }
+        }
+    }
+    return nullptr;
+}
+
+int SimWorld::cooldownIndex(PlantType type) const
+{
+    return static_cast<int>(type);
+}
+
+int SimWorld::plantSunCost(PlantType type)
+{
+    return GameTuning::plantSunCost(type);
+}
+
+float SimWorld::plantCooldown(PlantType type)
+{
+    return GameTuning::plantCooldown(type);
+}
+
+int SimWorld::plantHealth(PlantType type)
+{
+    switch (type) {
+    case PlantType::WALLNUT:     return 400;
+    default:                     return 100;
+    }
+}
+
+// ===================================================================
+// 坐标
+// ===================================================================
+
+float SimWorld::laneY(int row) const
+{
+    return _config.originY + row * _config.cellHeight + ZOMBIE_LANE_OFFSET;
+}
+
+float SimWorld::cellCenterX(int col) const
+{
+    return _config.originX + col * _config.cellWidth + _config.cellWidth / 2;
+}
+
+float SimWorld::cellCenterY(int row) const
+{
+    return _config.originY + row * _config.cellHeight + _config.cellHeight / 3;
+}
+
+bool SimWorld::worldToGrid(float x, float y, int& outRow, int& outCol) const
+{
+    float localX = x - _config.originX;
+    float localY = y - _config.originY;
+    if (localX < 0 || localY < 0) {
+        return false;
+    }
+
+    outCol = static_cast<int>(localX / _config.cellWidth);
+    outRow = static_cast<int>(localY / _config.cellHeight);
+    return outRow < _config.rows && outCol < _config.cols;
+}
+
+// ===================================================================
+// 工具
+// ===================================================================
+
+uint32_t SimWorld::nextRandom()
+{
+    uint32_t x = _rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    _rngState = x;
+    return x;
+}
+
+float SimWorld::nextRandom01()
+{
+    return (nextRandom() >> 8) * (1.0f / 16777216.0f);
+}
+
+void SimWorld::emit(SimEventType type, uint32_t id, int row, int col, float x, float y)
+{
+    if (!_eventCallback) return;
+
+    SimEvent event;
+    event.type = type;
+    event.entityId = id;
+    event.row = row;
+    event.col = col;
+    event.x = x;
+    event.y = y;
+    _eventCallback(event);
+}
@@ -0,0 +1,264 @@
+#pragma once
+#ifndef __SIM_WORLD_H__
+#define __SIM_WORLD_H__
+
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include "Entities/EntityTypes.h"
+#include "LaneBroadphase.h"
+#include "GameTuning.h"
+
+// SimWorld - 无头模拟核心
+// 以纯C++状态持有网格、植物、僵尸、子弹和阳光，不依赖Director、GL上下文或场景树，
+// 可在CI上批量跑对局（平衡性、回归、浸泡测试）。场景中的精灵可以通过事件回调作为它的视图。
+
+// 模拟配置（默认值取自GameTuning，与GameScene/GridSystem/WaveManager读的是同一张表）
+struct SimConfig {
+    int rows;                 // 行数
+    int cols;                 // 列数
+    float cellWidth;          // 格子宽度
+    float cellHeight;         // 格子高度
+    float originX;            // 网格原点（左下角）
+    float originY;
+    float worldWidth;         // 可视区域大小
+    float worldHeight;
+
+    int totalWaves;           // 总波次
+    float preparationTime;    // 第一波前的准备时间
+    float waveDelay;          // 波次之间的间隔
+    int startingSun;          // 初始阳光
+    bool autoCollectSun;      // 阳光生成即收集（无人操作的批量对局）
+    uint32_t seed;            // 随机种子
+
+    SimConfig()
+        : rows(GameTuning::GRID_ROWS), cols(GameTuning::GRID_COLS)
+        , cellWidth(GameTuning::CELL_WIDTH), cellHeight(GameTuning::CELL_HEIGHT)
+        , originX(GameTuning::GRID_ORIGIN_X), originY(GameTuning::GRID_ORIGIN_Y)
+        , worldWidth(1024.0f), worldHeight(768.0f)
+        , totalWaves(GameTuning::TOTAL_WAVES)
+        , preparationTime(GameTuning::PREPARATION_TIME)
+        , waveDelay(GameTuning::WAVE_DELAY)
+        , startingSun(GameTuning::STARTING_SUN)
+        , autoCollectSun(true)
+        , seed(1) {}
+};
+
+struct SimPlant {
+    uint32_t id;
+    PlantType type;
+    int row;
+    int col;
+    float x;
+    float y;
+    int health;
+    float attackTimer;        // 攻击计时器
+    float produceTimer;       // 生产计时器
+    float fuseTimer;          // 樱桃炸弹引信 / 土豆地雷准备计时
+    bool armed;               // 土豆地雷是否已激活
+    bool alive;
+};
+
+struct SimZombie {
+    uint32_t id;
+    ZombieType type;
+    int row;
+    float x;
+    float y;
+    int health;
+    int armor;                // 路障/铁桶的额外生命值
+    int damage;
+    float speed;
+    float attackTimer;
+    float freezeTimer;
+    uint32_t targetPlantId;   // 正在啃食的植物（0表示没有）
+    bool attacking;
+    bool alive;
+};
+
+struct SimProjectile {
+    uint32_t id;
+    ProjectileType type;
+    int row;
+    float x;
+    float y;
+    float prevX;              // 本帧移动前的x（扫掠检测起点）
+    float velocityX;
+    int damage;
+    float lifeTime;
+    bool alive;
+};
+
+struct SimSun {
+    uint32_t id;
+    float x;
+    float y;
+    int value;
+    float lifeTime;           // 剩余存在时间
+    bool alive;
+};
+
+// 模拟事件（供视图层同步精灵）
+enum class SimEventType {
+    PLANT_PLACED,
+    PLANT_DIED,
+    ZOMBIE_SPAWNED,
+    ZOMBIE_DIED,
+    ZOMBIE_REACHED_END,
+    PROJECTILE_FIRED,
+    PROJECTILE_HIT,
+    PROJECTILE_EXPIRED,
+    SUN_SPAWNED,
+    SUN_COLLECTED,
+    SUN_EXPIRED,
+    EXPLOSION,
+    WAVE_STARTED,
+    WAVE_COMPLETED
+};
+
+struct SimEvent {
+    SimEventType type;
+    uint32_t entityId;
+    int row;
+    int col;
+    float x;
+    float y;
+};
+
+typedef std::function<void(const SimEvent&)> SimEventCallback;
+
+// 对局结果
+enum class SimOutcome {
+    RUNNING,
+    WON,
+    LOST
+};
+
+class SimWorld {
+public:
+    explicit SimWorld(const SimConfig& config = SimConfig());
+
+    // 以当前配置重新开始一局
+    void reset();
+    void reset(uint32_t seed);
+
+    // 推进模拟
+    void tick(float delta);
+
+    // 玩家操作
+    bool canPlantAt(int row, int col) const;
+    bool placePlant(PlantType type, int row, int col);
+    bool collectSun(uint32_t sunId);
+    int collectAllSuns();
+
+    // 状态查询
+    const SimConfig& getConfig() const { return _config; }
+    SimOutcome getOutcome() const { return _outcome; }
+    float getTime() const { return _time; }
+    uint64_t getTickCount() const { return _tickCount; }
+    int getSunCount() const { return _sunCount; }
+    int getCurrentWave() const { return _currentWave; }
+    int getZombiesKilled() const { return _zombiesKilled; }
+    float getCooldownRemaining(PlantType type) const;
+
+    const std::vector<SimPlant>& getPlants() const { return _plants; }
+    const std::vector<SimZombie>& getZombies() const { return _zombies; }
+    const std::vector<SimProjectile>& getProjectiles() const { return _projectiles; }
+    const std::vector<SimSun>& getSuns() const { return _suns; }
+    const SimPlant* getPlantAt(int row, int col) const;
+
+    // 网格坐标
+    float laneY(int row) const;
+    float cellCenterX(int col) const;
+    float cellCenterY(int row) const;
+    bool worldToGrid(float x, float y, int& outRow, int& outCol) const;
+
+    // 事件回调
+    void setEventCallback(const SimEventCallback& callback) { _eventCallback = callback; }
+
+    // 植物数值（卡牌数值来自GameTuning，生命值与Plant::initPlant的实际生效值一致）
+    static int plantSunCost(PlantType type);
+    static float plantCooldown(PlantType type);
+    static int plantHealth(PlantType type);
+
+private:
+    enum class WavePhase {
+        PREPARING,
+        SPAWNING,
+        BETWEEN_WAVES,
+        FINISHED
+    };
+
+    // 分阶段更新（与GameScene::tickGame的流水线顺序一致）
+    void updateWaves(float delta);
+    void updateRandomSun(float delta);
+    void moveZombies(float delta);
+    void moveProjectiles(float delta);
+    void targetZombies();
+    void updatePlants(float delta);
+    void collideProjectiles();
+    void attackZombies(float delta);
+    void updateSuns(float delta);
+    void cleanup();
+
+    // 行为
+    void startWave(int waveNumber);
+    void spawnZombie();
+    void fireProjectile(const SimPlant& plant);
+    void spawnSun(float x, float y, float lifeTime);
+    void explode(const SimPlant& plant, float range, int damage, bool sameRowOnly);
+    void damageZombie(SimZombie& zombie, int damage);
+    void damagePlant(SimPlant& plant, int damage);
+    bool hasZombieAhead(const SimPlant& plant, float range) const;
+    SimPlant* findPlantInFront(const SimZombie& zombie);
+    SimPlant* findPlant(uint32_t plantId);
+    int cooldownIndex(PlantType type) const;
+
+    // 确定性随机数（xorshift32），保证相同种子得到相同对局
+    uint32_t nextRandom();
+    float nextRandom01();
+
+    void emit(SimEventType type, uint32_t id, int row, int col, float x, float y);
+
+private:
+    SimConfig _config;
+    SimOutcome _outcome;
+
+    float _time;
+    uint64_t _tickCount;
+    uint32_t _rngState;
+    uint32_t _nextId;
+    int _sunCount;
+
+    // 波次
+    WavePhase _wavePhase;
+    int _currentWave;
+    int _waveZombieCount;
+    int _zombiesSpawned;
+    int _zombiesKilled;
+    float _waveTimer;
+    float _spawnTimer;
+
+    // 随机阳光
+    float _randomSunTimer;
+    float _randomSunInterval;
+
+    // 卡牌冷却（按PlantType索引）
+    std::vector<float> _cooldowns;
+
+    // 实体
+    std::vector<SimPlant> _plants;
+    std::vector<SimZombie> _zombies;
+    std::vector<SimProjectile> _projectiles;
+    std::vector<SimSun> _suns;
+
+    // 网格占用（row * cols + col -> 植物id，0表示空）
+    std::vector<uint32_t> _gridPlants;
+
+    // 子弹碰撞检测（每帧复用）
+    LaneBroadphase _broadphase;
+
+    SimEventCallback _eventCallback;
+};
+
+#endif // __SIM_WORLD_H__
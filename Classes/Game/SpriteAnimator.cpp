@@ -0,0 +1,270 @@
+#include "SpriteAnimator.h"
+#include <algorithm>
+#include "./Game/FrameProfiler.h"
+#include "./Game/EntityLayers.h"
+
+USING_NS_CC;
+
+namespace {
+    // 时长为0的帧按最短时长处理，避免推进时死循环
+    const float MIN_FRAME_DURATION = 0.001f;
+}
+
+SpriteAnimator* SpriteAnimator::_instance = nullptr;
+
+SpriteAnimator* SpriteAnimator::getInstance()
+{
+    if (_instance == nullptr)
+    {
+        _instance = new SpriteAnimator();
+    }
+    return _instance;
+}
+
+SpriteAnimator::SpriteAnimator()
+    : _dispatching(false)
+{
+    // 与ActionManager同为系统优先级，在节点的update之前推进
+    Director::getInstance()->getScheduler()->scheduleUpdate(this, Scheduler::PRIORITY_SYSTEM, false);
+}
+
+SpriteAnimator::~SpriteAnimator()
+{
+    Director::getInstance()->getScheduler()->unscheduleUpdate(this);
+    for (auto& track : _tracks)
+    {
+        track.animation->release();
+    }
+    _tracks.clear();
+    _trackIndex.clear();
+    _instance = nullptr;
+}
+
+void SpriteAnimator::play(Sprite* sprite, Animation* animation, bool loop,
+    const std::function<void()>& onComplete, float speed)
+{
+    if (!sprite)
+    {
+        return;
+    }
+    if (!animation || animation->getFrames().empty())
+    {
+        stop(sprite);
+        return;
+    }
+
+    animation->retain();
+
+    Track* track = nullptr;
+    auto it = _trackIndex.find(sprite);
+    if (it != _trackIndex.end())
+    {
+        // 替换当前动画，轨道原地复用
+        track = &_tracks[it->second];
+        track->animation->release();
+    }
+    else
+    {
+        _trackIndex[sprite] = (int)_tracks.size();
+        _tracks.push_back(Track());
+        track = &_tracks.back();
+        track->sprite = sprite;
+    }
+
+    track->animation = animation;
+    track->time = 0.0f;
+    track->speed = speed;
+    track->frameCount = (int)animation->getFrames().size();
+    track->loop = loop;
+    track->onComplete = onComplete;
+    setFrame(*track, 0);
+
+    // 旧动画还没派发的完成回调作废
+    for (auto& event : _events)
+    {
+        if (event.sprite == sprite)
+        {
+            event.callback = nullptr;
+        }
+    }
+}
+
+void SpriteAnimator::stop(Sprite* sprite)
+{
+    auto it = _trackIndex.find(sprite);
+    if (it != _trackIndex.end())
+    {
+        removeTrack(it->second);
+    }
+
+    for (auto& event : _events)
+    {
+        if (event.sprite == sprite)
+        {
+            event.callback = nullptr;
+        }
+    }
+}
+
+bool SpriteAnimator::isPlaying(Sprite* sprite) const
+{
+    return _trackIndex.find(sprite) != _trackIndex.end();
+}
+
+Animation* SpriteAnimator::getAnimation(Sprite* sprite) const
+{
+    auto it = _trackIndex.find(sprite);
+    return it != _trackIndex.end() ? _tracks[it->second].animation : nullptr;
+}
+
+void SpriteAnimator::setSpeed(Sprite* sprite, float speed)
+{
+    auto it = _trackIndex.find(sprite);
+    if (it != _trackIndex.end())
+    {
+        _tracks[it->second].speed = speed;
+    }
+}
+
+int SpriteAnimator::stopHidden()
+{
+    int stopped = 0;
+    for (int i = (int)_tracks.size() - 1; i >= 0; i--)
+    {
+        Sprite* sprite = _tracks[i].sprite;
+        if (!sprite->isVisible())
+        {
+            stop(sprite);
+            stopped++;
+        }
+    }
+    return stopped;
+}
+
+void SpriteAnimator::update(float delta)
+{
+    PVZ_PROFILE_ZONE("SpriteAnimator::update");
+
+    for (int i = 0; i < (int)_tracks.size(); i++)
+    {
+        Track& track = _tracks[i];
+        // 不在场景中或隐藏（如池中空闲）的精灵不推进
+        if (!track.sprite->isRunning() || !track.sprite->isVisible())
+        {
+            continue;
+        }
+
+        track.time += delta * track.speed;
+        if (track.time < track.frameDuration)
+        {
+            continue;
+        }
+
+        // 跨过一帧或多帧（卡顿时可能一次跨好几帧），只在最后换一次SpriteFrame
+        const auto& frames = track.animation->getFrames();
+        float delayPerUnit = track.animation->getDelayPerUnit();
+        int frame = track.frame;
+        bool finished = false;
+        while (track.time >= track.frameDuration)
+        {
+            track.time -= track.frameDuration;
+            if (frame + 1 >= track.frameCount)
+            {
+                if (!track.loop)
+                {
+                    finished = true;
+                    break;
+                }
+                frame = 0;
+            }
+            else
+            {
+                frame++;
+            }
+            track.frameDuration = std::max(frames.at(frame)->getDelayUnits() * delayPerUnit, MIN_FRAME_DURATION);
+        }
+
+        if (frame != track.frame)
+        {
+            track.frame = frame;
+            applyFrame(track.sprite, frames.at(frame)->getSpriteFrame());
+        }
+
+        if (finished)
+        {
+            // 停在最后一帧，完成回调延迟到所有轨道推进完再派发
+            if (track.onComplete)
+            {
+                CompletionEvent event;
+                event.sprite = track.sprite;
+                event.callback = std::move(track.onComplete);
+                _events.push_back(std::move(event));
+            }
+            _finished.push_back(i);
+        }
+    }
+
+    // 从后往前移除，交换删除不会影响还没处理的下标
+    for (auto it = _finished.rbegin(); it != _finished.rend(); ++it)
+    {
+        removeTrack(*it);
+    }
+    _finished.clear();
+
+    if (_events.empty() || _dispatching)
+    {
+        return;
+    }
+
+    _dispatching = true;
+    for (size_t i = 0; i < _events.size(); i++)
+    {
+        std::function<void()> callback = std::move(_events[i].callback);
+        _events[i].callback = nullptr;
+        if (callback)
+        {
+            callback();
+        }
+    }
+    _events.clear();
+    _dispatching = false;
+}
+
+void SpriteAnimator::setFrame(Track& track, int frame)
+{
+    const auto& frames = track.animation->getFrames();
+    AnimationFrame* animationFrame = frames.at(frame);
+    track.frame = frame;
+    track.frameDuration = std::max(animationFrame->getDelayUnits() * track.animation->getDelayPerUnit(), MIN_FRAME_DURATION);
+    applyFrame(track.sprite, animationFrame->getSpriteFrame());
+}
+
+void SpriteAnimator::applyFrame(Sprite* sprite, SpriteFrame* spriteFrame)
+{
+    Texture2D* texture = sprite->getTexture();
+    sprite->setSpriteFrame(spriteFrame);
+
+    // 帧在另一张图集页上：按新纹理重新排序，否则同纹理的精灵不再相邻，合批被打断
+    if (sprite->getTexture() != texture)
+    {
+        if (auto entityLayers = EntityLayers::getActive())
+        {
+            entityLayers->textureChanged(sprite);
+        }
+    }
+}
+
+void SpriteAnimator::removeTrack(int index)
+{
+    Track& track = _tracks[index];
+    _trackIndex.erase(track.sprite);
+    track.animation->release();
+
+    int last = (int)_tracks.size() - 1;
+    if (index != last)
+    {
+        _tracks[index] = std::move(_tracks[last]);
+        _trackIndex[_tracks[index].sprite] = index;
+    }
+    _tracks.pop_back();
+}
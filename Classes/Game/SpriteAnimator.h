@@ -0,0 +1,80 @@
+#pragma once
+#ifndef __SPRITE_ANIMATOR_H__
+#define __SPRITE_ANIMATOR_H__
+
+#include "cocos2d.h"
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// SpriteAnimator - 集中的帧动画系统
+// 植物、僵尸、子弹、阳光的帧动画不再各自runAction(RepeatForever(Animate))：
+// 每个播放中的精灵在连续数组里占一条轨道（动画、帧内时间、速度、是否循环、完成回调），
+// update里一个循环推进所有轨道，跨帧时直接setSpriteFrame，不分配Action，也不经过ActionManager按目标的哈希表。
+// 单次动画播完后把完成回调放进延迟队列，等所有轨道推进完再统一派发，回调里可以安全地播放/停止任意动画。
+// 挂在Scheduler上与ActionManager同级更新（Director暂停时一起暂停），未在场景中运行或隐藏的精灵跳过。
+// 精灵销毁前必须stop（实体在析构函数里调用）。
+class SpriteAnimator
+{
+public:
+    static SpriteAnimator* getInstance();
+
+    // 播放动画（替换该精灵当前的动画），从第一帧开始；speed为播放倍率
+    void play(cocos2d::Sprite* sprite, cocos2d::Animation* animation, bool loop,
+        const std::function<void()>& onComplete = nullptr, float speed = 1.0f);
+    // 停止动画（精灵停在当前帧），尚未派发的完成回调一并取消
+    void stop(cocos2d::Sprite* sprite);
+
+    bool isPlaying(cocos2d::Sprite* sprite) const;
+    cocos2d::Animation* getAnimation(cocos2d::Sprite* sprite) const;
+    void setSpeed(cocos2d::Sprite* sprite, float speed);
+    // 停止所有隐藏精灵的轨道（图集组被淘汰时调用，释放它们对动画和纹理的引用），返回停止的数量
+    int stopHidden();
+
+    // 推进所有轨道并派发完成回调（由Scheduler每帧调用）
+    void update(float delta);
+
+    int getTrackCount() const { return (int)_tracks.size(); }
+
+private:
+    SpriteAnimator();
+    ~SpriteAnimator();
+
+    // 禁止复制
+    SpriteAnimator(const SpriteAnimator&) = delete;
+    SpriteAnimator& operator=(const SpriteAnimator&) = delete;
+
+    struct Track
+    {
+        cocos2d::Sprite* sprite;
+        cocos2d::Animation* animation;      // 持有引用，图集组被淘汰后帧和纹理仍有效
+        float time;                         // 当前帧已播放的时间
+        float frameDuration;                // 当前帧的时长
+        float speed;
+        int frame;
+        int frameCount;
+        bool loop;
+        std::function<void()> onComplete;
+    };
+
+    struct CompletionEvent
+    {
+        cocos2d::Sprite* sprite;
+        std::function<void()> callback;
+    };
+
+    void setFrame(Track& track, int frame);
+    // 设置精灵帧，纹理变化时通知EntityLayers重新排序
+    void applyFrame(cocos2d::Sprite* sprite, cocos2d::SpriteFrame* spriteFrame);
+    void removeTrack(int index);
+
+    static SpriteAnimator* _instance;
+
+    std::vector<Track> _tracks;
+    std::unordered_map<cocos2d::Sprite*, int> _trackIndex;    // 精灵 -> 轨道下标（只在play/stop时查）
+    std::vector<int> _finished;                               // 本帧播完的轨道
+    std::vector<CompletionEvent> _events;                     // 延迟派发的完成回调
+    bool _dispatching;
+};
+
+#endif // __SPRITE_ANIMATOR_H__
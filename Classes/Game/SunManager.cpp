@@ -0,0 +1,345 @@
+#include "SunManager.h"
+#include "GameManager.h"
+#include "./Resources/AudioManager.h"
+#include "./Resources/ResourceLoader.h"
+#include <algorithm>
+#include <cmath>
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
+#include "./Game/SpriteAnimator.h"
+
+USING_NS_CC;
+
+namespace {
+    const int SUN_VALUE = 25;
+    const float PRODUCED_LIFETIME = 10.0f;     // 向日葵阳光存在时间
+    const float FALLING_LIFETIME = 15.0f;      // 随机阳光存在时间（含下落）
+    const float FADE_DURATION = 0.5f;          // 超时淡出
+    const float COLLECT_DURATION = 0.2f;       // 收集动画
+    const float FLOAT_HEIGHT = 10.0f;          // 浮动幅度
+    const float FLOAT_PERIOD = 1.0f;           // 浮动周期
+    const float PRODUCED_ROTATE_SPEED = 180.0f;
+    const float FALLING_ROTATE_SPEED = 90.0f;
+    const float MIN_HIT_RADIUS = 20.0f;
+}
+
+SunManager* SunManager::_instance = nullptr;
+
+SunManager* SunManager::getInstance()
+{
+    if (_instance == nullptr)
+    {
+        _instance = new SunManager();
+    }
+    return _instance;
+}
+
+SunManager::SunManager()
+    : _layer(nullptr)
+    , _zOrder(0)
+    , _activeCount(0)
+{
+}
+
+SunManager::~SunManager()
+{
+    clear();
+    _instance = nullptr;
+}
+
+void SunManager::init(Node* layer, int zOrder, int prewarmCount)
+{
+    if (_layer != layer)
+    {
+        clear();
+    }
+
+    _layer = layer;
+    _zOrder = zOrder;
+    if (!_layer)
+    {
+        return;
+    }
+
+    // 上一局残留的阳光全部收回
+    for (auto& sun : _suns)
+    {
+        if (sun.state != SunState::INACTIVE)
+        {
+            releaseSun(sun);
+        }
+    }
+
+    while ((int)_suns.size() < prewarmCount)
+    {
+        createSunNode();
+    }
+
+    PVZ_LOGI(LogCategory::SUN, "SunManager: Initialized with %d pooled suns", (int)_suns.size());
+}
+
+void SunManager::detachLayer(Node* layer)
+{
+    if (_layer == layer)
+    {
+        clear();
+    }
+}
+
+void SunManager::spawnProducedSun(const Vec2& position)
+{
+    int index = acquireSun();
+    if (index < 0)
+    {
+        return;
+    }
+
+    Sun& sun = _suns[index];
+    sun.state = SunState::IDLE;
+    sun.startPos = position;
+    sun.basePos = position;
+    sun.fallDuration = 0.0f;
+    sun.lifeTime = PRODUCED_LIFETIME;
+    sun.rotateSpeed = PRODUCED_ROTATE_SPEED;
+    sun.sprite->setPosition(position);
+}
+
+void SunManager::spawnFallingSun(const Vec2& startPos, const Vec2& endPos, float fallDuration)
+{
+    int index = acquireSun();
+    if (index < 0)
+    {
+        return;
+    }
+
+    Sun& sun = _suns[index];
+    sun.state = fallDuration > 0.0f ? SunState::FALLING : SunState::IDLE;
+    sun.startPos = startPos;
+    sun.basePos = endPos;
+    sun.fallDuration = fallDuration;
+    sun.lifeTime = FALLING_LIFETIME;
+    sun.rotateSpeed = FALLING_ROTATE_SPEED;
+    sun.sprite->setPosition(startPos);
+}
+
+void SunManager::update(float delta)
+{
+    PVZ_PROFILE_ZONE("SunManager::update");
+
+    for (auto& sun : _suns)
+    {
+        if (sun.state == SunState::INACTIVE)
+        {
+            continue;
+        }
+
+        sun.stateTime += delta;
+
+        // 收集动画：放大并淡出后回到池中
+        if (sun.state == SunState::COLLECTING)
+        {
+            float t = std::min(sun.stateTime / COLLECT_DURATION, 1.0f);
+            sun.sprite->setScale(1.0f + 0.5f * t);
+            sun.sprite->setOpacity((GLubyte)(255 * (1.0f - t)));
+            if (t >= 1.0f)
+            {
+                releaseSun(sun);
+            }
+            continue;
+        }
+
+        sun.age += delta;
+
+        // 下落：先放大到1.2再恢复
+        Vec2 position = sun.basePos;
+        float scale = 1.0f;
+        if (sun.state == SunState::FALLING)
+        {
+            float t = std::min(sun.stateTime / sun.fallDuration, 1.0f);
+            position = sun.startPos.lerp(sun.basePos, t);
+            scale = t < 0.3f ? 1.0f + 0.2f * (t / 0.3f) : 1.2f - 0.2f * ((t - 0.3f) / 0.7f);
+            if (t >= 1.0f)
+            {
+                sun.state = SunState::IDLE;
+                sun.stateTime = 0.0f;
+            }
+        }
+
+        // 上下浮动（三角波）和旋转
+        float phase = std::fmod(sun.age, FLOAT_PERIOD) / FLOAT_PERIOD;
+        float offset = (phase < 0.5f ? phase : 1.0f - phase) * 2.0f * FLOAT_HEIGHT;
+        sun.sprite->setPosition(position + Vec2(0, offset));
+        sun.sprite->setRotation(std::fmod(sun.age * sun.rotateSpeed, 360.0f));
+        sun.sprite->setScale(scale);
+
+        // 超时淡出
+        if (sun.age >= sun.lifeTime)
+        {
+            float t = (sun.age - sun.lifeTime) / FADE_DURATION;
+            if (t >= 1.0f)
+            {
+                releaseSun(sun);
+                continue;
+            }
+            sun.sprite->setOpacity((GLubyte)(255 * (1.0f - t)));
+        }
+    }
+}
+
+bool SunManager::handleTouch(const Vec2& worldPos)
+{
+    if (!_layer || _activeCount == 0)
+    {
+        return false;
+    }
+
+    Vec2 localPos = _layer->convertToNodeSpace(worldPos);
+
+    // 后出现的阳光在上层，倒序检测
+    for (auto it = _suns.rbegin(); it != _suns.rend(); ++it)
+    {
+        Sun& sun = *it;
+        if (sun.state != SunState::FALLING && sun.state != SunState::IDLE)
+        {
+            continue;
+        }
+
+        const Size& size = sun.sprite->getContentSize();
+        float radius = std::max(std::max(size.width, size.height) * 0.5f, MIN_HIT_RADIUS) * sun.sprite->getScale();
+        if (localPos.distanceSquared(sun.sprite->getPosition()) <= radius * radius)
+        {
+            collectSun(sun);
+            return true;
+        }
+    }
+    return false;
+}
+
+int SunManager::acquireSun()
+{
+    if (!_layer)
+    {
+        return -1;
+    }
+
+    if (_freeSuns.empty())
+    {
+        createSunNode();
+    }
+
+    int index = _freeSuns.back();
+    _freeSuns.pop_back();
+    _activeCount++;
+
+    Sun& sun = _suns[index];
+    sun.age = 0.0f;
+    sun.stateTime = 0.0f;
+    sun.value = SUN_VALUE;
+    sun.sprite->setRotation(0.0f);
+    sun.sprite->setScale(1.0f);
+    sun.sprite->setOpacity(255);
+    sun.sprite->setVisible(true);
+    if (sun.animation)
+    {
+        SpriteAnimator::getInstance()->play(sun.sprite, sun.animation, true);
+    }
+    return index;
+}
+
+void SunManager::releaseSun(Sun& sun)
+{
+    if (sun.state == SunState::INACTIVE)
+    {
+        return;
+    }
+
+    sun.state = SunState::INACTIVE;
+    sun.sprite->stopAllActions();
+    SpriteAnimator::getInstance()->stop(sun.sprite);
+    sun.sprite->setVisible(false);
+
+    _freeSuns.push_back((int)(&sun - _suns.data()));
+    _activeCount--;
+}
+
+void SunManager::createSunNode()
+{
+    Sun sun;
+    sun.sprite = Sprite::create();
+    sun.animation = nullptr;
+    sun.state = SunState::INACTIVE;
+    sun.fallDuration = 0.0f;
+    sun.age = 0.0f;
+    sun.lifeTime = 0.0f;
+    sun.stateTime = 0.0f;
+    sun.rotateSpeed = 0.0f;
+    sun.value = SUN_VALUE;
+
+    // 有sun_floating动画时播放帧动画，否则使用简单的图形作为后备
+    auto resourceLoader = ResourceLoader::getInstance();
+    Animation* animation = nullptr;
+    if (resourceLoader && resourceLoader->hasAnimation("sun_floating"))
+    {
+        animation = resourceLoader->getCachedAnimation(PVZ_ASSET_ID("sun_floating"));
+    }
+    if (animation)
+    {
+        sun.animation = animation;
+        sun.animation->retain();
+    }
+    else
+    {
+        sun.sprite->setTextureRect(Rect(0, 0, 30, 30));
+        sun.sprite->setColor(Color3B(255, 255, 0));
+    }
+
+    sun.sprite->retain();
+    sun.sprite->setVisible(false);
+    _layer->addChild(sun.sprite, _zOrder);
+
+    _freeSuns.push_back((int)_suns.size());
+    _suns.push_back(sun);
+}
+
+void SunManager::collectSun(Sun& sun)
+{
+    // 播放收集音效
+    auto audioManager = AudioManager::getInstance();
+    if (audioManager)
+    {
+        audioManager->playSoundEffect(PVZ_ASSET_ID("sound_sun_collected"));
+    }
+
+    // 增加阳光数量
+    auto gameManager = GameManager::getInstance();
+    if (gameManager)
+    {
+        gameManager->addSun(sun.value);
+    }
+
+    sun.state = SunState::COLLECTING;
+    sun.stateTime = 0.0f;
+
+    if (_sunCollectedCallback)
+    {
+        _sunCollectedCallback(sun.value);
+    }
+}
+
+void SunManager::clear()
+{
+    for (auto& sun : _suns)
+    {
+        SpriteAnimator::getInstance()->stop(sun.sprite);
+        if (sun.sprite->getParent())
+        {
+            sun.sprite->removeFromParent();
+        }
+        sun.sprite->release();
+        CC_SAFE_RELEASE_NULL(sun.animation);
+    }
+    _suns.clear();
+    _freeSuns.clear();
+    _activeCount = 0;
+    _layer = nullptr;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#ifndef __SUN_MANAGER_H__
+#define __SUN_MANAGER_H__
+
+#include "cocos2d.h"
+#include <vector>
+#include <functional>
+
+// SunManager - 阳光管理
+// 持有一个阳光精灵池：向日葵产出的阳光和天上掉落的随机阳光都从池中取出，
+// 下落、浮动、旋转、超时消失和收集动画都在update里统一计算，不再给每个阳光创建一串Action；
+// 点击由场景的单个触摸监听器转发给handleTouch，按距离做一次命中检测，不再每个阳光注册一个监听器。
+class SunManager
+{
+public:
+    static SunManager* getInstance();
+
+    // 绑定场景层并预热阳光节点（已绑定其它层时先清空）
+    void init(cocos2d::Node* layer, int zOrder, int prewarmCount);
+    // 场景销毁时释放（只在仍是当前场景层时生效）
+    void detachLayer(cocos2d::Node* layer);
+
+    // 向日葵产出的阳光：在指定位置浮动，10秒后消失
+    void spawnProducedSun(const cocos2d::Vec2& position);
+    // 随机阳光：从startPos落到endPos后浮动，15秒后消失
+    void spawnFallingSun(const cocos2d::Vec2& startPos, const cocos2d::Vec2& endPos, float fallDuration);
+
+    // 推进所有阳光的动画和计时（由GameScene的逻辑流水线调用）
+    void update(float delta);
+
+    // 点击命中检测，命中时收集阳光并返回true
+    bool handleTouch(const cocos2d::Vec2& worldPos);
+
+    // 收集回调（参数为本次获得的阳光数）
+    void setSunCollectedCallback(const std::function<void(int)>& callback) { _sunCollectedCallback = callback; }
+
+    int getActiveSunCount() const { return _activeCount; }
+
+private:
+    SunManager();
+    ~SunManager();
+
+    // 禁止复制
+    SunManager(const SunManager&) = delete;
+    SunManager& operator=(const SunManager&) = delete;
+
+    enum class SunState
+    {
+        INACTIVE,   // 在池中
+        FALLING,    // 下落中
+        IDLE,       // 等待收集
+        COLLECTING  // 收集动画中
+    };
+
+    struct Sun
+    {
+        cocos2d::Sprite* sprite;
+        cocos2d::Animation* animation;  // 帧动画（持有引用，取出时交给SpriteAnimator循环播放）
+        SunState state;
+        cocos2d::Vec2 startPos;
+        cocos2d::Vec2 basePos;          // 浮动的基准位置
+        float fallDuration;
+        float age;                      // 出现后经过的时间
+        float lifeTime;                 // 超过后开始淡出
+        float stateTime;                // 当前状态经过的时间
+        float rotateSpeed;              // 度/秒
+        int value;
+    };
+
+    int acquireSun();
+    void releaseSun(Sun& sun);
+    void createSunNode();
+    void collectSun(Sun& sun);
+    void clear();
+
+    static SunManager* _instance;
+
+    cocos2d::Node* _layer;
+    int _zOrder;
+    std::vector<Sun> _suns;
+    std::vector<int> _freeSuns;
+    int _activeCount;
+
+    std::function<void(int)> _sunCollectedCallback;
+};
+
+#endif // __SUN_MANAGER_H__
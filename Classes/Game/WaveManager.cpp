@@ -1,10 +1,16 @@
 #include "WaveManager.h"
 #include "./Entities/Zombie/Zombie.h"
 #include "./Entities/Zombie/ZombieNormal.h"
-#include "./Entities/Zombie/ZombieConeHead.h"    // 
-#include "./Entities/Zombie/ZombieBucketHead.h"  // 
+#include "./Entities/Zombie/ZombieConeHead.h"    // 添加这行
+#include "./Entities/Zombie/ZombieBucketHead.h"  // 添加这行
+#include "./Entities/Zombie/ZombiePool.h"
 #include "./Game/GameManager.h"
+#include "./Resources/ResourceLoader.h"
+#include "./Resources/TextureResidency.h"
 #include <cocos2d.h>
+#include <algorithm>
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
 
 USING_NS_CC;
 
@@ -21,7 +27,7 @@ WaveManager* WaveManager::getInstance()
 
 WaveManager::WaveManager()
     : _currentWave(0)
-    , _totalWaves(10)
+    , _totalWaves(GameTuning::TOTAL_WAVES)
     , _state(WaveState::PREPARING)
     , _zombiesSpawned(0)
     , _zombiesKilled(0)
@@ -29,12 +35,25 @@ WaveManager::WaveManager()
     , _zombiesReachedEnd(0)
     , _spawnTimer(0)
     , _waveTimer(0)
-    , _preparationTimer(50.0f) // ʼ׼ʱ10
+    , _preparationTimer(GameTuning::PREPARATION_TIME)
+    , _spawnLayer(nullptr)
+    , _spawnX(0)
+    , _zombiePool(new ZombiePool())
+    , _evictionListener(0)
 {
+    clearLanes();
+
+    // 图集组被淘汰后，池中空闲僵尸不再引用它的动画和纹理（复用时会重新取）
+    _evictionListener = TextureResidency::getInstance()->getEvictionObservable().subscribe([this](const int&) {
+        _zombiePool->releaseIdleAnimations();
+    }, false);
 }
 
 WaveManager::~WaveManager()
 {
+    TextureResidency::getInstance()->getEvictionObservable().unsubscribe(_evictionListener);
+    delete _zombiePool;
+    _zombiePool = nullptr;
     _instance = nullptr;
 }
 
@@ -51,16 +70,22 @@ void WaveManager::init(int totalWaves)
 
     _spawnTimer = 0;
     _waveTimer = 0;
-    _preparationTimer = 50.0f; // ʼ׼ʱ10
+    _preparationTimer = GameTuning::PREPARATION_TIME;
 
     _activeZombies.clear();
+    clearLanes();
 
-    log("WaveManager: Initialized with %d waves, preparation time: %.1f seconds",
+    PVZ_LOGI(LogCategory::WAVE, "WaveManager: Initialized with %d waves, preparation time: %.1f seconds",
         totalWaves, _preparationTimer);
 }
 
 void WaveManager::update(float delta)
 {
+    PVZ_PROFILE_ZONE("WaveManager::update");
+
+    // 整理行索引（移除空位、按x重新排序）
+    refreshLanes();
+
     if (_state == WaveState::GAME_OVER || _state == WaveState::COMPLETED)
     {
         return;
@@ -69,7 +94,7 @@ void WaveManager::update(float delta)
     switch (_state)
     {
         case WaveState::PREPARING:
-            // ׼׶εʱ
+            // 准备阶段倒计时
             _preparationTimer -= delta;
             if (_preparationTimer <= 0)
             {
@@ -78,7 +103,7 @@ void WaveManager::update(float delta)
             break;
 
         case WaveState::SPAWNING:
-            // ɽʬ߼ֲ
+            // 生成僵尸的逻辑保持不变
             if (_zombiesSpawned < _currentWaveData.zombieCount)
             {
                 _spawnTimer += delta;
@@ -89,36 +114,37 @@ void WaveManager::update(float delta)
                 }
             }
 
-            // Kz
+            // 清理並檢查
             cleanupZombieList();
 
-            // 鲨
+            // 检查波次完成条件
             if (_zombiesSpawned >= _currentWaveData.zombieCount && _activeZombies.empty())
             {
-                log("WaveManager: Wave %d completion condition met (spawned: %d, active: %d)",
+                PVZ_LOGD(LogCategory::WAVE, "WaveManager: Wave %d completion condition met (spawned: %d, active: %d)",
                     _currentWave, _zombiesSpawned, (int)_activeZombies.size());
                 completeWave();
             }
             break;
     }
 
-    // ЧĽʬָ
+    // 清理无效的僵尸指针
     cleanupZombieList();
 }
 
 void WaveManager::cleanupZombieList()
 {
-    // ƳѾٵĽʬ
+    // 移除已经被销毁的僵尸
     auto it = _activeZombies.begin();
     while (it != _activeZombies.end())
     {
         Zombie* zombie = *it;
 
-        // 齩ʬǷЧ
+        // 检查僵尸是否有效
         if (!zombie || !zombie->getParent() || !zombie->isAlive())
         {
+            removeZombieFromLane(zombie);
             it = _activeZombies.erase(it);
-            log("WaveManager: Cleaned up invalid zombie");
+            PVZ_LOGD(LogCategory::WAVE, "WaveManager: Cleaned up invalid zombie");
         }
         else
         {
@@ -137,13 +163,13 @@ void WaveManager::startNextWave()
     }
     else
     {
-        // в
+        // 所有波次完成
         if (_allWavesCompletedCallback)
         {
             _allWavesCompletedCallback();
         }
 
-        log("WaveManager: All waves completed!");
+        PVZ_LOGI(LogCategory::WAVE, "WaveManager: All waves completed!");
     }
 }
 
@@ -158,7 +184,10 @@ void WaveManager::startWave(int waveNumber)
     _waveTimer = 0;
     _state = WaveState::SPAWNING;
 
-    log("WaveManager: Starting wave %d with %d zombies", waveNumber, _currentWaveData.zombieCount);
+    PVZ_LOGI(LogCategory::WAVE, "WaveManager: Starting wave %d with %d zombies", waveNumber, _currentWaveData.zombieCount);
+
+    // 下一波才会出现的僵尸（如第4波起的铁桶）在这一波里后台解码好图集
+    prefetchZombiesForWave(waveNumber + 1);
 
     if (_waveStartedCallback)
     {
@@ -168,7 +197,7 @@ void WaveManager::startWave(int waveNumber)
 
 void WaveManager::spawnZombie()
 {
-    log("WaveManager::spawnZombie called");
+    PVZ_LOGT(LogCategory::WAVE, "WaveManager::spawnZombie called");
 
     Zombie* zombie = spawnRandomZombie();
     if (zombie)
@@ -177,95 +206,159 @@ void WaveManager::spawnZombie()
         _zombiesSpawned++;
         _zombiesRemaining--;
 
-        log("WaveManager: Zombie spawned successfully! (%d/%d)",
+        PVZ_LOGD(LogCategory::WAVE, "WaveManager: Zombie spawned successfully! (%d/%d)",
             _zombiesSpawned, _currentWaveData.zombieCount);
     }
     else
     {
-        log("ERROR: Failed to spawn zombie!");
+        PVZ_LOGE(LogCategory::WAVE, "Failed to spawn zombie!");
     }
 }
 
 Zombie* WaveManager::spawnRandomZombie()
 {
-    log("WaveManager::spawnRandomZombie: Creating zombie...");
+    PVZ_LOGT(LogCategory::WAVE, "WaveManager::spawnRandomZombie: Creating zombie...");
 
-    // 1. șzǷ
-    auto director = Director::getInstance();
-    auto scene = director->getRunningScene();
-    if (!scene)
+    // 1. 先檢查生成層是否可用
+    if (!_spawnLayer)
     {
-        log("ERROR: No running scene!");
+        PVZ_LOGE(LogCategory::WAVE, "No spawn layer set!");
         return nullptr;
     }
 
 
-    log("WaveManager::spawnRandomZombie: Zombie created successfully");
+    PVZ_LOGT(LogCategory::WAVE, "WaveManager::spawnRandomZombie: Zombie created successfully");
 
-    // ݲξʬ
-    Zombie* zombie = nullptr;
-    int zombieType = rand() % 100;
+    // 根据波次决定僵尸类型
+    ZombieType type = pickZombieType(_currentWave);
 
-    // Ųӣָǿʬĸ
-    int strongZombieChance = std::min(0, (_currentWave - 4) * 10); // 40%
-    zombieType += strongZombieChance;
+    // 确保该类型的图集已加载（通常已在上一波预取过）
+    ResourceLoader::getInstance()->acquireZombieResources(type);
 
-    if (zombieType <= 60) {
-        // ͨʬ (60% - strongZombieChance)
-        zombie = ZombieNormal::create();
-    }
-    else if (zombieType <= 90) {
-        // ·Ͻʬ (30%)
-        zombie = ZombieConeHead::create();
-    }
-    else {
-        // Ͱʬ (10%)
-        zombie = ZombieBucketHead::create();
-    }
+    // 从对象池取出（已重置并挂在生成层上）
+    Zombie* zombie = _zombiePool->acquire(type);
 
     if (!zombie)
     {
-        log("ERROR: Failed to create zombie!");
+        PVZ_LOGE(LogCategory::WAVE, "Failed to create zombie!");
         return nullptr;
     }
 
-    log("WaveManager::spawnRandomZombie: Zombie created successfully (Type: %d)", (int)zombie->getType());
+    PVZ_LOGT(LogCategory::WAVE, "WaveManager::spawnRandomZombie: Zombie created successfully (Type: %d)", (int)zombie->getType());
+
+
+    // 3. 設置位置
+    // 隨機選擇行（0-4）
+    int row = rand() % LANE_COUNT;
+    float x = _spawnX; // 從屏幕右側外生成
+    float y = 75 + row * 130; // 根據網格系統調整
+
+    zombie->setPosition(Vec2(x, y));
+    zombie->setRow(row);
+    _spawnLayer->place(zombie, EntityLayer::ZOMBIE, row);
+
+    PVZ_LOGT(LogCategory::WAVE, "WaveManager::spawnRandomZombie: Zombie position set to (%.1f, %.1f), row: %d", x, y, row);
+
+    // 4. 添加到活躍列表
+    _activeZombies.push_back(zombie);
+    addZombieToLane(zombie);
+
+    PVZ_LOGT(LogCategory::WAVE, "WaveManager::spawnRandomZombie: Zombie added successfully");
+    return zombie;
+}
 
+int WaveManager::getZombieRollOffset(int waveNumber)
+{
+    // 随着波次增加，出现更强僵尸的概率增加
+    return std::min(0, (waveNumber - 4) * 10); // 最多40%概率
+}
 
-    // 3. Oλ
-    auto visibleSize = director->getVisibleSize();
-    Vec2 origin = director->getVisibleOrigin();
+ZombieType WaveManager::pickZombieType(int waveNumber) const
+{
+    int zombieType = rand() % 100 + getZombieRollOffset(waveNumber);
 
-    if (visibleSize.width <= 0 || visibleSize.height <= 0)
+    if (zombieType <= 60) {
+        // 普通僵尸 (60% - strongZombieChance)
+        return ZombieType::NORMAL;
+    }
+    else if (zombieType <= 90) {
+        // 路障僵尸 (30%)
+        return ZombieType::CONEHEAD;
+    }
+    // 铁桶僵尸 (10%)
+    return ZombieType::BUCKETHEAD;
+}
+
+bool WaveManager::canSpawnZombieType(int waveNumber, ZombieType type) const
+{
+    // 与pickZombieType的区间一致：看这一波能掷出的最大值
+    int maxRoll = 99 + getZombieRollOffset(waveNumber);
+    switch (type)
     {
-        log("ERROR: Invalid visible size!");
-        zombie->release();
-        return nullptr;
+    case ZombieType::NORMAL:
+        return true;
+    case ZombieType::CONEHEAD:
+        return maxRoll > 60;
+    case ZombieType::BUCKETHEAD:
+        return maxRoll > 90;
+    default:
+        return false;
+    }
+}
+
+void WaveManager::prefetchZombiesForWave(int waveNumber)
+{
+    if (waveNumber > _totalWaves)
+    {
+        return;
     }
 
-    // SCxУ0-4
-    int row = rand() % 5;
-    float x = visibleSize.width - 20; // Ļ҂
-    float y = 75 + row * 130; // Wϵy{
+    auto resourceLoader = ResourceLoader::getInstance();
+    const ZombieType types[] = { ZombieType::NORMAL, ZombieType::CONEHEAD, ZombieType::BUCKETHEAD };
+    for (ZombieType type : types)
+    {
+        if (canSpawnZombieType(waveNumber, type))
+        {
+            resourceLoader->prefetchZombieResources(type);
+        }
+    }
+}
 
-    zombie->setPosition(Vec2(x, y));
-    zombie->setRow(row);
+void WaveManager::setSpawnLayer(EntityLayers* layer, float spawnX)
+{
+    _spawnLayer = layer;
+    _spawnX = spawnX;
+    _zombiePool->setLayer(layer, 0); // 生成时再按行挂到僵尸层
+}
 
-    log("WaveManager::spawnRandomZombie: Zombie position set to (%.1f, %.1f), row: %d", x, y, row);
+void WaveManager::detachSpawnLayer(EntityLayers* layer)
+{
+    if (_spawnLayer == layer)
+    {
+        _zombiePool->logStats();
+        setSpawnLayer(nullptr, 0);
+    }
+}
 
-    // 4. ӵ
-    scene->addChild(zombie, 10); // ʹ^ߌӼ
+void WaveManager::prewarmZombies(int countPerType)
+{
+    _zombiePool->prewarm(ZombieType::NORMAL, countPerType);
+    _zombiePool->prewarm(ZombieType::CONEHEAD, countPerType);
+    _zombiePool->prewarm(ZombieType::BUCKETHEAD, countPerType);
+}
 
-    // 5. ӵSб
-    _activeZombies.push_back(zombie);
+void WaveManager::recycleZombie(Zombie* zombie)
+{
+    if (!zombie) return;
 
-    log("WaveManager::spawnRandomZombie: Zombie added successfully");
-    return zombie;
+    // 正常流程中僵尸已在zombieKilled/zombieReachedEnd时移出索引，这里再确认一次
+    removeZombieFromLane(zombie);
+    _zombiePool->release(zombie);
 }
 
 void WaveManager::zombieSpawned(Zombie* zombie)
 {
-    // ӽʬʱЧ
+    // 这里可以添加僵尸生成时的特殊效果
 }
 
 void WaveManager::zombieKilled(Zombie* zombie)
@@ -273,9 +366,11 @@ void WaveManager::zombieKilled(Zombie* zombie)
     if (!zombie) return;
 
     _zombiesKilled++;
-    log("WaveManager: Zombie killed (%d/%d)", _zombiesKilled, _currentWaveData.zombieCount);
+    PVZ_LOGD(LogCategory::WAVE, "WaveManager: Zombie killed (%d/%d)", _zombiesKilled, _currentWaveData.zombieCount);
 
-    // ӻԾбƳ
+    removeZombieFromLane(zombie);
+
+    // 从活跃列表中移除
     auto it = std::find(_activeZombies.begin(), _activeZombies.end(), zombie);
     if (it != _activeZombies.end())
     {
@@ -288,17 +383,19 @@ void WaveManager::zombieReachedEnd(Zombie* zombie)
     if (!zombie) return;
 
     _zombiesReachedEnd++;
-    log("WaveManager: Zombie reached end (%d/%d)", _zombiesReachedEnd, _currentWaveData.zombieCount);
+    PVZ_LOGD(LogCategory::WAVE, "WaveManager: Zombie reached end (%d/%d)", _zombiesReachedEnd, _currentWaveData.zombieCount);
+
+    removeZombieFromLane(zombie);
 
-    // ӻԾбƳ
+    // 从活跃列表中移除
     auto it = std::find(_activeZombies.begin(), _activeZombies.end(), zombie);
     if (it != _activeZombies.end())
     {
         _activeZombies.erase(it);
     }
 
-    // ǷϷ
-    if (_zombiesReachedEnd >= 1) // 3ʬյϷ
+    // 检查是否游戏结束
+    if (_zombiesReachedEnd >= 1) // 3个僵尸到达终点则游戏结束
     {
         gameOver();
     }
@@ -309,12 +406,12 @@ void WaveManager::completeWave()
     _state = WaveState::COMPLETED;
     _waveTimer = 0;
 
-    // ǰεĔ
+    // 清除當前波次的數據
     _zombiesSpawned = 0;
     _zombiesKilled = 0;
     _zombiesReachedEnd = 0;
 
-    log("WaveManager: Wave %d completed!", _currentWave);
+    PVZ_LOGI(LogCategory::WAVE, "WaveManager: Wave %d completed!", _currentWave);
 
     if (_waveCompletedCallback)
     {
@@ -326,7 +423,7 @@ void WaveManager::completeWave()
 void WaveManager::gameOver()
 {
     _state = WaveState::GAME_OVER;
-    log("WaveManager: Game Over!");
+    PVZ_LOGI(LogCategory::WAVE, "WaveManager: Game Over!");
 
     if (_gameOverCallback)
     {
@@ -342,7 +439,7 @@ bool WaveManager::isWaveComplete() const
 
 void WaveManager::pauseWave()
 {
-    // ͣлԾʬ
+    // 暂停所有活跃僵尸
     for (auto zombie : _activeZombies)
     {
         if (zombie)
@@ -354,7 +451,7 @@ void WaveManager::pauseWave()
 
 void WaveManager::resumeWave()
 {
-    // ָлԾʬ
+    // 恢复所有活跃僵尸
     for (auto zombie : _activeZombies)
     {
         if (zombie)
@@ -366,20 +463,11 @@ void WaveManager::resumeWave()
 
 void WaveManager::reset()
 {
-    // лS
-    auto it = _activeZombies.begin();
-    while (it != _activeZombies.end())
-    {
-        Zombie* zombie = *it;
-        if (zombie && zombie->getParent())
-        {
-            zombie->removeFromParent();
-        }
-        it = _activeZombies.erase(it);
-    }
-    _activeZombies.clear();
+    // 清理所有活躍殭屍，並收回對象池中的全部實例（包括死亡動畫被打斷的）
+    clearAllZombies();
+    _zombiePool->reclaimAll();
 
-    // ³ʼ
+    // 重新初始化
     _currentWave = 0;
     _state = WaveState::PREPARING;
     _zombiesSpawned = 0;
@@ -388,58 +476,140 @@ void WaveManager::reset()
     _zombiesReachedEnd = 0;
     _spawnTimer = 0;
     _waveTimer = 0;
-    _preparationTimer = 50.0f; // OÞ3ʂrg
+    _preparationTimer = GameTuning::PREPARATION_TIME; // 准备阶段结束时由update开始第一波
+
+    // 僵尸图集按需加载：准备阶段先把第一波会出现的类型交给后台解码
+    prefetchZombiesForWave(1);
 
-    log("WaveManager: Reset complete, active zombies: %d", (int)_activeZombies.size());
+    PVZ_LOGI(LogCategory::WAVE, "WaveManager: Reset complete, active zombies: %d", (int)_activeZombies.size());
 }
 
 void WaveManager::clearAllZombies()
 {
-    auto it = _activeZombies.begin();
-    while (it != _activeZombies.end())
+    // 活跃僵尸全部还回对象池（池外创建的僵尸直接从场景移除）
+    for (auto zombie : _activeZombies)
     {
-        Zombie* zombie = *it;
-
-        // 齩ʬǷЧ
-        bool shouldRemove = false;
+        if (!zombie) continue;
 
-        if (!zombie) {
-            shouldRemove = true;
-        }
-        else if (!zombie->getParent()) {
-            // ʬѴӳƳ
-            shouldRemove = true;
-            log("WaveManager: Removing zombie without parent");
-        }
-        else if (!zombie->isAlive()) {
-            // ʬδȷ
-            shouldRemove = true;
-            log("WaveManager: Removing dead zombie");
+        if (zombie->isPooled())
+        {
+            _zombiePool->release(zombie);
         }
-        else if (zombie->getPositionX() < -100) {
-            // ʬѾƳĻࣨѾյ㵫δȷ
-            shouldRemove = true;
-            log("WaveManager: Removing zombie that left screen");
-            zombieReachedEnd(zombie);  // ¼ʬյ
+        else if (zombie->getParent())
+        {
+            zombie->removeFromParent();
         }
+    }
+    _activeZombies.clear();
+    clearLanes();
+}
 
-        if (shouldRemove) {
-            it = _activeZombies.erase(it);
-            log("WaveManager: Cleaned up invalid zombie");
-        }
-        else {
-            ++it;
+ZombieLaneView WaveManager::getZombiesInRow(int row) const
+{
+    if (row < 0 || row >= LANE_COUNT)
+    {
+        return ZombieLaneView();
+    }
+
+    const std::vector<Zombie*>& lane = _laneZombies[row];
+    return ZombieLaneView(lane.data(), lane.data() + lane.size());
+}
+
+void WaveManager::zombieMoved(Zombie* zombie)
+{
+    if (!zombie) return;
+
+    int row = zombie->getRow();
+    if (row < 0 || row >= LANE_COUNT || _laneDirty[row])
+    {
+        return;
+    }
+
+    // 只有越过相邻僵尸时行内顺序才会变，其余移动不需要重新排序
+    const std::vector<Zombie*>& lane = _laneZombies[row];
+    auto it = std::find(lane.begin(), lane.end(), zombie);
+    if (it == lane.end())
+    {
+        return;
+    }
+
+    float x = zombie->getPositionX();
+    if ((it != lane.begin() && *(it - 1) && (*(it - 1))->getPositionX() > x) ||
+        (it + 1 != lane.end() && *(it + 1) && (*(it + 1))->getPositionX() < x))
+    {
+        _laneDirty[row] = true;
+    }
+}
+
+void WaveManager::addZombieToLane(Zombie* zombie)
+{
+    int row = zombie->getRow();
+    if (row < 0 || row >= LANE_COUNT)
+    {
+        PVZ_LOGW(LogCategory::WAVE, "WaveManager: Zombie row %d out of range, not indexed", row);
+        return;
+    }
+
+    // 新僵尸从右侧生成，通常已在末尾有序；否则等下一帧整理
+    std::vector<Zombie*>& lane = _laneZombies[row];
+    if (!lane.empty() && lane.back() && lane.back()->getPositionX() > zombie->getPositionX())
+    {
+        _laneDirty[row] = true;
+    }
+    lane.push_back(zombie);
+}
+
+void WaveManager::removeZombieFromLane(Zombie* zombie)
+{
+    if (!zombie) return;
+
+    // 只比较指针，不解引用（僵尸可能已被释放）；
+    // 置空而不是erase，避免正在遍历该行的调用方迭代器失效
+    for (int row = 0; row < LANE_COUNT; row++)
+    {
+        for (auto& slot : _laneZombies[row])
+        {
+            if (slot == zombie)
+            {
+                slot = nullptr;
+                _laneDirty[row] = true;
+                return;
+            }
         }
     }
-    _activeZombies.clear();
 }
 
-std::vector<Zombie*> WaveManager::getZombiesInRow(int row) const{
-    std::vector<Zombie*> zombiesInRow;
-    for (auto zombie : _activeZombies) {
-        if (zombie && zombie->isAlive() && zombie->getRow() == row) {
-            zombiesInRow.push_back(zombie);
+void WaveManager::refreshLanes()
+{
+    for (int row = 0; row < LANE_COUNT; row++)
+    {
+        if (!_laneDirty[row]) continue;
+        _laneDirty[row] = false;
+
+        std::vector<Zombie*>& lane = _laneZombies[row];
+        lane.erase(std::remove(lane.begin(), lane.end(), nullptr), lane.end());
+
+        // 僵尸每帧只移动几个像素，顺序基本不变，插入排序接近O(n)
+        for (size_t i = 1; i < lane.size(); i++)
+        {
+            Zombie* zombie = lane[i];
+            float x = zombie->getPositionX();
+            size_t j = i;
+            while (j > 0 && lane[j - 1]->getPositionX() > x)
+            {
+                lane[j] = lane[j - 1];
+                j--;
+            }
+            lane[j] = zombie;
         }
     }
-    return zombiesInRow;
-}
\ No newline at end of file
+}
+
+void WaveManager::clearLanes()
+{
+    for (int row = 0; row < LANE_COUNT; row++)
+    {
+        _laneZombies[row].clear();
+        _laneDirty[row] = false;
+    }
+}
@@ -5,134 +5,195 @@
 #include "cocos2d.h"
 #include <vector>
 #include <functional>
+#include "./Game/EntityLayers.h"
+#include "./Game/GameTuning.h"
 
-class Zombie; // ǰ
+class Zombie; // 前向声明
+class ZombiePool;
+enum class ZombieType;
 
-// 
+// 波次数据
 struct WaveData {
-    int waveNumber;          // α
-    int zombieCount;         // ʬ
-    int zombieTypes;         // ʬ
-    float spawnInterval;     // ɼ룩
-    float waveDelay;         // μӳ٣룩
+    int waveNumber;          // 波次编号
+    int zombieCount;         // 僵尸总数
+    int zombieTypes;         // 僵尸类型数量
+    float spawnInterval;     // 生成间隔（秒）
+    float waveDelay;         // 波次间延迟（秒）
 
     WaveData(int num = 1) : waveNumber(num),
-        zombieCount(num>3?(num-2)*1.5+2:num),  // pٳʼԱyԇ
+        zombieCount(GameTuning::waveZombieCount(num)),
         zombieTypes(1),
-        spawnInterval(2.0f),   // pg
+        spawnInterval(GameTuning::SPAWN_INTERVAL),
         waveDelay(10.0f) {
         if (spawnInterval < 0.5f) spawnInterval = 0.5f;
     }
 };
 
-// ״̬
+// 波次状态
 enum class WaveState {
-    PREPARING,      // ׼׶
-    SPAWNING,       // 
-    COMPLETED,      // 
-    GAME_OVER       // Ϸ
+    PREPARING,      // 准备阶段
+    SPAWNING,       // 生成中
+    COMPLETED,      // 已完成
+    GAME_OVER       // 游戏结束
 };
 
-typedef std::function<void(int)> WaveCallback; // λص
+typedef std::function<void(int)> WaveCallback; // 波次回调
+
+// 单行僵尸的只读视图（按x升序，不分配内存）
+// 本帧内被移除的僵尸以空指针占位，遍历时需要判空
+class ZombieLaneView {
+public:
+    typedef Zombie* const* const_iterator;
+
+    ZombieLaneView() : _begin(nullptr), _end(nullptr) {}
+    ZombieLaneView(const_iterator begin, const_iterator end) : _begin(begin), _end(end) {}
+
+    const_iterator begin() const { return _begin; }
+    const_iterator end() const { return _end; }
+    size_t size() const { return static_cast<size_t>(_end - _begin); }
+    bool empty() const { return _begin == _end; }
+
+private:
+    const_iterator _begin;
+    const_iterator _end;
+};
 
 class WaveManager {
 public:
+    static const int LANE_COUNT = 5; // 行数
+
     static WaveManager* getInstance();
 
-    // ʼι
+    // 初始化波次管理器
     void init(int totalWaves = 10);
 
-    // ȡϢ
+    // 获取波次信息
     int getCurrentWave() const { return _currentWave; }
     int getTotalWaves() const { return _totalWaves; }
     int getZombiesRemaining() const { return _zombiesRemaining; }
     int getZombiesSpawned() const { return _zombiesSpawned; }
     WaveState getState() const { return _state; }
 
-    // ο
+    // 波次控制
     void startNextWave();
     void pauseWave();
     void resumeWave();
     void reset();
 
-    // ʬ
+    // 僵尸管理
     void zombieSpawned(Zombie* zombie);
     void zombieKilled(Zombie* zombie);
     void zombieReachedEnd(Zombie* zombie);
+    void zombieMoved(Zombie* zombie);       // 移动后越过同行相邻僵尸时标记该行需要重新排序
 
-    // 
+    // 更新
     void update(float delta);
 
-    // ûص
+    // 设置回调
     void setWaveStartedCallback(const WaveCallback& callback) { _waveStartedCallback = callback; }
     void setWaveCompletedCallback(const WaveCallback& callback) { _waveCompletedCallback = callback; }
     void setWaveAllCompletedCallback(const std::function<void()>& callback) { _allWavesCompletedCallback = callback; }
     void setGameOverCallback(const std::function<void()>& callback) { _gameOverCallback = callback; }
 
-    // ȡǰ
+    // 获取当前波次数据
     const WaveData& getCurrentWaveData() const { return _currentWaveData; }
 
-    // ɚƣĞpublicԱyԇ
+    // 生成殭屍（改為public以便測試）
     Zombie* spawnRandomZombie();
 
-    // 
+    // 设置僵尸生成的实体层级和出生x坐标（由场景注入，不再依赖Director的运行场景）
+    void setSpawnLayer(EntityLayers* layer, float spawnX);
+    // 场景销毁时解除绑定（只在仍是当前生成层时生效）
+    void detachSpawnLayer(EntityLayers* layer);
+
+    // 僵尸对象池：开局预热，死亡/到达终点的僵尸回收后跨波次、跨restartGame复用
+    void prewarmZombies(int countPerType);
+    void recycleZombie(Zombie* zombie);
+    const ZombiePool* getZombiePool() const { return _zombiePool; }
+
+    // 添加清理方法
     void clearAllZombies();
 
-    // ޸Ĕ
+    // 修改數據類型
     const std::vector<Zombie*>& getActiveZombies() const { return _activeZombies; }
 
-    std::vector<Zombie*> getZombiesInRow(int row) const;
+    // 获取某一行的僵尸（按x升序的视图，每帧在update开始时整理）
+    ZombieLaneView getZombiesInRow(int row) const;
 
 private:
     WaveManager();
     ~WaveManager();
 
-    // ֹ
+    // 禁止复制
     WaveManager(const WaveManager&) = delete;
     WaveManager& operator=(const WaveManager&) = delete;
 
-    // ɽʬ
+    // 生成僵尸
     void spawnZombie();
 
-    // ι
+    // 按波次随机僵尸类型；canSpawnZombieType判断某一波是否可能出现该类型（用于提前预取图集）
+    ZombieType pickZombieType(int waveNumber) const;
+    static int getZombieRollOffset(int waveNumber);
+    bool canSpawnZombieType(int waveNumber, ZombieType type) const;
+    void prefetchZombiesForWave(int waveNumber);
+
+    // 波次管理
     void startWave(int waveNumber);
     void completeWave();
     void gameOver();
 
-    // 鲨
+    // 检查波次完成条件
     bool isWaveComplete() const;
 
 private:
     static WaveManager* _instance;
 
-    // 
+    // 波次数据
     int _currentWave;
     int _totalWaves;
     WaveData _currentWaveData;
     WaveState _state;
 
-    // ʬ
+    // 僵尸数据
     int _zombiesSpawned;
     int _zombiesKilled;
     int _zombiesRemaining;
     int _zombiesReachedEnd;
 
-    // ʱ
+    // 计时器
     float _spawnTimer;
     float _waveTimer;
     float _preparationTimer;
 
-    // ص
+    // 回调函数
     WaveCallback _waveStartedCallback;
     WaveCallback _waveCompletedCallback;
     std::function<void()> _allWavesCompletedCallback;
     std::function<void()> _gameOverCallback;
 
-    // ʬбĺ
+    // 清理僵尸列表的函数声明
     void cleanupZombieList();
 
-    // ʬб
+    // 行索引维护
+    void addZombieToLane(Zombie* zombie);
+    void removeZombieFromLane(Zombie* zombie);
+    void refreshLanes();
+    void clearLanes();
+
+    // 僵尸列表
     std::vector<Zombie*> _activeZombies;
+
+    // 按行索引的僵尸（每行按x升序）
+    std::vector<Zombie*> _laneZombies[LANE_COUNT];
+    bool _laneDirty[LANE_COUNT];
+
+    // 生成目标
+    EntityLayers* _spawnLayer;
+    float _spawnX;
+
+    // 僵尸对象池
+    ZombiePool* _zombiePool;
+    int _evictionListener;          // TextureResidency淘汰通知的订阅ID
 };
 
 #endif // __WAVE_MANAGER_H__
\ No newline at end of file
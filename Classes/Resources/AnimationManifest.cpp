@@ -0,0 +1,374 @@
+#include "AnimationManifest.h"
+#include "json/document.h"
+#include "json/error/en.h"
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+namespace {
+    const int MAX_FRAMES_PER_ANIMATION = 0xFFFF;
+
+    // 构建时的字符串驻留：相同的名字/路径只存一份
+    class StringInterner {
+    public:
+        explicit StringInterner(std::vector<char>& strings) : _strings(strings) {}
+
+        uint32_t intern(const char* text, size_t length)
+        {
+            std::string key(text, length);
+            auto it = _offsets.find(key);
+            if (it != _offsets.end()) {
+                return it->second;
+            }
+            uint32_t offset = (uint32_t)_strings.size();
+            _strings.insert(_strings.end(), text, text + length);
+            _strings.push_back('\0');
+            _offsets.emplace(std::move(key), offset);
+            return offset;
+        }
+
+    private:
+        std::vector<char>& _strings;
+        std::unordered_map<std::string, uint32_t> _offsets;
+    };
+
+    // pattern只允许一个整数占位符（%d、%02d、%3d之类），防止清单里的格式串越界读参数
+    bool isValidFramePattern(const char* pattern)
+    {
+        int conversions = 0;
+        for (const char* p = pattern; *p; p++) {
+            if (*p != '%') {
+                continue;
+            }
+            p++;
+            if (*p == '%') {
+                continue;
+            }
+            while (*p >= '0' && *p <= '9') {
+                p++;
+            }
+            if (*p != 'd') {
+                return false;
+            }
+            conversions++;
+        }
+        return conversions == 1;
+    }
+
+    // 把数组内容拷到cursor处，返回拷完后的位置
+    template <typename T>
+    uint8_t* copyArray(uint8_t* cursor, const std::vector<T>& values)
+    {
+        if (!values.empty()) {
+            memcpy(cursor, values.data(), values.size() * sizeof(T));
+        }
+        return cursor + values.size() * sizeof(T);
+    }
+
+    // 从cursor处读出count个元素，返回读完后的位置
+    template <typename T>
+    const uint8_t* readArray(const uint8_t* cursor, std::vector<T>& values, uint32_t count)
+    {
+        values.resize(count);
+        if (count > 0) {
+            memcpy(values.data(), cursor, count * sizeof(T));
+        }
+        return cursor + count * sizeof(T);
+    }
+
+    const char* const PIXEL_FORMAT_NAMES[] = { "DEFAULT", "RGBA8888", "RGBA4444", "RGB565", "A8", "ETC1" };
+    const int PIXEL_FORMAT_COUNT = sizeof(PIXEL_FORMAT_NAMES) / sizeof(PIXEL_FORMAT_NAMES[0]);
+
+    void setError(std::string* error, const std::string& message)
+    {
+        if (error) {
+            *error = message;
+        }
+    }
+}
+
+const char AnimationManifest::FILE_MAGIC[8] = { 'P', 'V', 'Z', 'A', 'N', 'I', 'M', '\0' };
+const uint32_t AnimationManifest::FILE_VERSION;
+
+void AnimationManifest::clear()
+{
+    _entries.clear();
+    _textureGroups.clear();
+    _frames.clear();
+    _prefixes.clear();
+    _strings.clear();
+}
+
+const char* AnimationManifest::getPixelFormatName(PixelFormat format)
+{
+    return format < PIXEL_FORMAT_COUNT ? PIXEL_FORMAT_NAMES[format] : "?";
+}
+
+int AnimationManifest::findTextureGroup(const char* name) const
+{
+    for (size_t i = 0; i < _textureGroups.size(); i++) {
+        if (strcmp(getName(_textureGroups[i]), name) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+int AnimationManifest::findTextureGroupForPath(const char* path) const
+{
+    int best = -1;
+    size_t bestLength = 0;
+    for (size_t i = 0; i < _textureGroups.size(); i++) {
+        const TextureGroup& group = _textureGroups[i];
+        for (int p = 0; p < group.prefixCount; p++) {
+            const char* prefix = getPrefix(group, p);
+            size_t length = strlen(prefix);
+            if (length > bestLength && strstr(path, prefix) != nullptr) {
+                best = (int)i;
+                bestLength = length;
+            }
+        }
+    }
+    return best;
+}
+
+int AnimationManifest::findAnimation(const char* name) const
+{
+    for (size_t i = 0; i < _entries.size(); i++) {
+        if (strcmp(getName(_entries[i]), name) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+bool AnimationManifest::loadJson(const char* text, size_t size, std::string* error)
+{
+    clear();
+
+    rapidjson::Document document;
+    document.Parse<rapidjson::kParseCommentsFlag>(text, size);
+    if (document.HasParseError()) {
+        setError(error, std::string("JSON parse error at offset ") + std::to_string(document.GetErrorOffset()) +
+            ": " + rapidjson::GetParseError_En(document.GetParseError()));
+        return false;
+    }
+
+    if (!document.IsObject() || !document.HasMember("animations") || !document["animations"].IsArray()) {
+        setError(error, "missing \"animations\" array");
+        return false;
+    }
+
+    StringInterner interner(_strings);
+    const rapidjson::Value& animations = document["animations"];
+    char framePath[512];
+
+    for (rapidjson::SizeType i = 0; i < animations.Size(); i++) {
+        const rapidjson::Value& item = animations[i];
+        std::string where = "animations[" + std::to_string(i) + "]";
+
+        if (!item.IsObject() || !item.HasMember("name") || !item["name"].IsString() ||
+            !item.HasMember("frames")) {
+            setError(error, where + ": needs \"name\" and \"frames\"");
+            clear();
+            return false;
+        }
+
+        const rapidjson::Value& name = item["name"];
+        if (findAnimation(name.GetString()) >= 0) {
+            setError(error, where + ": duplicate animation \"" + name.GetString() + "\"");
+            clear();
+            return false;
+        }
+
+        Entry entry;
+        entry.name = interner.intern(name.GetString(), name.GetStringLength());
+        entry.group = item.HasMember("group") && item["group"].IsString()
+            ? interner.intern(item["group"].GetString(), item["group"].GetStringLength())
+            : interner.intern("", 0);
+        entry.firstFrame = (uint32_t)_frames.size();
+        entry.flags = 0;
+        entry.reserved = 0;
+        entry.delay = item.HasMember("delay") && item["delay"].IsNumber() ? item["delay"].GetFloat() : 0.1f;
+        if (item.HasMember("loop") && item["loop"].IsBool() && item["loop"].GetBool()) {
+            entry.flags |= FLAG_LOOP;
+        }
+        if (item.HasMember("restore") && item["restore"].IsBool() && item["restore"].GetBool()) {
+            entry.flags |= FLAG_RESTORE;
+        }
+
+        // frames: 路径数组，或 { "pattern": "xxx_%02d.png", "count": N, "start": 1 }
+        const rapidjson::Value& frames = item["frames"];
+        if (frames.IsArray()) {
+            for (rapidjson::SizeType f = 0; f < frames.Size(); f++) {
+                if (!frames[f].IsString()) {
+                    setError(error, where + ": frame paths must be strings");
+                    clear();
+                    return false;
+                }
+                _frames.push_back(interner.intern(frames[f].GetString(), frames[f].GetStringLength()));
+            }
+        } else if (frames.IsObject() && frames.HasMember("pattern") && frames["pattern"].IsString() &&
+                   frames.HasMember("count") && frames["count"].IsInt()) {
+            const char* pattern = frames["pattern"].GetString();
+            int count = frames["count"].GetInt();
+            int start = frames.HasMember("start") && frames["start"].IsInt() ? frames["start"].GetInt() : 1;
+            if (!isValidFramePattern(pattern) || count < 0 || count > MAX_FRAMES_PER_ANIMATION) {
+                setError(error, where + ": bad frame pattern or count");
+                clear();
+                return false;
+            }
+            for (int f = 0; f < count; f++) {
+                int length = snprintf(framePath, sizeof(framePath), pattern, start + f);
+                if (length < 0 || length >= (int)sizeof(framePath)) {
+                    setError(error, where + ": frame path too long");
+                    clear();
+                    return false;
+                }
+                _frames.push_back(interner.intern(framePath, (size_t)length));
+            }
+        } else {
+            setError(error, where + ": \"frames\" must be an array or {pattern, count}");
+            clear();
+            return false;
+        }
+
+        size_t frameCount = _frames.size() - entry.firstFrame;
+        if (frameCount == 0 || frameCount > (size_t)MAX_FRAMES_PER_ANIMATION) {
+            setError(error, where + ": frame count out of range");
+            clear();
+            return false;
+        }
+        entry.frameCount = (uint16_t)frameCount;
+        _entries.push_back(entry);
+    }
+
+    // textureGroups（可选）: [{ "name": "zombies", "paths": ["Images/Zombies/"], "pixelFormat": "RGBA4444" }]
+    if (document.HasMember("textureGroups")) {
+        const rapidjson::Value& groups = document["textureGroups"];
+        if (!groups.IsArray()) {
+            setError(error, "\"textureGroups\" must be an array");
+            clear();
+            return false;
+        }
+        for (rapidjson::SizeType i = 0; i < groups.Size(); i++) {
+            const rapidjson::Value& item = groups[i];
+            std::string where = "textureGroups[" + std::to_string(i) + "]";
+            if (!item.IsObject() || !item.HasMember("name") || !item["name"].IsString() ||
+                !item.HasMember("paths") || !item["paths"].IsArray()) {
+                setError(error, where + ": needs \"name\" and \"paths\"");
+                clear();
+                return false;
+            }
+
+            TextureGroup group;
+            group.name = interner.intern(item["name"].GetString(), item["name"].GetStringLength());
+            group.firstPrefix = (uint32_t)_prefixes.size();
+            group.pixelFormat = PIXEL_DEFAULT;
+            group.reserved = 0;
+
+            if (item.HasMember("pixelFormat")) {
+                const rapidjson::Value& format = item["pixelFormat"];
+                int found = -1;
+                for (int f = 0; format.IsString() && f < PIXEL_FORMAT_COUNT; f++) {
+                    if (strcmp(format.GetString(), PIXEL_FORMAT_NAMES[f]) == 0) {
+                        found = f;
+                    }
+                }
+                if (found < 0) {
+                    setError(error, where + ": unknown pixelFormat");
+                    clear();
+                    return false;
+                }
+                group.pixelFormat = (uint8_t)found;
+            }
+
+            const rapidjson::Value& paths = item["paths"];
+            for (rapidjson::SizeType p = 0; p < paths.Size(); p++) {
+                if (!paths[p].IsString() || paths[p].GetStringLength() == 0) {
+                    setError(error, where + ": paths must be non-empty strings");
+                    clear();
+                    return false;
+                }
+                _prefixes.push_back(interner.intern(paths[p].GetString(), paths[p].GetStringLength()));
+            }
+            group.prefixCount = (uint16_t)(_prefixes.size() - group.firstPrefix);
+            _textureGroups.push_back(group);
+        }
+    }
+
+    return true;
+}
+
+std::vector<uint8_t> AnimationManifest::toBinary() const
+{
+    FileHeader header;
+    memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+    header.version = FILE_VERSION;
+    header.animationCount = (uint32_t)_entries.size();
+    header.frameCount = (uint32_t)_frames.size();
+    header.textureGroupCount = (uint32_t)_textureGroups.size();
+    header.prefixCount = (uint32_t)_prefixes.size();
+    header.stringBytes = (uint32_t)_strings.size();
+
+    std::vector<uint8_t> out(sizeof(header) + _entries.size() * sizeof(Entry) +
+        _textureGroups.size() * sizeof(TextureGroup) + (_frames.size() + _prefixes.size()) * sizeof(uint32_t) +
+        _strings.size());
+    uint8_t* cursor = out.data();
+    memcpy(cursor, &header, sizeof(header));
+    cursor = copyArray(cursor + sizeof(header), _entries);
+    cursor = copyArray(cursor, _textureGroups);
+    cursor = copyArray(cursor, _frames);
+    cursor = copyArray(cursor, _prefixes);
+    copyArray(cursor, _strings);
+    return out;
+}
+
+bool AnimationManifest::loadBinary(const uint8_t* data, size_t size)
+{
+    clear();
+
+    FileHeader header;
+    if (!data || size < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, FILE_MAGIC, sizeof(header.magic)) != 0 || header.version != FILE_VERSION) {
+        return false;
+    }
+
+    size_t tableBytes = (size_t)header.animationCount * sizeof(Entry) +
+        (size_t)header.textureGroupCount * sizeof(TextureGroup) +
+        ((size_t)header.frameCount + header.prefixCount) * sizeof(uint32_t);
+    if (size != sizeof(header) + tableBytes + header.stringBytes || header.stringBytes == 0) {
+        return false;
+    }
+
+    const uint8_t* cursor = data + sizeof(header);
+    cursor = readArray(cursor, _entries, header.animationCount);
+    cursor = readArray(cursor, _textureGroups, header.textureGroupCount);
+    cursor = readArray(cursor, _frames, header.frameCount);
+    cursor = readArray(cursor, _prefixes, header.prefixCount);
+    _strings.assign((const char*)cursor, (const char*)cursor + header.stringBytes);
+
+    // 校验所有偏移都落在表内，字符串表以'\0'结尾，坏文件不会读越界
+    bool valid = _strings.back() == '\0';
+    for (uint32_t offset : _frames) {
+        valid = valid && offset < header.stringBytes;
+    }
+    for (uint32_t offset : _prefixes) {
+        valid = valid && offset < header.stringBytes;
+    }
+    for (const TextureGroup& group : _textureGroups) {
+        valid = valid && group.name < header.stringBytes && group.pixelFormat < PIXEL_FORMAT_COUNT &&
+            (uint64_t)group.firstPrefix + group.prefixCount <= header.prefixCount;
+    }
+    for (const Entry& entry : _entries) {
+        valid = valid && entry.name < header.stringBytes && entry.group < header.stringBytes &&
+            entry.frameCount > 0 && (uint64_t)entry.firstFrame + entry.frameCount <= header.frameCount;
+    }
+    if (!valid) {
+        clear();
+    }
+    return valid;
+}
@@ -0,0 +1,108 @@
+#pragma once
+#ifndef __ANIMATION_MANIFEST_H__
+#define __ANIMATION_MANIFEST_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// AnimationManifest - 帧序列动画清单（Resources/Configs/animations.json）
+// 包含动画定义和纹理分组（每组的路径前缀和纹理像素格式）。
+// 所有名字和帧路径驻留在一块字符串表里（去重，'\0'结尾），每个动画只记偏移和帧区间，
+// 查询返回const char*，不产生std::string。
+// 发布时用proj.headless的pvz_animc把JSON编译成animations.bin，运行时直接整块读入校验即可，
+// 不解析JSON；没有.bin时退回用rapidjson解析JSON（结果完全相同）。不依赖cocos2d。
+class AnimationManifest {
+public:
+    static const char FILE_MAGIC[8];
+    static const uint32_t FILE_VERSION = 2;
+
+    enum Flags : uint8_t {
+        FLAG_LOOP = 1 << 0,         // 循环播放
+        FLAG_RESTORE = 1 << 1       // 播完恢复原始帧
+    };
+
+    // 纹理像素格式（与cocos2d的Texture2D::PixelFormat对应，由ResourceLoader转换）
+    enum PixelFormat : uint8_t {
+        PIXEL_DEFAULT,          // 不指定，用全局默认（RGBA8888）
+        PIXEL_RGBA8888,
+        PIXEL_RGBA4444,
+        PIXEL_RGB565,           // 无透明通道，适合背景
+        PIXEL_A8,               // 只有透明通道，适合单色UI
+        PIXEL_ETC1              // ETC1 + 单独的透明通道纹理，设备不支持或没有.pkm时按RGBA4444
+    };
+
+    // 一个动画；name/group为字符串表偏移，帧为帧表[firstFrame, firstFrame + frameCount)
+    struct Entry {
+        uint32_t name;
+        uint32_t group;
+        uint32_t firstFrame;
+        uint16_t frameCount;
+        uint8_t flags;
+        uint8_t reserved;
+        float delay;
+    };
+
+    // 一个纹理分组；路径包含前缀表[firstPrefix, firstPrefix + prefixCount)中任一项的纹理属于该组
+    struct TextureGroup {
+        uint32_t name;
+        uint32_t firstPrefix;
+        uint16_t prefixCount;
+        uint8_t pixelFormat;
+        uint8_t reserved;
+    };
+
+    // 解析JSON文本；失败时清空并把原因写进error
+    bool loadJson(const char* text, size_t size, std::string* error = nullptr);
+
+    // 读入pvz_animc生成的二进制索引（会拷贝数据）；格式或版本不符返回false
+    bool loadBinary(const uint8_t* data, size_t size);
+
+    // 序列化为二进制索引（小端，pvz_animc写文件用）
+    std::vector<uint8_t> toBinary() const;
+
+    void clear();
+
+    int getAnimationCount() const { return (int)_entries.size(); }
+    const Entry& getAnimation(int index) const { return _entries[index]; }
+    // 按名字查找，找不到返回-1
+    int findAnimation(const char* name) const;
+
+    const char* getName(const Entry& entry) const { return &_strings[entry.name]; }
+    const char* getGroup(const Entry& entry) const { return &_strings[entry.group]; }
+    const char* getFrame(const Entry& entry, int index) const { return &_strings[_frames[entry.firstFrame + index]]; }
+
+    int getTextureGroupCount() const { return (int)_textureGroups.size(); }
+    const TextureGroup& getTextureGroup(int index) const { return _textureGroups[index]; }
+    const char* getName(const TextureGroup& group) const { return &_strings[group.name]; }
+    const char* getPrefix(const TextureGroup& group, int index) const { return &_strings[_prefixes[group.firstPrefix + index]]; }
+    // 按名字查找纹理分组，找不到返回-1
+    int findTextureGroup(const char* name) const;
+    // 路径所属的纹理分组（匹配最长前缀），都不匹配返回-1；路径可以是完整路径
+    int findTextureGroupForPath(const char* path) const;
+
+    static const char* getPixelFormatName(PixelFormat format);
+
+    int getTotalFrameCount() const { return (int)_frames.size(); }
+    size_t getStringTableSize() const { return _strings.size(); }
+
+private:
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t animationCount;
+        uint32_t frameCount;
+        uint32_t textureGroupCount;
+        uint32_t prefixCount;
+        uint32_t stringBytes;
+    };
+
+    std::vector<Entry> _entries;
+    std::vector<TextureGroup> _textureGroups;
+    std::vector<uint32_t> _frames;      // 帧路径在字符串表中的偏移
+    std::vector<uint32_t> _prefixes;    // 纹理分组路径前缀在字符串表中的偏移
+    std::vector<char> _strings;
+};
+
+#endif // __ANIMATION_MANIFEST_H__
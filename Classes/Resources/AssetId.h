@@ -0,0 +1,176 @@
+#pragma once
+#ifndef __ASSET_ID_H__
+#define __ASSET_ID_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// AssetId - 资源名（动画名、_resourcePaths中的逻辑名）的32位哈希
+// 热路径（每次播放动画、每发子弹的音效）用PVZ_ASSET_ID("pea_fly")在编译期算好ID，运行时只做一次整数查表；
+// 按字符串查的接口保留给工具和调试，内部先算哈希再查同一张表。
+// 哈希用FNV-1a：实现简单，C++14的constexpr能直接求值（external/xxhash是C实现，不能在编译期算）。
+// 0保留为无效ID。ResourceLoader登记名字时检查冲突。不依赖cocos2d。
+typedef uint32_t AssetId;
+
+const AssetId INVALID_ASSET_ID = 0;
+
+constexpr AssetId hashAssetName(const char* name)
+{
+    uint32_t hash = 2166136261u;
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash != INVALID_ASSET_ID ? hash : 1;
+}
+
+inline AssetId hashAssetName(const std::string& name)
+{
+    return hashAssetName(name.c_str());
+}
+
+// 强制编译期求值
+#define PVZ_ASSET_ID(name) (std::integral_constant<AssetId, hashAssetName(name)>::value)
+
+// AssetIdMap - 以AssetId为键的开放寻址哈希表（线性探测，负载不超过一半）
+// 槽位连续存放，查找不分配内存；T需要可默认构造。
+template <typename T>
+class AssetIdMap {
+public:
+    AssetIdMap() : _count(0) {}
+
+    T* find(AssetId id)
+    {
+        size_t index = findIndex(id);
+        return index < _slots.size() ? &_slots[index].value : nullptr;
+    }
+
+    const T* find(AssetId id) const
+    {
+        size_t index = findIndex(id);
+        return index < _slots.size() ? &_slots[index].value : nullptr;
+    }
+
+    // 不存在时插入默认值
+    T& operator[](AssetId id)
+    {
+        T* value = find(id);
+        if (value) {
+            return *value;
+        }
+        if ((_count + 1) * 2 > _slots.size()) {
+            rehash(_slots.empty() ? 16 : _slots.size() * 2);
+        }
+        Slot& slot = findFreeSlot(id);
+        slot.id = id;
+        _count++;
+        return slot.value;
+    }
+
+    bool erase(AssetId id)
+    {
+        size_t hole = findIndex(id);
+        if (hole >= _slots.size()) {
+            return false;
+        }
+
+        // 向后移位删除：把后面探测链上的元素挪进空位，保持链不断
+        size_t mask = _slots.size() - 1;
+        for (size_t i = (hole + 1) & mask; _slots[i].id != INVALID_ASSET_ID; i = (i + 1) & mask) {
+            size_t home = _slots[i].id & mask;
+            // home不在(hole, i]区间内时，这个元素可以挪到hole
+            bool movable = hole <= i ? (home <= hole || home > i) : (home <= hole && home > i);
+            if (movable) {
+                _slots[hole] = std::move(_slots[i]);
+                hole = i;
+            }
+        }
+        _slots[hole].id = INVALID_ASSET_ID;
+        _slots[hole].value = T();
+        _count--;
+        return true;
+    }
+
+    void clear()
+    {
+        _slots.clear();
+        _count = 0;
+    }
+
+    size_t size() const { return _count; }
+    bool empty() const { return _count == 0; }
+
+    // 遍历（顺序不确定）：func(AssetId, T&)
+    template <typename Func>
+    void forEach(Func func)
+    {
+        for (auto& slot : _slots) {
+            if (slot.id != INVALID_ASSET_ID) {
+                func(slot.id, slot.value);
+            }
+        }
+    }
+
+    template <typename Func>
+    void forEach(Func func) const
+    {
+        for (const auto& slot : _slots) {
+            if (slot.id != INVALID_ASSET_ID) {
+                func(slot.id, slot.value);
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        AssetId id = INVALID_ASSET_ID;
+        T value = T();
+    };
+
+    // 找不到返回_slots.size()
+    size_t findIndex(AssetId id) const
+    {
+        if (_slots.empty() || id == INVALID_ASSET_ID) {
+            return _slots.size();
+        }
+        size_t mask = _slots.size() - 1;
+        for (size_t i = id & mask; _slots[i].id != INVALID_ASSET_ID; i = (i + 1) & mask) {
+            if (_slots[i].id == id) {
+                return i;
+            }
+        }
+        return _slots.size();
+    }
+
+    Slot& findFreeSlot(AssetId id)
+    {
+        size_t mask = _slots.size() - 1;
+        size_t i = id & mask;
+        while (_slots[i].id != INVALID_ASSET_ID) {
+            i = (i + 1) & mask;
+        }
+        return _slots[i];
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> old(capacity);
+        old.swap(_slots);
+        for (auto& slot : old) {
+            if (slot.id != INVALID_ASSET_ID) {
+                Slot& target = findFreeSlot(slot.id);
+                target.id = slot.id;
+                target.value = std::move(slot.value);
+            }
+        }
+    }
+
+    std::vector<Slot> _slots;
+    size_t _count;
+};
+
+#endif // __ASSET_ID_H__
@@ -0,0 +1,312 @@
+#include "AssetPack.h"
+#include "AssetId.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const char AssetPack::FILE_MAGIC[8] = { 'P', 'V', 'Z', 'P', 'A', 'C', 'K', '\0' };
+
+namespace {
+
+const uint64_t DATA_ALIGNMENT = 16;
+
+void setError(std::string* error, const std::string& message)
+{
+    if (error) {
+        *error = message;
+    }
+}
+
+} // namespace
+
+AssetPack::AssetPack()
+    : _base(nullptr)
+    , _mappedSize(0)
+    , _header(nullptr)
+    , _entries(nullptr)
+    , _strings(nullptr)
+#ifdef _WIN32
+    , _fileHandle(nullptr)
+    , _mappingHandle(nullptr)
+#endif
+{
+}
+
+AssetPack::~AssetPack()
+{
+    close();
+}
+
+#ifdef _WIN32
+
+bool AssetPack::map(const std::string& path, std::string* error)
+{
+    // 路径是UTF-8
+    int length = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+    std::wstring widePath(length > 0 ? length : 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, &widePath[0], length);
+
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        setError(error, "cannot open " + path);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+    const void* base = nullptr;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        base = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    }
+    if (!base) {
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        setError(error, "cannot map " + path);
+        return false;
+    }
+
+    _fileHandle = file;
+    _mappingHandle = mapping;
+    _base = static_cast<const uint8_t*>(base);
+    _mappedSize = (size_t)size.QuadPart;
+    return true;
+}
+
+void AssetPack::unmap()
+{
+    if (_base) {
+        UnmapViewOfFile(_base);
+    }
+    if (_mappingHandle) {
+        CloseHandle(_mappingHandle);
+    }
+    if (_fileHandle) {
+        CloseHandle(_fileHandle);
+    }
+    _fileHandle = nullptr;
+    _mappingHandle = nullptr;
+}
+
+#else
+
+bool AssetPack::map(const std::string& path, std::string* error)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        setError(error, "cannot open " + path);
+        return false;
+    }
+
+    struct stat info;
+    void* base = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        base = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    // 映射建立后文件描述符就不需要了
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        setError(error, "cannot map " + path);
+        return false;
+    }
+
+    _base = static_cast<const uint8_t*>(base);
+    _mappedSize = (size_t)info.st_size;
+    return true;
+}
+
+void AssetPack::unmap()
+{
+    if (_base) {
+        munmap(const_cast<uint8_t*>(_base), _mappedSize);
+    }
+}
+
+#endif
+
+bool AssetPack::open(const std::string& path, std::string* error)
+{
+    close();
+    if (!map(path, error)) {
+        return false;
+    }
+
+    // 校验头和索引，之后find不再做边界检查
+    const FileHeader* header = reinterpret_cast<const FileHeader*>(_base);
+    uint64_t indexEnd = sizeof(FileHeader) + (uint64_t)sizeof(Entry) * (_mappedSize >= sizeof(FileHeader) ? header->entryCount : 0);
+    if (_mappedSize < sizeof(FileHeader) || memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+        setError(error, path + ": not an asset pack");
+        close();
+        return false;
+    }
+    if (header->version != FILE_VERSION) {
+        setError(error, path + ": unsupported pack version");
+        close();
+        return false;
+    }
+    if (indexEnd + header->stringBytes > _mappedSize ||
+        (header->stringBytes > 0 && _base[indexEnd + header->stringBytes - 1] != '\0')) {
+        setError(error, path + ": truncated index");
+        close();
+        return false;
+    }
+
+    const Entry* entries = reinterpret_cast<const Entry*>(_base + sizeof(FileHeader));
+    for (uint32_t i = 0; i < header->entryCount; i++) {
+        const Entry& entry = entries[i];
+        if (entry.path >= header->stringBytes || entry.offset > _mappedSize || entry.size > _mappedSize - entry.offset ||
+            (i > 0 && entry.hash < entries[i - 1].hash)) {
+            setError(error, path + ": corrupt index");
+            close();
+            return false;
+        }
+    }
+
+    _header = header;
+    _entries = entries;
+    _strings = reinterpret_cast<const char*>(_base + sizeof(FileHeader) + sizeof(Entry) * header->entryCount);
+    return true;
+}
+
+void AssetPack::close()
+{
+    unmap();
+    _base = nullptr;
+    _mappedSize = 0;
+    _header = nullptr;
+    _entries = nullptr;
+    _strings = nullptr;
+}
+
+bool AssetPack::find(const char* path, View* view) const
+{
+    if (!_header) {
+        return false;
+    }
+
+    uint32_t hash = hashAssetName(path);
+    const Entry* end = _entries + _header->entryCount;
+    const Entry* it = std::lower_bound(_entries, end, hash,
+        [](const Entry& entry, uint32_t value) { return entry.hash < value; });
+    for (; it != end && it->hash == hash; ++it) {
+        if (strcmp(_strings + it->path, path) == 0) {
+            view->data = _base + it->offset;
+            view->size = (size_t)it->size;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* AssetPack::getEntryPath(int index) const
+{
+    return _strings + _entries[index].path;
+}
+
+bool AssetPack::write(const std::string& outputPath,
+    const std::vector<std::pair<std::string, std::string>>& files, std::string* error)
+{
+    struct Pending {
+        Entry entry;
+        std::string packPath;
+        std::string diskPath;
+    };
+
+    std::vector<Pending> pending;
+    pending.reserve(files.size());
+    for (const auto& file : files) {
+        Pending item;
+        memset(&item.entry, 0, sizeof(item.entry));
+        item.entry.hash = hashAssetName(file.first);
+        item.packPath = file.first;
+        item.diskPath = file.second;
+        pending.push_back(item);
+    }
+    std::sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        return a.entry.hash != b.entry.hash ? a.entry.hash < b.entry.hash : a.packPath < b.packPath;
+    });
+
+    std::vector<char> strings;
+    for (size_t i = 0; i < pending.size(); i++) {
+        if (i > 0 && pending[i].packPath == pending[i - 1].packPath) {
+            setError(error, "duplicate path " + pending[i].packPath);
+            return false;
+        }
+        pending[i].entry.path = (uint32_t)strings.size();
+        strings.insert(strings.end(), pending[i].packPath.begin(), pending[i].packPath.end());
+        strings.push_back('\0');
+    }
+
+    FileHeader header;
+    memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = FILE_VERSION;
+    header.entryCount = (uint32_t)pending.size();
+    header.stringBytes = (uint32_t)strings.size();
+    header.reserved = 0;
+
+    FILE* output = fopen(outputPath.c_str(), "wb");
+    if (!output) {
+        setError(error, "cannot write " + outputPath);
+        return false;
+    }
+
+    // 先占位写索引，写完数据后回填偏移
+    uint64_t position = sizeof(FileHeader) + sizeof(Entry) * pending.size() + strings.size();
+    std::vector<uint8_t> zeros(DATA_ALIGNMENT, 0);
+    bool ok = fseek(output, (long)position, SEEK_SET) == 0;
+    for (auto& item : pending) {
+        if (!ok) {
+            break;
+        }
+        uint64_t padding = (DATA_ALIGNMENT - position % DATA_ALIGNMENT) % DATA_ALIGNMENT;
+        ok = fwrite(zeros.data(), 1, (size_t)padding, output) == padding;
+        position += padding;
+
+        FILE* input = fopen(item.diskPath.c_str(), "rb");
+        if (!input) {
+            setError(error, "cannot open " + item.diskPath);
+            fclose(output);
+            return false;
+        }
+        item.entry.offset = position;
+        char chunk[65536];
+        size_t count = 0;
+        while (ok && (count = fread(chunk, 1, sizeof(chunk), input)) > 0) {
+            ok = fwrite(chunk, 1, count, output) == count;
+            position += count;
+        }
+        fclose(input);
+        item.entry.size = position - item.entry.offset;
+    }
+
+    if (ok) {
+        ok = fseek(output, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, output) == 1;
+        for (size_t i = 0; ok && i < pending.size(); i++) {
+            ok = fwrite(&pending[i].entry, sizeof(Entry), 1, output) == 1;
+        }
+        ok = ok && (strings.empty() || fwrite(strings.data(), 1, strings.size(), output) == strings.size());
+    }
+    if (fclose(output) != 0 || !ok) {
+        setError(error, "write failed: " + outputPath);
+        return false;
+    }
+    return true;
+}
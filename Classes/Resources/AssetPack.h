@@ -0,0 +1,79 @@
+#pragma once
+#ifndef __ASSET_PACK_H__
+#define __ASSET_PACK_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// AssetPack - 资源包（把Resources/下的所有文件打进一个文件）
+// 文件头后面是按路径哈希排序的索引和路径字符串表，再后面是各文件的原始内容（16字节对齐）。
+// 运行时整个文件内存映射（mmap / MapViewOfFile），查找只在映射的索引上二分，
+// 返回的View直接指向映射内存，不打开文件、不拷贝；包打开期间一直有效，可以在多个线程里同时读。
+// 由proj.headless的pvz_assetpack生成（write）。不依赖cocos2d。
+class AssetPack {
+public:
+    static const char FILE_MAGIC[8];
+    static const uint32_t FILE_VERSION = 1;
+
+    struct View {
+        const uint8_t* data;
+        size_t size;
+    };
+
+    AssetPack();
+    ~AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // 映射并校验包文件；失败时返回false并把原因写进error
+    bool open(const std::string& path, std::string* error = nullptr);
+    void close();
+    bool isOpen() const { return _base != nullptr; }
+
+    // 按包内路径（相对Resources/，'/'分隔）查找
+    bool find(const char* path, View* view) const;
+
+    int getEntryCount() const { return _header ? (int)_header->entryCount : 0; }
+    const char* getEntryPath(int index) const;
+    size_t getMappedSize() const { return _mappedSize; }
+
+    // 写包：files为(包内路径, 磁盘路径)；包内路径重复时报错
+    static bool write(const std::string& outputPath,
+        const std::vector<std::pair<std::string, std::string>>& files, std::string* error = nullptr);
+
+private:
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t stringBytes;
+        uint32_t reserved;
+    };
+
+    // path为字符串表偏移；offset从文件开头算
+    struct Entry {
+        uint32_t hash;
+        uint32_t path;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    bool map(const std::string& path, std::string* error);
+    void unmap();
+
+    const uint8_t* _base;
+    size_t _mappedSize;
+    const FileHeader* _header;
+    const Entry* _entries;
+    const char* _strings;
+
+#ifdef _WIN32
+    void* _fileHandle;
+    void* _mappingHandle;
+#endif
+};
+
+#endif // __ASSET_PACK_H__
@@ -0,0 +1,234 @@
+#include "AssetPipeline.h"
+#include "ResourceLoader.h"
+#include "PackFileUtils.h"
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
+#include <algorithm>
+#include <chrono>
+
+USING_NS_CC;
+
+namespace {
+    const float DEFAULT_UPLOAD_BUDGET = 0.004f;     // 每帧4ms，60fps下留足渲染时间
+    const unsigned int MAX_WORKERS = 4;
+    const char* const SCHEDULE_KEY = "AssetPipeline::update";
+}
+
+AssetPipeline* AssetPipeline::_instance = nullptr;
+
+AssetPipeline* AssetPipeline::getInstance()
+{
+    if (_instance == nullptr)
+    {
+        _instance = new AssetPipeline();
+    }
+    return _instance;
+}
+
+AssetPipeline::AssetPipeline()
+    : _stopping(false)
+    , _uploadBudget(DEFAULT_UPLOAD_BUDGET)
+    , _totalCount(0)
+    , _completedCount(0)
+    , _scheduled(false)
+{
+}
+
+AssetPipeline::~AssetPipeline()
+{
+    shutdown();
+    _instance = nullptr;
+}
+
+void AssetPipeline::startWorkers()
+{
+    if (!_workers.empty())
+    {
+        return;
+    }
+
+    // 留一个核给主线程
+    unsigned int cores = std::thread::hardware_concurrency();
+    unsigned int count = std::max(1u, std::min(MAX_WORKERS, cores > 1 ? cores - 1 : 1u));
+    for (unsigned int i = 0; i < count; i++)
+    {
+        _workers.emplace_back(&AssetPipeline::workerLoop, this);
+    }
+    PVZ_LOGI(LogCategory::RESOURCE, "AssetPipeline: %u decode workers", count);
+}
+
+void AssetPipeline::shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _jobCondition.notify_all();
+    for (auto& worker : _workers)
+    {
+        worker.join();
+    }
+    _workers.clear();
+
+    for (auto& job : _decodedJobs)
+    {
+        CC_SAFE_RELEASE(job.image);
+    }
+    _decodedJobs.clear();
+    _pendingJobs.clear();
+    _inFlight.clear();
+    // 还在调度的update看到空闲会自行注销（退出时Director可能已销毁，这里不碰调度器）
+    _totalCount = _completedCount = 0;
+    _stopping = false;
+}
+
+void AssetPipeline::enqueueImages(const std::vector<std::string>& paths)
+{
+    auto fileUtils = FileUtils::getInstance();
+    auto textureCache = Director::getInstance()->getTextureCache();
+    auto resourceLoader = ResourceLoader::getInstance();
+
+    // 上一批已完成则从零开始计数
+    if (isIdle())
+    {
+        _totalCount = _completedCount = 0;
+    }
+
+    int added = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& path : paths)
+        {
+            // 完整路径在主线程解析（FileUtils的路径缓存不是线程安全的）
+            std::string fullPath = fileUtils->fullPathForFilename(path);
+            if (fullPath.empty())
+            {
+                PVZ_LOGW(LogCategory::RESOURCE, "AssetPipeline: file not found: %s", path.c_str());
+                continue;
+            }
+            if (textureCache->getTextureForKey(fullPath) ||
+                std::find(_inFlight.begin(), _inFlight.end(), fullPath) != _inFlight.end())
+            {
+                continue;
+            }
+
+            _inFlight.push_back(fullPath);
+            _pendingJobs.push_back({ path, fullPath, resourceLoader->getPixelFormatForPath(path), nullptr });
+            added++;
+        }
+    }
+
+    if (added == 0)
+    {
+        return;
+    }
+
+    _totalCount += added;
+    startWorkers();
+    _jobCondition.notify_all();
+
+    if (!_scheduled)
+    {
+        Director::getInstance()->getScheduler()->schedule(
+            CC_CALLBACK_1(AssetPipeline::update, this), this, 0.0f, false, SCHEDULE_KEY);
+        _scheduled = true;
+    }
+    PVZ_LOGD(LogCategory::RESOURCE, "AssetPipeline: %d images queued (%d/%d done)",
+        added, _completedCount, _totalCount);
+}
+
+void AssetPipeline::workerLoop()
+{
+    for (;;)
+    {
+        DecodeJob job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _jobCondition.wait(lock, [this]() { return _stopping || !_pendingJobs.empty(); });
+            if (_stopping)
+            {
+                return;
+            }
+            job = std::move(_pendingJobs.front());
+            _pendingJobs.pop_front();
+        }
+
+        // 与TextureCache的加载线程（Image::initWithImageFileThreadSafe）一样：按完整路径读文件再解码，
+        // 不经过FileUtils的路径查找。挂载了资源包时直接解码映射内存，不拷贝
+        PVZ_PROFILE_ZONE("AssetPipeline::decode");
+        AssetPack::View view;
+        Data data;
+        if (!PackFileUtils::findFile(job.fullPath, &view))
+        {
+            data = FileUtils::getInstance()->getDataFromFile(job.fullPath);
+            view.data = data.getBytes();
+            view.size = (size_t)data.getSize();
+        }
+        Image* image = view.data ? new (std::nothrow) Image() : nullptr;
+        if (image && !image->initWithImageData(view.data, (ssize_t)view.size))
+        {
+            CC_SAFE_RELEASE_NULL(image);
+        }
+        job.image = image;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _decodedJobs.push_back(std::move(job));
+    }
+}
+
+void AssetPipeline::update(float delta)
+{
+    PVZ_PROFILE_ZONE("AssetPipeline::upload");
+
+    auto textureCache = Director::getInstance()->getTextureCache();
+    auto start = std::chrono::steady_clock::now();
+    int uploaded = 0;
+
+    for (;;)
+    {
+        DecodeJob job;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_decodedJobs.empty())
+            {
+                break;
+            }
+            job = std::move(_decodedJobs.front());
+            _decodedJobs.pop_front();
+        }
+
+        if (job.image)
+        {
+            auto previousFormat = Texture2D::getDefaultAlphaPixelFormat();
+            Texture2D::setDefaultAlphaPixelFormat(job.pixelFormat);
+            textureCache->addImage(job.image, job.fullPath);
+            Texture2D::setDefaultAlphaPixelFormat(previousFormat);
+            job.image->release();
+        }
+        else
+        {
+            PVZ_LOGE(LogCategory::RESOURCE, "AssetPipeline: failed to decode %s", job.path.c_str());
+        }
+        _inFlight.erase(std::remove(_inFlight.begin(), _inFlight.end(), job.fullPath), _inFlight.end());
+        _completedCount++;
+        uploaded++;
+
+        std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= _uploadBudget)
+        {
+            break;
+        }
+    }
+
+    if (uploaded > 0)
+    {
+        PVZ_LOGT(LogCategory::RESOURCE, "AssetPipeline: uploaded %d textures (%d/%d)",
+            uploaded, _completedCount, _totalCount);
+    }
+
+    if (isIdle())
+    {
+        Director::getInstance()->getScheduler()->unschedule(SCHEDULE_KEY, this);
+        _scheduled = false;
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#ifndef __ASSET_PIPELINE_H__
+#define __ASSET_PIPELINE_H__
+
+#include "cocos2d.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// AssetPipeline - 图片并行解码 + 分帧上传
+// PNG解码（读文件、解压）在后台工作线程池里做；主线程每帧只在预算时间内把解码好的图片
+// 按所属纹理分组的像素格式上传成GL纹理放进TextureCache（键为完整路径，之后addImage/addSpriteFramesWithFile直接命中缓存），
+// 避免切场景时主线程连续同步解码几百张图卡住。进度给LoadingScene显示。
+// TextureCache::addImageAsync只有一个加载线程，AsyncTaskPool每种任务也只有一个线程，所以自己起线程池。
+class AssetPipeline
+{
+public:
+    static AssetPipeline* getInstance();
+
+    // 加入待加载图片（资源相对路径）；已在TextureCache或队列中的跳过
+    void enqueueImages(const std::vector<std::string>& paths);
+
+    // 每帧上传纹理的时间预算（秒），至少上传一张
+    void setUploadBudget(float seconds) { _uploadBudget = seconds; }
+    float getUploadBudget() const { return _uploadBudget; }
+
+    // 本批进度：完成（上传或失败）数 / 加入数；全部完成后下次enqueue开始新的一批
+    int getTotalCount() const { return _totalCount; }
+    int getCompletedCount() const { return _completedCount; }
+    float getProgress() const { return _totalCount > 0 ? (float)_completedCount / _totalCount : 1.0f; }
+    bool isIdle() const { return _completedCount >= _totalCount; }
+
+    // 停止工作线程并丢弃未完成的图片（退出时调用）
+    void shutdown();
+
+private:
+    AssetPipeline();
+    ~AssetPipeline();
+
+    AssetPipeline(const AssetPipeline&) = delete;
+    AssetPipeline& operator=(const AssetPipeline&) = delete;
+
+    struct DecodeJob
+    {
+        std::string path;           // 资源相对路径（日志用）
+        std::string fullPath;       // 主线程解析好的完整路径，也是TextureCache的键
+        cocos2d::Texture2D::PixelFormat pixelFormat;    // 上传时的纹理格式（按所属纹理分组）
+        cocos2d::Image* image;      // 解码结果，失败为nullptr
+    };
+
+    void startWorkers();
+    void workerLoop();
+
+    // 主线程：在预算内上传解码好的图片
+    void update(float delta);
+
+    static AssetPipeline* _instance;
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _jobCondition;
+    std::deque<DecodeJob> _pendingJobs;     // 待解码
+    std::deque<DecodeJob> _decodedJobs;     // 已解码待上传
+    std::vector<std::string> _inFlight;     // 队列中的完整路径，防止重复加入（只有主线程访问）
+    bool _stopping;
+
+    float _uploadBudget;
+    int _totalCount;
+    int _completedCount;
+    bool _scheduled;
+};
+
+#endif // __ASSET_PIPELINE_H__
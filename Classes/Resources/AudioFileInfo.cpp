@@ -0,0 +1,113 @@
+#include "AudioFileInfo.h"
+#include <cstring>
+
+namespace {
+
+uint32_t readBigEndian32(const uint8_t* p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+uint32_t readLittleEndian32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint64_t readLittleEndian64(const uint8_t* p)
+{
+    return (uint64_t)readLittleEndian32(p) | ((uint64_t)readLittleEndian32(p + 4) << 32);
+}
+
+// 码率（kbps），下标为帧头里的码率索引；只支持Layer III
+const uint16_t MPEG1_L3_BITRATES[16] = { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0 };
+const uint16_t MPEG2_L3_BITRATES[16] = { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0 };
+const uint32_t MPEG1_SAMPLE_RATES[3] = { 44100, 48000, 32000 };
+
+bool readMp3Info(const uint8_t* data, size_t size, AudioFileInfo* info)
+{
+    size_t offset = 0;
+    // ID3v2标签：10字节头 + 同步安全整数表示的长度（+ 可选的10字节尾）
+    if (size >= 10 && memcmp(data, "ID3", 3) == 0) {
+        uint32_t tagSize = ((data[6] & 0x7f) << 21) | ((data[7] & 0x7f) << 14) | ((data[8] & 0x7f) << 7) | (data[9] & 0x7f);
+        offset = 10 + tagSize + ((data[5] & 0x10) ? 10 : 0);
+    }
+    // 末尾的ID3v1标签不算音频数据
+    size_t end = size;
+    if (size >= 128 && memcmp(data + size - 128, "TAG", 3) == 0) {
+        end = size - 128;
+    }
+
+    for (; offset + 4 <= end; offset++) {
+        const uint8_t* header = data + offset;
+        if (header[0] != 0xff || (header[1] & 0xe0) != 0xe0) {
+            continue;
+        }
+        int version = (header[1] >> 3) & 3;         // 3: MPEG1, 2: MPEG2, 0: MPEG2.5
+        int layer = (header[1] >> 1) & 3;           // 1: Layer III
+        int bitrateIndex = header[2] >> 4;
+        int rateIndex = (header[2] >> 2) & 3;
+        if (version == 1 || layer != 1 || bitrateIndex == 0 || bitrateIndex == 15 || rateIndex == 3) {
+            continue;
+        }
+
+        bool mpeg1 = version == 3;
+        bool mono = (header[3] >> 6) == 3;
+        uint32_t sampleRate = MPEG1_SAMPLE_RATES[rateIndex] >> (mpeg1 ? 0 : (version == 2 ? 1 : 2));
+        uint32_t bitrate = (mpeg1 ? MPEG1_L3_BITRATES : MPEG2_L3_BITRATES)[bitrateIndex] * 1000;
+        uint32_t samplesPerFrame = mpeg1 ? 1152 : 576;
+
+        info->sampleRate = sampleRate;
+        info->channels = mono ? 1 : 2;
+
+        // VBR文件的第一帧是Xing/Info头，位于边信息之后
+        size_t sideInfo = mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17);
+        const uint8_t* xing = header + 4 + sideInfo;
+        if (xing + 12 <= data + end && (memcmp(xing, "Xing", 4) == 0 || memcmp(xing, "Info", 4) == 0) &&
+            (readBigEndian32(xing + 4) & 1)) {
+            info->totalFrames = (uint64_t)readBigEndian32(xing + 8) * samplesPerFrame;
+            return true;
+        }
+
+        // 恒定码率：时长 = 数据位数 / 码率
+        info->totalFrames = (uint64_t)(end - offset) * 8 * sampleRate / bitrate;
+        return true;
+    }
+    return false;
+}
+
+bool readOggInfo(const uint8_t* data, size_t size, AudioFileInfo* info)
+{
+    // 第一页：27字节页头 + 分段表，之后是识别包 "\x01vorbis" 版本(4) 声道(1) 采样率(4)
+    if (size < 28 || memcmp(data, "OggS", 4) != 0) {
+        return false;
+    }
+    size_t packet = 27 + data[26];
+    if (packet + 16 > size || data[packet] != 1 || memcmp(data + packet + 1, "vorbis", 6) != 0) {
+        return false;
+    }
+    info->channels = data[packet + 11];
+    info->sampleRate = readLittleEndian32(data + packet + 12);
+
+    // 最后一页的granule position是总采样数
+    for (size_t offset = size - 14; offset > 0; offset--) {
+        if (memcmp(data + offset, "OggS", 4) == 0) {
+            info->totalFrames = readLittleEndian64(data + offset + 6);
+            return info->channels > 0 && info->sampleRate > 0;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+bool readAudioFileInfo(const uint8_t* data, size_t size, AudioFileInfo* info)
+{
+    if (!data || size == 0) {
+        return false;
+    }
+    memset(info, 0, sizeof(*info));
+    if (size >= 4 && memcmp(data, "OggS", 4) == 0) {
+        return readOggInfo(data, size, info);
+    }
+    return readMp3Info(data, size, info);
+}
@@ -0,0 +1,25 @@
+#pragma once
+#ifndef __AUDIO_FILE_INFO_H__
+#define __AUDIO_FILE_INFO_H__
+
+#include <cstddef>
+#include <cstdint>
+
+// AudioFileInfo - 只读文件头估算音频解码后的PCM大小（不解码）
+// MP3：跳过ID3v2，读第一个Layer III帧头；有Xing/Info头时用其中的总帧数，否则按恒定码率和数据长度推算。
+// OGG Vorbis：第一页的识别包给出声道数和采样率，最后一页的granule position就是总采样数。
+// AudioManager用它在预加载时给PCM缓存记账，估算值与AudioEngine解码出的16位PCM大小一致即可。不依赖cocos2d。
+struct AudioFileInfo {
+    uint32_t sampleRate;
+    uint32_t channels;
+    uint64_t totalFrames;   // 每声道采样数
+
+    // 16位PCM的字节数
+    uint64_t getDecodedBytes() const { return totalFrames * channels * 2; }
+    double getDuration() const { return sampleRate > 0 ? (double)totalFrames / sampleRate : 0.0; }
+};
+
+// 按内容识别MP3/OGG；无法识别或文件头损坏时返回false
+bool readAudioFileInfo(const uint8_t* data, size_t size, AudioFileInfo* info);
+
+#endif // __AUDIO_FILE_INFO_H__
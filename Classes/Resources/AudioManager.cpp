@@ -1,7 +1,46 @@
 #include "AudioManager.h"
+#include "ResourceLoader.h"
+#include "PackFileUtils.h"
+#include "AudioFileInfo.h"
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
 
 USING_NS_CC;
-using namespace CocosDenshion;
+using namespace cocos2d::experimental;
+
+namespace {
+    // 音效声道数；背景音乐另占一个
+    const int VOICE_POOL_SIZE = 12;
+
+    // 游戏音效全部解码后约1.2MB，留出余量
+    const size_t DEFAULT_PCM_CACHE_BUDGET = 4 * 1024 * 1024;
+    // 解码后超过这个大小的文件AudioEngine（win32的AudioCache）改为流式播放
+    const uint64_t STREAMING_THRESHOLD = 1024 * 1024;
+
+    // 游戏音效的播放策略：{逻辑名, 同时播放上限, 最短间隔(秒), 优先级}
+    struct SoundPolicyConfig
+    {
+        AssetId id;
+        int maxInstances;
+        float cooldown;
+        AudioManager::SoundPriority priority;
+    };
+
+    const SoundPolicyConfig SOUND_POLICIES[] = {
+        { PVZ_ASSET_ID("sound_shoot"),            3, 0.06f, AudioManager::SoundPriority::LOW },
+        { PVZ_ASSET_ID("sound_sun_produced"),     2, 0.10f, AudioManager::SoundPriority::LOW },
+        { PVZ_ASSET_ID("sound_sun_collected"),    3, 0.05f, AudioManager::SoundPriority::NORMAL },
+        { PVZ_ASSET_ID("sound_plant_planted"),    2, 0.05f, AudioManager::SoundPriority::NORMAL },
+        { PVZ_ASSET_ID("sound_seed_ready"),       2, 0.05f, AudioManager::SoundPriority::NORMAL },
+        { PVZ_ASSET_ID("sound_explosion"),        3, 0.00f, AudioManager::SoundPriority::HIGH },
+        { PVZ_ASSET_ID("sound_cherrybomb"),       2, 0.00f, AudioManager::SoundPriority::HIGH },
+        { PVZ_ASSET_ID("sound_plant_fail"),       1, 0.15f, AudioManager::SoundPriority::HIGH },
+        { PVZ_ASSET_ID("sound_seed_select"),      1, 0.05f, AudioManager::SoundPriority::HIGH },
+        { PVZ_ASSET_ID("sound_seed_unavailable"), 1, 0.15f, AudioManager::SoundPriority::HIGH },
+        { PVZ_ASSET_ID("sound_button_click"),     1, 0.05f, AudioManager::SoundPriority::HIGH },
+        { PVZ_ASSET_ID("sound_wave_start"),       1, 1.00f, AudioManager::SoundPriority::CRITICAL },
+    };
+}
 
 AudioManager* AudioManager::_instance = nullptr;
 
@@ -24,12 +63,17 @@ AudioManager* AudioManager::getInstance()
 }
 
 AudioManager::AudioManager()
-    : _audioEngine(nullptr)
-    , _isMuted(false)
+    : _isMuted(false)
     , _isBackgroundMusicPlaying(false)
     , _backgroundMusicVolume(1.0f)
     , _soundEffectsVolume(1.0f)
+    , _backgroundMusicId(AudioEngine::INVALID_AUDIO_ID)
+    , _stats()
+    , _pcmCacheBytes(0)
+    , _pcmCacheBudget(DEFAULT_PCM_CACHE_BUDGET)
 {
+    Voice freeVoice = { AudioEngine::INVALID_AUDIO_ID, INVALID_ASSET_ID, INVALID_ASSET_ID, SoundPriority::LOW, 0.0, 1.0f };
+    _voices.assign(VOICE_POOL_SIZE, freeVoice);
 }
 
 AudioManager::~AudioManager()
@@ -37,36 +81,37 @@ AudioManager::~AudioManager()
     stopAllSoundEffects();
     stopBackgroundMusic();
 
-    // ԤصЧ
-    _audioEngine->unloadEffect(_currentBackgroundMusic.c_str());
+    // 释放PCM缓存和音频设备
+    AudioEngine::end();
 
     _instance = nullptr;
 }
 
 bool AudioManager::init()
 {
-    _audioEngine = SimpleAudioEngine::getInstance();
-
-    // ƵǷʼɹ
-    if (!_audioEngine)
+    // 检查音频引擎是否初始化成功
+    if (!AudioEngine::lazyInit())
     {
-        log("AudioManager::init - Failed to get audio engine instance!");
+        PVZ_LOGE(LogCategory::AUDIO, "AudioManager::init - Failed to initialize audio engine!");
         return false;
     }
+    AudioEngine::setMaxAudioInstance(VOICE_POOL_SIZE + 1);
 
-    log("AudioManager::init - Audio engine initialized");
+    for (const auto& policy : SOUND_POLICIES)
+    {
+        setSoundPolicy(policy.id, policy.maxInstances, policy.cooldown, policy.priority);
+    }
+
+    PVZ_LOGI(LogCategory::AUDIO, "AudioManager::init - Audio engine initialized, %d effect voices", VOICE_POOL_SIZE);
 
     auto userDefaults = UserDefault::getInstance();
     _isMuted = userDefaults->getBoolForKey("audio_muted", false);
     _backgroundMusicVolume = userDefaults->getFloatForKey("bgm_volume", 0.5f);
     _soundEffectsVolume = userDefaults->getFloatForKey("sfx_volume", 0.6f);
 
-    log("AudioManager::init - muted: %d, bgm volume: %.2f, sfx volume: %.2f",
+    PVZ_LOGD(LogCategory::AUDIO, "AudioManager::init - muted: %d, bgm volume: %.2f, sfx volume: %.2f",
         _isMuted, _backgroundMusicVolume, _soundEffectsVolume);
 
-    _audioEngine->setBackgroundMusicVolume(_isMuted ? 0.0f : _backgroundMusicVolume);
-    _audioEngine->setEffectsVolume(_isMuted ? 0.0f : _soundEffectsVolume);
-
     return true;
 }
 
@@ -74,35 +119,34 @@ void AudioManager::playBackgroundMusic(const std::string& filePath, bool loop)
 {
     if (_isMuted || filePath.empty())
     {
-        log("AudioManager::playBackgroundMusic - muted or empty path");
+        PVZ_LOGD(LogCategory::AUDIO, "AudioManager::playBackgroundMusic - muted or empty path");
         return;
     }
 
-    // 浱ǰŵ·
-    _currentBackgroundMusic = filePath;
-    _isBackgroundMusicPlaying = true;
-
-    // ֻԤһ
-    if (!filePath.empty())
-    {
-        _audioEngine->preloadBackgroundMusic(filePath.c_str());
-    }
+    // 同时只有一首背景音乐
+    stopBackgroundMusic();
 
-    log("AudioManager::playBackgroundMusic - path: %s, loop: %d", filePath.c_str(), loop);
+    PVZ_LOGD(LogCategory::AUDIO, "AudioManager::playBackgroundMusic - path: %s, loop: %d", filePath.c_str(), loop);
 
-    // 󲥷
-    if (!_isMuted)
+    _backgroundMusicId = AudioEngine::play2d(filePath, loop, _backgroundMusicVolume);
+    if (_backgroundMusicId == AudioEngine::INVALID_AUDIO_ID)
     {
-        _audioEngine->setBackgroundMusicVolume(_backgroundMusicVolume);
+        PVZ_LOGW(LogCategory::AUDIO, "AudioManager::playBackgroundMusic - failed to play %s", filePath.c_str());
+        return;
     }
 
-    // ű
-    _audioEngine->playBackgroundMusic(filePath.c_str(), loop);
+    // 保存当前播放的音乐路径
+    _currentBackgroundMusic = filePath;
+    _isBackgroundMusicPlaying = true;
 }
 
 void AudioManager::stopBackgroundMusic()
 {
-    _audioEngine->stopBackgroundMusic();
+    if (_backgroundMusicId != AudioEngine::INVALID_AUDIO_ID)
+    {
+        AudioEngine::stop(_backgroundMusicId);
+    }
+    _backgroundMusicId = AudioEngine::INVALID_AUDIO_ID;
     _isBackgroundMusicPlaying = false;
     _currentBackgroundMusic.clear();
 }
@@ -111,7 +155,7 @@ void AudioManager::pauseBackgroundMusic()
 {
     if (_isBackgroundMusicPlaying)
     {
-        _audioEngine->pauseBackgroundMusic();
+        AudioEngine::pause(_backgroundMusicId);
     }
 }
 
@@ -119,19 +163,19 @@ void AudioManager::resumeBackgroundMusic()
 {
     if (_isBackgroundMusicPlaying)
     {
-        _audioEngine->resumeBackgroundMusic();
+        AudioEngine::resume(_backgroundMusicId);
     }
 }
 
 void AudioManager::setBackgroundMusicVolume(float volume)
 {
     _backgroundMusicVolume = volume;
-    if (!_isMuted)
+    if (!_isMuted && _isBackgroundMusicPlaying)
     {
-        _audioEngine->setBackgroundMusicVolume(volume);
+        AudioEngine::setVolume(_backgroundMusicId, volume);
     }
 
-    // 
+    // 保存设置
     UserDefault::getInstance()->setFloatForKey("bgm_volume", volume);
 }
 
@@ -140,76 +184,272 @@ float AudioManager::getBackgroundMusicVolume() const
     return _backgroundMusicVolume;
 }
 
-unsigned int AudioManager::playSoundEffect(const std::string& filePath, bool loop, float pitch, float pan, float gain)
+int AudioManager::playSoundEffect(const std::string& filePath, bool loop, float gain)
 {
     if (_isMuted || filePath.empty())
-        return 0;
+        return AudioEngine::INVALID_AUDIO_ID;
 
-    // ԤЧ
-    preloadSoundEffect(filePath);
+    // 按路径播放的音效也进同一张表，用路径的哈希做键
+    AssetId soundId = hashAssetName(filePath);
+    SoundEffectEntry& entry = _soundEffects[soundId];
+    if (!entry.resolved)
+    {
+        entry.resolved = true;
+        entry.path = filePath;
+        entry.pcmKey = soundId;
+    }
+    return playPooledEffect(soundId, entry, loop, gain);
+}
 
-    // Ч
-    unsigned int soundId = _audioEngine->playEffect(filePath.c_str(), loop, pitch, pan, gain);
+int AudioManager::playSoundEffect(AssetId soundId, bool loop, float gain)
+{
+    if (_isMuted)
+        return AudioEngine::INVALID_AUDIO_ID;
 
-    // ЧID
-    if (soundId > 0)
+    SoundEffectEntry& entry = _soundEffects[soundId];
+    if (!entry.resolved)
     {
-        _soundEffectIds[filePath] = soundId;
+        entry.resolved = true;
+        entry.path = ResourceLoader::getInstance()->getResourcePath(soundId);
+        if (entry.path.empty())
+        {
+            PVZ_LOGW(LogCategory::AUDIO, "AudioManager: unknown sound id 0x%08x", soundId);
+        }
+        else
+        {
+            entry.pcmKey = hashAssetName(entry.path);
+        }
     }
+    if (entry.path.empty())
+        return AudioEngine::INVALID_AUDIO_ID;
 
-    return soundId;
+    return playPooledEffect(soundId, entry, loop, gain);
 }
 
-void AudioManager::stopSoundEffect(unsigned int soundId)
+int AudioManager::playPooledEffect(AssetId soundId, SoundEffectEntry& entry, bool loop, float gain)
 {
-    _audioEngine->stopEffect(soundId);
+    PVZ_PROFILE_ZONE("AudioManager::playSoundEffect");
+
+    // 同一帧里多次触发（一排豌豆射手同时开火）只播一次
+    unsigned int frame = Director::getInstance()->getTotalFrames();
+    if (entry.lastPlayTime >= 0.0 && entry.lastPlayFrame == frame)
+    {
+        _stats.deduped++;
+        return entry.lastAudioId;
+    }
 
-    // ӳƳ
-    for (auto it = _soundEffectIds.begin(); it != _soundEffectIds.end(); ++it)
+    double now = utils::gettime();
+    if (entry.lastPlayTime >= 0.0 && now - entry.lastPlayTime < entry.cooldown)
     {
-        if (it->second == soundId)
+        _stats.throttled++;
+        return AudioEngine::INVALID_AUDIO_ID;
+    }
+
+    // 没有预加载过（或已被卸载）的音效在这里开始解码，AudioEngine解码完再出声
+    PcmCacheEntry* pcm = _pcmCache.find(entry.pcmKey);
+    if (!pcm)
+    {
+        _stats.coldPlays++;
+        PVZ_LOGD(LogCategory::AUDIO, "AudioManager: %s played before preload", entry.path.c_str());
+        pcm = &cachePcm(entry.pcmKey, entry.path);
+    }
+    if (pcm->state == PcmState::FAILED)
+    {
+        return AudioEngine::INVALID_AUDIO_ID;
+    }
+    pcm->lastUse = now;
+
+    Voice* voice = acquireVoice(soundId, entry);
+    if (!voice)
+    {
+        _stats.dropped++;
+        return AudioEngine::INVALID_AUDIO_ID;
+    }
+
+    int audioId = AudioEngine::play2d(entry.path, loop, gain * getEffectiveEffectsVolume());
+    if (audioId == AudioEngine::INVALID_AUDIO_ID)
+    {
+        return AudioEngine::INVALID_AUDIO_ID;
+    }
+    AudioEngine::setFinishCallback(audioId, [this](int finishedId, const std::string&) {
+        onVoiceFinished(finishedId);
+        });
+
+    voice->audioId = audioId;
+    voice->sound = soundId;
+    voice->pcmKey = entry.pcmKey;
+    voice->priority = entry.priority;
+    voice->startTime = now;
+    voice->gain = gain;
+
+    entry.lastPlayTime = now;
+    entry.lastPlayFrame = frame;
+    entry.lastAudioId = audioId;
+    _stats.played++;
+    return audioId;
+}
+
+AudioManager::Voice* AudioManager::acquireVoice(AssetId soundId, const SoundEffectEntry& entry)
+{
+    Voice* freeVoice = nullptr;
+    Voice* oldestSame = nullptr;
+    Voice* victim = nullptr;
+    int instances = 0;
+
+    for (auto& voice : _voices)
+    {
+        if (voice.audioId == AudioEngine::INVALID_AUDIO_ID)
         {
-            _soundEffectIds.erase(it);
-            break;
+            if (!freeVoice)
+            {
+                freeVoice = &voice;
+            }
+            continue;
+        }
+        if (voice.sound == soundId)
+        {
+            instances++;
+            if (!oldestSame || voice.startTime < oldestSame->startTime)
+            {
+                oldestSame = &voice;
+            }
+        }
+        if (!victim || voice.priority < victim->priority ||
+            (voice.priority == victim->priority && voice.startTime < victim->startTime))
+        {
+            victim = &voice;
         }
     }
+
+    // 同种音效到上限：顶掉最早的那个，新的一声更贴近当前画面
+    if (oldestSame && instances >= entry.maxInstances)
+    {
+        stopVoice(*oldestSame);
+        _stats.stolen++;
+        return oldestSame;
+    }
+    if (freeVoice)
+    {
+        return freeVoice;
+    }
+
+    // 池满：只抢占优先级不高于自己的
+    if (victim && victim->priority <= entry.priority)
+    {
+        stopVoice(*victim);
+        _stats.stolen++;
+        return victim;
+    }
+    return nullptr;
 }
 
-void AudioManager::pauseSoundEffect(unsigned int soundId)
+AudioManager::Voice* AudioManager::findVoice(int audioId)
 {
-    _audioEngine->pauseEffect(soundId);
+    if (audioId == AudioEngine::INVALID_AUDIO_ID)
+    {
+        return nullptr;
+    }
+    for (auto& voice : _voices)
+    {
+        if (voice.audioId == audioId)
+        {
+            return &voice;
+        }
+    }
+    return nullptr;
+}
+
+void AudioManager::stopVoice(Voice& voice)
+{
+    // stop不会触发播放完成回调，直接释放声道
+    AudioEngine::stop(voice.audioId);
+    voice.audioId = AudioEngine::INVALID_AUDIO_ID;
+    voice.sound = INVALID_ASSET_ID;
+    voice.pcmKey = INVALID_ASSET_ID;
+}
+
+void AudioManager::onVoiceFinished(int audioId)
+{
+    Voice* voice = findVoice(audioId);
+    if (voice)
+    {
+        voice->audioId = AudioEngine::INVALID_AUDIO_ID;
+        voice->sound = INVALID_ASSET_ID;
+        voice->pcmKey = INVALID_ASSET_ID;
+    }
+}
+
+void AudioManager::stopSoundEffect(int audioId)
+{
+    Voice* voice = findVoice(audioId);
+    if (voice)
+    {
+        stopVoice(*voice);
+    }
 }
 
-void AudioManager::resumeSoundEffect(unsigned int soundId)
+void AudioManager::pauseSoundEffect(int audioId)
 {
-    _audioEngine->resumeEffect(soundId);
+    if (findVoice(audioId))
+    {
+        AudioEngine::pause(audioId);
+    }
+}
+
+void AudioManager::resumeSoundEffect(int audioId)
+{
+    if (findVoice(audioId))
+    {
+        AudioEngine::resume(audioId);
+    }
 }
 
 void AudioManager::stopAllSoundEffects()
 {
-    _audioEngine->stopAllEffects();
-    _soundEffectIds.clear();
+    // 不用AudioEngine::stopAll，那会连背景音乐一起停掉
+    for (auto& voice : _voices)
+    {
+        if (voice.audioId != AudioEngine::INVALID_AUDIO_ID)
+        {
+            stopVoice(voice);
+        }
+    }
 }
 
 void AudioManager::pauseAllSoundEffects()
 {
-    _audioEngine->pauseAllEffects();
+    for (const auto& voice : _voices)
+    {
+        if (voice.audioId != AudioEngine::INVALID_AUDIO_ID)
+        {
+            AudioEngine::pause(voice.audioId);
+        }
+    }
 }
 
 void AudioManager::resumeAllSoundEffects()
 {
-    _audioEngine->resumeAllEffects();
+    for (const auto& voice : _voices)
+    {
+        if (voice.audioId != AudioEngine::INVALID_AUDIO_ID)
+        {
+            AudioEngine::resume(voice.audioId);
+        }
+    }
 }
 
 void AudioManager::setSoundEffectsVolume(float volume)
 {
     _soundEffectsVolume = volume;
-    if (!_isMuted)
+    for (const auto& voice : _voices)
     {
-        _audioEngine->setEffectsVolume(volume);
+        if (voice.audioId != AudioEngine::INVALID_AUDIO_ID)
+        {
+            AudioEngine::setVolume(voice.audioId, voice.gain * getEffectiveEffectsVolume());
+        }
     }
 
-    // 
+    // 保存设置
     UserDefault::getInstance()->setFloatForKey("sfx_volume", volume);
 }
 
@@ -218,22 +458,53 @@ float AudioManager::getSoundEffectsVolume() const
     return _soundEffectsVolume;
 }
 
+void AudioManager::setSoundPolicy(AssetId soundId, int maxInstances, float cooldown, SoundPriority priority)
+{
+    SoundEffectEntry& entry = _soundEffects[soundId];
+    entry.maxInstances = std::max(1, maxInstances);
+    entry.cooldown = cooldown;
+    entry.priority = priority;
+}
+
+int AudioManager::getActiveVoiceCount() const
+{
+    int active = 0;
+    for (const auto& voice : _voices)
+    {
+        if (voice.audioId != AudioEngine::INVALID_AUDIO_ID)
+        {
+            active++;
+        }
+    }
+    return active;
+}
+
+void AudioManager::logVoiceStats() const
+{
+    PVZ_LOGI(LogCategory::AUDIO, "Voices: %d/%d active, %d played, %d deduped, %d throttled, %d stolen, %d dropped, %d cold",
+        getActiveVoiceCount(), VOICE_POOL_SIZE, _stats.played, _stats.deduped, _stats.throttled, _stats.stolen, _stats.dropped,
+        _stats.coldPlays);
+    PVZ_LOGI(LogCategory::AUDIO, "PCM cache: %.1f / %.1f KB, %d files, %d evictions",
+        _pcmCacheBytes / 1024.0f, _pcmCacheBudget / 1024.0f, (int)_pcmCache.size(), _stats.evictions);
+}
+
 void AudioManager::setMuted(bool muted)
 {
     _isMuted = muted;
 
-    if (muted)
+    if (_isBackgroundMusicPlaying)
     {
-        _audioEngine->setBackgroundMusicVolume(0.0f);
-        _audioEngine->setEffectsVolume(0.0f);
+        AudioEngine::setVolume(_backgroundMusicId, muted ? 0.0f : _backgroundMusicVolume);
     }
-    else
+    for (const auto& voice : _voices)
     {
-        _audioEngine->setBackgroundMusicVolume(_backgroundMusicVolume);
-        _audioEngine->setEffectsVolume(_soundEffectsVolume);
+        if (voice.audioId != AudioEngine::INVALID_AUDIO_ID)
+        {
+            AudioEngine::setVolume(voice.audioId, voice.gain * getEffectiveEffectsVolume());
+        }
     }
 
-    // 
+    // 保存设置
     UserDefault::getInstance()->setBoolForKey("audio_muted", muted);
 }
 
@@ -241,7 +512,7 @@ void AudioManager::preloadSoundEffect(const std::string& filePath)
 {
     if (!filePath.empty())
     {
-        _audioEngine->preloadEffect(filePath.c_str());
+        cachePcm(hashAssetName(filePath), filePath);
     }
 }
 
@@ -249,7 +520,8 @@ void AudioManager::preloadBackgroundMusic(const std::string& filePath)
 {
     if (!filePath.empty())
     {
-        _audioEngine->preloadBackgroundMusic(filePath.c_str());
+        // 背景音乐解码后远超流式阈值，AudioEngine只解码开头几块，播放时边放边解码
+        AudioEngine::preload(filePath);
     }
 }
 
@@ -257,16 +529,160 @@ void AudioManager::unloadSoundEffect(const std::string& filePath)
 {
     if (!filePath.empty())
     {
-        _audioEngine->unloadEffect(filePath.c_str());
+        uncachePcm(hashAssetName(filePath));
     }
 }
 
 void AudioManager::unloadBackgroundMusic(const std::string& filePath)
 {
-    // SimpleAudioEngineûṩжرֵķ
-    // ֹֻͣż
-    if (!filePath.empty() && _currentBackgroundMusic == filePath)
+    if (filePath.empty())
+    {
+        return;
+    }
+    if (_currentBackgroundMusic == filePath)
     {
         stopBackgroundMusic();
     }
+    AudioEngine::uncache(filePath);
+}
+
+void AudioManager::setPcmCacheBudget(size_t bytes)
+{
+    _pcmCacheBudget = bytes;
+    trimPcmCache();
+}
+
+AudioManager::PcmCacheEntry& AudioManager::cachePcm(AssetId key, const std::string& filePath)
+{
+    PcmCacheEntry* cached = _pcmCache.find(key);
+    if (cached)
+    {
+        return *cached;
+    }
+
+    PVZ_PROFILE_ZONE("AudioManager::cachePcm");
+
+    PcmCacheEntry& entry = _pcmCache[key];
+    entry.path = filePath;
+    entry.lastUse = utils::gettime();
+
+    // 只读文件头估算解码大小；挂载了资源包时直接读映射内存
+    auto fileUtils = FileUtils::getInstance();
+    AssetPack::View view;
+    Data data;
+    if (!PackFileUtils::findFile(filePath, &view))
+    {
+        data = fileUtils->getDataFromFile(filePath);
+        view.data = data.getBytes();
+        view.size = (size_t)data.getSize();
+    }
+    if (!view.data)
+    {
+        // 缺少的文件只警告一次，之后的播放直接跳过
+        PVZ_LOGW(LogCategory::AUDIO, "AudioManager: sound file missing: %s", filePath.c_str());
+        entry.state = PcmState::FAILED;
+        return entry;
+    }
+
+    AudioFileInfo info;
+    uint64_t decodedBytes = readAudioFileInfo(view.data, view.size, &info) ?
+        info.getDecodedBytes() : (uint64_t)view.size * 10;  // 认不出文件头时按MP3的常见压缩比估算
+    if (decodedBytes > STREAMING_THRESHOLD)
+    {
+        entry.state = PcmState::STREAMED;
+        return entry;
+    }
+
+    entry.state = PcmState::LOADING;
+    entry.bytes = (size_t)decodedBytes;
+    _pcmCacheBytes += entry.bytes;
+
+    // 解码在AudioEngine的后台线程进行，完成回调在主线程
+    AudioEngine::preload(filePath, [this, key](bool success) {
+        onPcmLoaded(key, success);
+        });
+
+    // 新加入的正在解码，不会被淘汰
+    trimPcmCache();
+    return *_pcmCache.find(key);
+}
+
+void AudioManager::onPcmLoaded(AssetId key, bool success)
+{
+    PcmCacheEntry* entry = _pcmCache.find(key);
+    if (!entry || entry->state != PcmState::LOADING)
+    {
+        return;
+    }
+    if (success)
+    {
+        entry->state = PcmState::READY;
+        PVZ_LOGD(LogCategory::AUDIO, "AudioManager: decoded %s (%.1f KB)", entry->path.c_str(), entry->bytes / 1024.0f);
+        trimPcmCache();
+    }
+    else
+    {
+        PVZ_LOGW(LogCategory::AUDIO, "AudioManager: failed to decode %s", entry->path.c_str());
+        entry->state = PcmState::FAILED;
+        _pcmCacheBytes -= entry->bytes;
+        entry->bytes = 0;
+    }
+}
+
+void AudioManager::uncachePcm(AssetId key)
+{
+    PcmCacheEntry* entry = _pcmCache.find(key);
+    if (!entry)
+    {
+        return;
+    }
+
+    // uncache会停掉这个文件正在播放的实例，先把对应声道释放掉
+    for (auto& voice : _voices)
+    {
+        if (voice.audioId != AudioEngine::INVALID_AUDIO_ID && voice.pcmKey == key)
+        {
+            stopVoice(voice);
+        }
+    }
+    AudioEngine::uncache(entry->path);
+    _pcmCacheBytes -= entry->bytes;
+    _pcmCache.erase(key);
+}
+
+void AudioManager::trimPcmCache()
+{
+    while (_pcmCacheBytes > _pcmCacheBudget)
+    {
+        // 只卸载解码完成、没有在播放的（卸载解码中的文件会等解码线程结束，卡住主线程）
+        AssetId victim = INVALID_ASSET_ID;
+        double oldest = 0.0;
+        _pcmCache.forEach([&](AssetId key, const PcmCacheEntry& entry) {
+            if (entry.state == PcmState::READY && !isPcmInUse(key) &&
+                (victim == INVALID_ASSET_ID || entry.lastUse < oldest))
+            {
+                victim = key;
+                oldest = entry.lastUse;
+            }
+        });
+        if (victim == INVALID_ASSET_ID)
+        {
+            break;
+        }
+        PVZ_LOGD(LogCategory::AUDIO, "AudioManager: evicting %s", _pcmCache.find(victim)->path.c_str());
+        uncachePcm(victim);
+        _stats.evictions++;
+    }
+}
+
+bool AudioManager::isPcmInUse(AssetId key) const
+{
+    for (const auto& voice : _voices)
+    {
+        if (voice.audioId != AudioEngine::INVALID_AUDIO_ID && voice.pcmKey == key)
+        {
+            return true;
+        }
+    }
+    return false;
 }
@@ -2,27 +2,55 @@
 #define AUDIO_MANAGER_H
 
 #include "cocos2d.h"
-#include "SimpleAudioEngine.h"
+#include "audio/include/AudioEngine.h"
+#include "AssetId.h"
 #include <string>
-#include <map>
-
+#include <vector>
+
+// AudioManager - 音频管理单例（基于experimental::AudioEngine）
+// 音效走固定大小的声道池：每种音效有同时播放上限、最短间隔和优先级，
+// 同一帧重复触发只播一次，池满时抢占优先级更低（同优先级里最早开始）的声道，抢不到就丢弃。
+// 大量豌豆射手同时开火时最多占几个声道，不会把混音器挤满，也不会每发子弹新开一个声音。
+// 音效预加载时交给AudioEngine的后台线程解码成PCM，按文件头估算的PCM大小记账，超出预算时按最近最少使用卸载；
+// 解码后超过1MB的文件（背景音乐）AudioEngine按0.1秒一块流式解码，不进PCM缓存。
 class AudioManager : public cocos2d::Ref
 {
 public:
-    // ʵ
+    // 单例访问点
     static AudioManager* getInstance();
 
-    // Чö
+    // 音效类型枚举
     enum class SoundType
     {
         EFFECT,
         BACKGROUND_MUSIC
     };
 
-    // ʼ
+    // 音效优先级：声道池满时高优先级的可以抢占低优先级的
+    enum class SoundPriority
+    {
+        LOW,        // 高频战斗音效（射击、阳光产出）
+        NORMAL,
+        HIGH,       // 爆炸、界面反馈
+        CRITICAL    // 波次提示等不能丢的
+    };
+
+    // 声道池统计（F10调试输出用）
+    struct VoiceStats
+    {
+        int played;
+        int deduped;        // 同一帧重复触发被合并
+        int throttled;      // 间隔太短被跳过
+        int stolen;         // 抢占了其他声道
+        int dropped;        // 池满且抢不到
+        int coldPlays;      // 播放时还没有预加载（会在播放时才解码）
+        int evictions;      // PCM缓存超预算卸载的文件数
+    };
+
+    // 初始化
     bool init();
 
-    // ֿ
+    // 背景音乐控制
     void playBackgroundMusic(const std::string& filePath, bool loop = true);
     void stopBackgroundMusic();
     void pauseBackgroundMusic();
@@ -30,26 +58,40 @@ public:
     void setBackgroundMusicVolume(float volume);
     float getBackgroundMusicVolume() const;
 
-    // Ч
-    unsigned int playSoundEffect(const std::string& filePath, bool loop = false, float pitch = 1.0f, float pan = 0.0f, float gain = 1.0f);
-    void stopSoundEffect(unsigned int soundId);
-    void pauseSoundEffect(unsigned int soundId);
-    void resumeSoundEffect(unsigned int soundId);
+    // 音效控制：返回AudioEngine的音频ID，没有播放时返回AudioEngine::INVALID_AUDIO_ID
+    int playSoundEffect(const std::string& filePath, bool loop = false, float gain = 1.0f);
+    // 按逻辑名的AssetId播放（如PVZ_ASSET_ID("sound_shoot")）：路径在第一次播放时解析，之后只查整数表
+    int playSoundEffect(AssetId soundId, bool loop = false, float gain = 1.0f);
+    void stopSoundEffect(int audioId);
+    void pauseSoundEffect(int audioId);
+    void resumeSoundEffect(int audioId);
     void stopAllSoundEffects();
     void pauseAllSoundEffects();
     void resumeAllSoundEffects();
     void setSoundEffectsVolume(float volume);
     float getSoundEffectsVolume() const;
 
-    // ȫƵ
+    // 设置某个音效的同时播放上限、最短间隔（秒）和优先级
+    void setSoundPolicy(AssetId soundId, int maxInstances, float cooldown, SoundPriority priority);
+
+    // PCM缓存预算（字节）：预加载的音效按估算的解码大小计入，超出时卸载最久没播放的
+    void setPcmCacheBudget(size_t bytes);
+    size_t getPcmCacheBudget() const { return _pcmCacheBudget; }
+    size_t getPcmCacheBytes() const { return _pcmCacheBytes; }
+
+    const VoiceStats& getVoiceStats() const { return _stats; }
+    int getActiveVoiceCount() const;
+    void logVoiceStats() const;
+
+    // 全局音频控制
     void setMuted(bool muted);
     bool isMuted() const { return _isMuted; }
 
-    // ԤЧ
+    // 预加载：音效在后台解码成PCM缓存在AudioEngine里；背景音乐只读开头，播放时流式解码
     void preloadSoundEffect(const std::string& filePath);
     void preloadBackgroundMusic(const std::string& filePath);
 
-    // жЧ
+    // 卸载音效
     void unloadSoundEffect(const std::string& filePath);
     void unloadBackgroundMusic(const std::string& filePath);
 
@@ -57,27 +99,89 @@ private:
     AudioManager();
     virtual ~AudioManager();
 
-    // ֹ
+    // 禁止拷贝
     AudioManager(const AudioManager&) = delete;
     AudioManager& operator=(const AudioManager&) = delete;
 
+    // 按AssetId播放的音效：解析好的路径、播放策略和最近一次播放
+    struct SoundEffectEntry
+    {
+        std::string path;
+        AssetId pcmKey = INVALID_ASSET_ID;  // 路径的哈希，PCM缓存的键
+        bool resolved = false;
+        int maxInstances = 4;
+        float cooldown = 0.0f;
+        SoundPriority priority = SoundPriority::NORMAL;
+        double lastPlayTime = -1.0;
+        unsigned int lastPlayFrame = 0;
+        int lastAudioId = -1;
+    };
+
+    // PCM缓存中的一个文件
+    enum class PcmState
+    {
+        LOADING,
+        READY,
+        STREAMED,   // 太大，播放时流式解码，不占缓存预算
+        FAILED      // 文件不存在或无法解码，之后的播放直接跳过
+    };
+
+    struct PcmCacheEntry
+    {
+        std::string path;
+        PcmState state = PcmState::LOADING;
+        size_t bytes = 0;
+        double lastUse = 0.0;
+    };
+
+    // 声道池中的一个声道；audioId为INVALID_AUDIO_ID时空闲
+    struct Voice
+    {
+        int audioId;
+        AssetId sound;
+        AssetId pcmKey;
+        SoundPriority priority;
+        double startTime;
+        float gain;
+    };
+
+    // 开始后台解码（已在缓存中时只更新使用时间）
+    PcmCacheEntry& cachePcm(AssetId key, const std::string& filePath);
+    void onPcmLoaded(AssetId key, bool success);
+    void uncachePcm(AssetId key);
+    void trimPcmCache();
+    bool isPcmInUse(AssetId key) const;
+
+    int playPooledEffect(AssetId soundId, SoundEffectEntry& entry, bool loop, float gain);
+    // 为新音效找声道：同种音效到上限时顶掉它最早的实例，否则用空闲声道，池满时按优先级抢占；失败返回nullptr
+    Voice* acquireVoice(AssetId soundId, const SoundEffectEntry& entry);
+    Voice* findVoice(int audioId);
+    void stopVoice(Voice& voice);
+    void onVoiceFinished(int audioId);
+    float getEffectiveEffectsVolume() const { return _isMuted ? 0.0f : _soundEffectsVolume; }
+
 private:
     static AudioManager* _instance;
 
-    // Ƶ
-    CocosDenshion::SimpleAudioEngine* _audioEngine;
-
-    // Ƶ״̬
+    // 音频状态
     bool _isMuted;
     bool _isBackgroundMusicPlaying;
     float _backgroundMusicVolume;
     float _soundEffectsVolume;
 
-    // ǰŵıļ
+    // 当前播放的背景音乐文件
     std::string _currentBackgroundMusic;
+    int _backgroundMusicId;
+
+    // 音效表与固定大小的声道池
+    AssetIdMap<SoundEffectEntry> _soundEffects;
+    std::vector<Voice> _voices;
+    VoiceStats _stats;
 
-    // ЧIDӳ
-    std::map<std::string, unsigned int> _soundEffectIds;
+    // PCM缓存：键为文件路径的哈希
+    AssetIdMap<PcmCacheEntry> _pcmCache;
+    size_t _pcmCacheBytes;
+    size_t _pcmCacheBudget;
 };
 
 #endif // AUDIO_MANAGER_H
@@ -0,0 +1,139 @@
+#include "PackFileUtils.h"
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
+#include <algorithm>
+#include <cstring>
+#if CC_TARGET_PLATFORM != CC_PLATFORM_WIN32
+#include <sys/stat.h>
+#endif
+
+USING_NS_CC;
+
+PackFileUtils* PackFileUtils::_instance = nullptr;
+
+bool PackFileUtils::mount(const std::string& packName)
+{
+    PVZ_PROFILE_ZONE("PackFileUtils::mount");
+
+    if (_instance)
+    {
+        return true;
+    }
+
+    std::string packPath = FileUtils::getInstance()->fullPathForFilename(packName);
+    if (packPath.empty())
+    {
+        PVZ_LOGI(LogCategory::RESOURCE, "%s not found, reading loose resource files", packName.c_str());
+        return false;
+    }
+
+    auto packUtils = new (std::nothrow) PackFileUtils();
+    std::string error;
+    if (!packUtils || !packUtils->init() || !packUtils->_pack.open(packPath, &error))
+    {
+        PVZ_LOGW(LogCategory::RESOURCE, "Cannot mount %s (%s), reading loose resource files",
+            packPath.c_str(), error.c_str());
+        delete packUtils;
+        return false;
+    }
+    packUtils->_mountPath = packPath.substr(0, packPath.find_last_of('/') + 1);
+
+    // setDelegate会删除原来的FileUtils单例，它上面还没有设置搜索路径，不需要迁移
+    FileUtils::setDelegate(packUtils);
+    _instance = packUtils;
+
+    PVZ_LOGI(LogCategory::RESOURCE, "Mounted %s: %d files, %.2f MB", packPath.c_str(),
+        packUtils->_pack.getEntryCount(), packUtils->_pack.getMappedSize() / (1024.0f * 1024.0f));
+    return true;
+}
+
+bool PackFileUtils::findFile(const std::string& path, AssetPack::View* view)
+{
+    return _instance && _instance->findInPack(path, view);
+}
+
+PackFileUtils::PackFileUtils()
+{
+}
+
+PackFileUtils::~PackFileUtils()
+{
+    if (_instance == this)
+    {
+        _instance = nullptr;
+    }
+}
+
+bool PackFileUtils::findInPack(const std::string& path, AssetPack::View* view) const
+{
+    if (path.empty())
+    {
+        return false;
+    }
+
+    std::string packPath;
+    if (path.compare(0, _mountPath.size(), _mountPath) == 0)
+    {
+        packPath = path.substr(_mountPath.size());
+    }
+    else if (!isAbsolutePath(path))
+    {
+        packPath = path;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Windows下调用方可能传反斜杠路径
+    std::replace(packPath.begin(), packPath.end(), '\\', '/');
+    return _pack.find(packPath.c_str(), view);
+}
+
+bool PackFileUtils::isFileExistInternal(const std::string& filePath) const
+{
+    AssetPack::View view;
+    if (findInPack(filePath, &view))
+    {
+        return true;
+    }
+#if CC_TARGET_PLATFORM == CC_PLATFORM_WIN32
+    return PlatformFileUtils::isFileExistInternal(filePath);
+#else
+    // 其他平台的isFileExistInternal是private，按FileUtilsLinux的做法直接stat
+    std::string fullPath = isAbsolutePath(filePath) ? filePath : _defaultResRootPath + filePath;
+    struct stat info;
+    return stat(fullPath.c_str(), &info) == 0 && S_ISREG(info.st_mode);
+#endif
+}
+
+FileUtils::Status PackFileUtils::getContents(const std::string& filename, ResizableBuffer* buffer) const
+{
+    if (filename.empty())
+    {
+        return Status::NotExists;
+    }
+
+    // 完整路径直接查，不经过fullPathForFilename（工作线程读图时FileUtils的路径缓存不是线程安全的）
+    AssetPack::View view;
+    if (findInPack(isAbsolutePath(filename) ? filename : fullPathForFilename(filename), &view))
+    {
+        buffer->resize(view.size);
+        if (view.size > 0)
+        {
+            memcpy(buffer->buffer(), view.data, view.size);
+        }
+        return Status::OK;
+    }
+    return PlatformFileUtils::getContents(filename, buffer);
+}
+
+long PackFileUtils::getFileSize(const std::string& filepath) const
+{
+    AssetPack::View view;
+    if (findInPack(isAbsolutePath(filepath) ? filepath : fullPathForFilename(filepath), &view))
+    {
+        return (long)view.size;
+    }
+    return PlatformFileUtils::getFileSize(filepath);
+}
@@ -0,0 +1,60 @@
+#pragma once
+#ifndef __PACK_FILE_UTILS_H__
+#define __PACK_FILE_UTILS_H__
+
+#include "cocos2d.h"
+#include "AssetPack.h"
+#include <string>
+
+#if CC_TARGET_PLATFORM == CC_PLATFORM_WIN32
+#include "platform/win32/CCFileUtils-win32.h"
+typedef cocos2d::FileUtilsWin32 PlatformFileUtils;
+#elif CC_TARGET_PLATFORM == CC_PLATFORM_LINUX
+#include "platform/linux/CCFileUtils-linux.h"
+typedef cocos2d::FileUtilsLinux PlatformFileUtils;
+#elif CC_TARGET_PLATFORM == CC_PLATFORM_MAC || CC_TARGET_PLATFORM == CC_PLATFORM_IOS
+#include "platform/apple/CCFileUtils-apple.h"
+typedef cocos2d::FileUtilsApple PlatformFileUtils;
+#elif CC_TARGET_PLATFORM == CC_PLATFORM_ANDROID
+#include "platform/android/CCFileUtils-android.h"
+typedef cocos2d::FileUtilsAndroid PlatformFileUtils;
+#endif
+
+// PackFileUtils - 从资源包读文件的FileUtils
+// 启动时把资源根目录下的assets.pak（proj.headless的pack_assets生成）整体内存映射，替换FileUtils单例；
+// 之后包里有的文件不再逐个stat/fopen，isFileExist只查映射的索引，getDataFromFile/getContents从映射内存拷一次。
+// 包里没有的文件（可写目录、新加还没打包的资源）交给平台FileUtils照常读。
+// cocos的Data总是自己持有缓冲区，getDataFromFile做不到零拷贝；能直接吃指针的地方（图片解码、动画索引）用findFile拿映射内存的视图。
+// 没有资源包（开发时、Android的资源在APK里不能直接映射）就不挂载，继续读散文件。
+// 注意：挂载后包优先于散文件，改了资源要重新打包。
+class PackFileUtils : public PlatformFileUtils
+{
+public:
+    // 找到并映射资源包后替换FileUtils单例；没有包或包无效时返回false，保持原来的FileUtils
+    static bool mount(const std::string& packName = "assets.pak");
+    static bool isMounted() { return _instance != nullptr; }
+
+    // 按资源相对路径或完整路径取包内文件的视图（指向映射内存，不拷贝，可在工作线程调用）
+    static bool findFile(const std::string& path, AssetPack::View* view);
+
+    virtual ~PackFileUtils();
+
+    virtual Status getContents(const std::string& filename, cocos2d::ResizableBuffer* buffer) const override;
+    virtual long getFileSize(const std::string& filepath) const override;
+
+protected:
+    virtual bool isFileExistInternal(const std::string& filePath) const override;
+
+private:
+    PackFileUtils();
+
+    // 完整路径去掉包所在目录的前缀，相对路径原样，再在包里查
+    bool findInPack(const std::string& path, AssetPack::View* view) const;
+
+    static PackFileUtils* _instance;
+
+    AssetPack _pack;
+    std::string _mountPath;     // 包所在目录（以'/'结尾），包内路径相对这个目录
+};
+
+#endif // __PACK_FILE_UTILS_H__
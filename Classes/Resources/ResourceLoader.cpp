@@ -1,11 +1,79 @@
-// ResourceLoader.cpp - 򻯰汾ƳJSON
+// ResourceLoader.cpp - 动画定义来自 Configs/animations.json（编译为animations.bin）
 #include "ResourceLoader.h"
+#include "TextureResidency.h"
+#include "PackFileUtils.h"
 #include "AppDelegate.h"
-#include <cocos/audio/include/SimpleAudioEngine.h>
+#include "./Entities/EntityTypes.h"
+#include "AudioManager.h"
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
+#include "./Game/SpriteAnimator.h"
+#include <sstream>
 //#include <Utils/AnimationHelper.h>
 
 USING_NS_CC;
 
+namespace {
+    // 图集分组，对应 Resources/Atlases/<组名>-<页号>.plist，每组是一个驻留分组（TextureResidency）。
+    // pinned的组在游戏阶段常驻；僵尸每种一组，出场前才加载，超出纹理预算时可被淘汰
+    struct AtlasGroupInfo
+    {
+        const char* name;
+        bool pinned;
+    };
+    const AtlasGroupInfo ATLAS_GROUPS[] = {
+        { "plants", true },
+        { "projectiles", true },
+        { "sun", true },
+        { "zombie_normal", false },
+        { "zombie_conehead", false },
+        { "zombie_buckethead", false }
+    };
+
+    // 动画清单：优先读编译好的索引，没有时解析JSON
+    const char* const ANIMATION_INDEX_PATH = "Configs/animations.bin";
+    const char* const ANIMATION_MANIFEST_PATH = "Configs/animations.json";
+
+    // 菜单场景用到的散图（_resourcePaths中的名字）
+    const char* const MENU_IMAGE_NAMES[] = { "menu_background", "start_button_normal", "start_button_pressed", "menu_logo" };
+
+    // 游戏场景用到的散图（_resourcePaths中的名字）
+    const char* const GAME_IMAGE_NAMES[] = { "game_background", "card_bar_bg" };
+
+    // 清单里的像素格式 -> cocos2d格式；ETC1只用于.pkm图集页，解码成位图的按RGBA4444
+    Texture2D::PixelFormat toTexturePixelFormat(uint8_t format)
+    {
+        switch (format)
+        {
+        case AnimationManifest::PIXEL_RGBA8888: return Texture2D::PixelFormat::RGBA8888;
+        case AnimationManifest::PIXEL_RGBA4444: return Texture2D::PixelFormat::RGBA4444;
+        case AnimationManifest::PIXEL_RGB565:   return Texture2D::PixelFormat::RGB565;
+        case AnimationManifest::PIXEL_A8:       return Texture2D::PixelFormat::A8;
+        case AnimationManifest::PIXEL_ETC1:     return Texture2D::PixelFormat::RGBA4444;
+        default:                                return Texture2D::getDefaultAlphaPixelFormat();
+        }
+    }
+
+    // 在作用域内临时切换新建纹理的像素格式
+    class PixelFormatScope
+    {
+    public:
+        explicit PixelFormatScope(Texture2D::PixelFormat format)
+            : _previous(Texture2D::getDefaultAlphaPixelFormat())
+        {
+            Texture2D::setDefaultAlphaPixelFormat(format);
+        }
+
+        ~PixelFormatScope()
+        {
+            Texture2D::setDefaultAlphaPixelFormat(_previous);
+        }
+
+    private:
+        Texture2D::PixelFormat _previous;
+    };
+}
+
 ResourceLoader* ResourceLoader::_instance = nullptr;
 
 ResourceLoader* ResourceLoader::getInstance()
@@ -42,15 +110,18 @@ bool ResourceLoader::init()
 {
     loadResourceConfig();
 
-    // ӲĶãʹJSONļ
-    loadSimpleAnimationConfig();
+    // 清单里有动画定义和各纹理分组的像素格式，最先读
+    loadAnimationManifest();
+
+    // 图集、散图按驻留分组登记，进入对应阶段（preloadResources）或僵尸出场前才加载
+    registerResidencyGroups();
 
     return true;
 }
 
 void ResourceLoader::loadResourceConfig()
 {
-    // ˵Դ
+    // 菜单资源
     _resourcePaths["menu_background"] = "Images/Backgrounds/menu_bg.png";
     _resourcePaths["start_button_normal"] = "Images/UI/start_btn_normal.png";
     _resourcePaths["start_button_pressed"] = "Images/UI/start_btn_pressed.png";
@@ -58,12 +129,12 @@ void ResourceLoader::loadResourceConfig()
 
     _resourcePaths["menu_logo"] = "Images/UI/menu_logo.png";
 
-    // ϷԴ
+    // 游戏资源
     _resourcePaths["game_background"] = "Images/Backgrounds/game_bg_1.png";
     //_resourcePaths["grid_cell"] = "Images/UI/grid_cell.png";
     _resourcePaths["card_bar_bg"] = "Images/UI/card_bar_bg.png";
 
-    // 
+    // 字体
     _resourcePaths["font_main"] = "Fonts/Marker Felt.ttf";
     _resourcePaths["font_score"] = "Fonts/arial.ttf";
 
@@ -71,7 +142,7 @@ void ResourceLoader::loadResourceConfig()
     _resourcePaths["sound_menu_bgm"] = "Sounds/BGM/menu_bgm.mp3";
     _resourcePaths["sound_game_bgm"] = "Sounds/BGM/game_bgm.mp3";
 
-    // Ч
+    // 音效
     _resourcePaths["sound_button_click"] = "Sounds/SFX/button_click.mp3";
     _resourcePaths["sound_shoot"] = "Sounds/SFX/shoot.mp3";
     _resourcePaths["sound_explosion"] = "Sounds/SFX/explosion.mp3";
@@ -79,297 +150,371 @@ void ResourceLoader::loadResourceConfig()
     _resourcePaths["sound_sun_collected"] = "Sounds/SFX/sun_collected.mp3";
     _resourcePaths["sound_plant_planted"] = "Sounds/SFX/plant_planted.mp3";
     _resourcePaths["sound_cherrybomb"] = "Sounds/SFX/cherrybomb.mp3";
-    
+    _resourcePaths["sound_wave_start"] = "Sounds/SFX/wave_start.mp3";
+    _resourcePaths["sound_plant_fail"] = "Sounds/SFX/plant_fail.mp3";
+    _resourcePaths["sound_seed_select"] = "Sounds/SFX/seed_select.mp3";
+    _resourcePaths["sound_seed_unavailable"] = "Sounds/SFX/seed_unavailable.mp3";
+    _resourcePaths["sound_seed_ready"] = "Sounds/SFX/seed_ready.mp3";
+
+    // 按ID查路径的索引（播放音效等热路径用）
+    for (const auto& pair : _resourcePaths)
+    {
+        _resourcePathIds[registerAssetName(pair.first)] = pair.second;
+    }
 
-    // ҪĿ¼
+    // 创建必要的目录
     auto fileUtils = FileUtils::getInstance();
     std::vector<std::string> searchPaths = fileUtils->getSearchPaths();
     searchPaths.push_back("Resources/");
     fileUtils->setSearchPaths(searchPaths);
 }
 
-// 򻯵Ķ - Ӳڴ
-void ResourceLoader::loadSimpleAnimationConfig()
-{
-    log("ResourceLoader::loadSimpleAnimationConfig: Starting animation loading");
-
-    // տж
-    std::vector<std::string> sunflowerIdleFrames = {
-        "Images/Plants/Sunflower/sunflower_idle_01.png",
-        "Images/Plants/Sunflower/sunflower_idle_02.png",
-        "Images/Plants/Sunflower/sunflower_idle_03.png",
-        "Images/Plants/Sunflower/sunflower_idle_04.png",
-        "Images/Plants/Sunflower/sunflower_idle_05.png",
-        "Images/Plants/Sunflower/sunflower_idle_06.png",
-        "Images/Plants/Sunflower/sunflower_idle_07.png",
-        "Images/Plants/Sunflower/sunflower_idle_08.png",
-        "Images/Plants/Sunflower/sunflower_idle_09.png",
-        "Images/Plants/Sunflower/sunflower_idle_10.png",
-        "Images/Plants/Sunflower/sunflower_idle_11.png",
-        "Images/Plants/Sunflower/sunflower_idle_12.png",
-        "Images/Plants/Sunflower/sunflower_idle_13.png",
-        "Images/Plants/Sunflower/sunflower_idle_14.png",
-        "Images/Plants/Sunflower/sunflower_idle_15.png",
-        "Images/Plants/Sunflower/sunflower_idle_16.png",
-        "Images/Plants/Sunflower/sunflower_idle_17.png",
-        "Images/Plants/Sunflower/sunflower_idle_18.png",
-    };
-    loadAnimationFrames("sunflower_idle", sunflowerIdleFrames, 0.15f);
-
-    // տ
-    std::vector<std::string> sunflowerProduceFrames = {
-        "Images/Plants/Sunflower/sunflower_produce_01.png",
-        "Images/Plants/Sunflower/sunflower_produce_02.png",
-        "Images/Plants/Sunflower/sunflower_produce_03.png",
-        "Images/Plants/Sunflower/sunflower_produce_04.png"
-    };
-    loadAnimationFrames("sunflower_produce", sunflowerProduceFrames, 0.1f);
-
-    // 㶹ֿж
-    std::vector<std::string> peashooterIdleFrames = {
-        "Images/Plants/Peashooter/peashooter_idle_01.png",
-        "Images/Plants/Peashooter/peashooter_idle_02.png",
-        "Images/Plants/Peashooter/peashooter_idle_03.png",
-        "Images/Plants/Peashooter/peashooter_idle_04.png",
-        "Images/Plants/Peashooter/peashooter_idle_05.png",
-        "Images/Plants/Peashooter/peashooter_idle_06.png",
-        "Images/Plants/Peashooter/peashooter_idle_07.png",
-        "Images/Plants/Peashooter/peashooter_idle_08.png",
-        "Images/Plants/Peashooter/peashooter_idle_09.png",
-        "Images/Plants/Peashooter/peashooter_idle_10.png",
-        "Images/Plants/Peashooter/peashooter_idle_11.png",
-        "Images/Plants/Peashooter/peashooter_idle_12.png",
-        "Images/Plants/Peashooter/peashooter_idle_13.png"
-    };
-    loadAnimationFrames("peashooter_idle", peashooterIdleFrames, 0.2f);
-
-    // 㶹ֹ
-    std::vector<std::string> peashooterAttackFrames = {
-        "Images/Plants/Peashooter/peashooter_attack_01.png",
-        "Images/Plants/Peashooter/peashooter_attack_02.png",
-        "Images/Plants/Peashooter/peashooter_attack_03.png",
-        "Images/Plants/Peashooter/peashooter_attack_04.png",
-        "Images/Plants/Peashooter/peashooter_attack_05.png",
-        "Images/Plants/Peashooter/peashooter_attack_06.png"
-    };
-    loadAnimationFrames("peashooter_attack", peashooterAttackFrames, 0.08f);
-
-    // 㶹ж
-    std::vector<std::string> peaFlyFrames = {
-        "Images/Projectiles/Pea/pea_01.png",
-        "Images/Projectiles/Pea/pea_02.png",
-        "Images/Projectiles/Pea/pea_03.png",
-        "Images/Projectiles/Pea/pea_04.png"
-    };
-    loadAnimationFrames("pea_fly", peaFlyFrames, 0.1f);
-
-    // 㶹ж
-    std::vector<std::string> peaHitFrames = {
-        "Images/Projectiles/Pea/pea_hit_01.png",
-        "Images/Projectiles/Pea/pea_hit_02.png",
-        "Images/Projectiles/Pea/pea_hit_03.png",
-        "Images/Projectiles/Pea/pea_hit_04.png"
-    };
-    loadAnimationFrames("pea_hit", peaHitFrames, 0.07f);
-
-    // ж
-    std::vector<std::string> snowPeaFlyFrames = {
-        "Images/Projectiles/SnowPea/snow_pea_01.png",
-        "Images/Projectiles/SnowPea/snow_pea_02.png",
-        "Images/Projectiles/SnowPea/snow_pea_03.png",
-        "Images/Projectiles/SnowPea/snow_pea_04.png"
-    };
-    loadAnimationFrames("snow_pea_fly", snowPeaFlyFrames, 0.1f);
-
-    // ǽж
-    std::vector<std::string> wallnutIdleFrames = {
-        "Images/Plants/WallNut/wallnut_idle_01.png",
-        "Images/Plants/WallNut/wallnut_idle_02.png",
-        "Images/Plants/WallNut/wallnut_idle_03.png",
-        "Images/Plants/WallNut/wallnut_idle_04.png",
-        "Images/Plants/WallNut/wallnut_idle_05.png",
-        "Images/Plants/WallNut/wallnut_idle_06.png",
-        "Images/Plants/WallNut/wallnut_idle_07.png",
-        "Images/Plants/WallNut/wallnut_idle_08.png",
-        "Images/Plants/WallNut/wallnut_idle_09.png",
-        "Images/Plants/WallNut/wallnut_idle_10.png",
-        "Images/Plants/WallNut/wallnut_idle_11.png",
-        "Images/Plants/WallNut/wallnut_idle_12.png",
-        "Images/Plants/WallNut/wallnut_idle_13.png",
-        "Images/Plants/WallNut/wallnut_idle_14.png",
-        "Images/Plants/WallNut/wallnut_idle_15.png",
-        "Images/Plants/WallNut/wallnut_idle_16.png",
-    };
-    loadAnimationFrames("wallnut_idle", wallnutIdleFrames, 0.3f);
+void ResourceLoader::registerResidencyGroups()
+{
+    auto residency = TextureResidency::getInstance();
 
-    // ǽ𶯻1
-    std::vector<std::string> wallnutDamaged1Frames = {
-        "Images/Plants/WallNut/wallnut_damaged1_01.png",
-        "Images/Plants/WallNut/wallnut_damaged1_02.png",
-        "Images/Plants/WallNut/wallnut_damaged1_03.png"
-    };
-    loadAnimationFrames("wallnut_damaged1", wallnutDamaged1Frames, 0.2f);
+    std::vector<std::string> menuImages(std::begin(MENU_IMAGE_NAMES), std::end(MENU_IMAGE_NAMES));
+    residency->registerGroup("menu", LoadingPhase::MENU_RESOURCES, true, getImagePaths(menuImages),
+        [this, menuImages]() { loadImages(menuImages); },
+        [this, menuImages]() { unloadTextures(getImagePaths(menuImages)); });
 
-    // ǽ𶯻2
-    std::vector<std::string> wallnutDamaged2Frames = {
-        "Images/Plants/WallNut/wallnut_damaged2_01.png",
-        "Images/Plants/WallNut/wallnut_damaged2_02.png",
-        "Images/Plants/WallNut/wallnut_damaged2_03.png"
-    };
-    loadAnimationFrames("wallnut_damaged2", wallnutDamaged2Frames, 0.2f);
-
-    // Ư
-    std::vector<std::string> sunFloatingFrames = {
-        "Images/UI/Sun/sun_01.png",
-        "Images/UI/Sun/sun_02.png",
-        "Images/UI/Sun/sun_03.png",
-        "Images/UI/Sun/sun_04.png",
-        "Images/UI/Sun/sun_05.png",
-        "Images/UI/Sun/sun_06.png",
-        "Images/UI/Sun/sun_07.png",
-        "Images/UI/Sun/sun_08.png",
-        "Images/UI/Sun/sun_09.png",
-        "Images/UI/Sun/sun_10.png",
-        "Images/UI/Sun/sun_11.png",
-        "Images/UI/Sun/sun_12.png",
-        "Images/UI/Sun/sun_13.png",
-        "Images/UI/Sun/sun_14.png",
-        "Images/UI/Sun/sun_15.png",
-        "Images/UI/Sun/sun_16.png",
-        "Images/UI/Sun/sun_17.png",
-        "Images/UI/Sun/sun_18.png",
-        "Images/UI/Sun/sun_19.png",
-        "Images/UI/Sun/sun_20.png",
-        "Images/UI/Sun/sun_21.png",
-        "Images/UI/Sun/sun_22.png",
-        "Images/UI/Sun/sun_23.png",
-        "Images/UI/Sun/sun_24.png",
-        "Images/UI/Sun/sun_25.png",
-        "Images/UI/Sun/sun_26.png",
-        "Images/UI/Sun/sun_27.png",
-        "Images/UI/Sun/sun_28.png",
-        "Images/UI/Sun/sun_29.png"
-    };
-    loadAnimationFrames("sun_floating", sunFloatingFrames, 0.2f);
+    std::vector<std::string> gameImages(std::begin(GAME_IMAGE_NAMES), std::end(GAME_IMAGE_NAMES));
+    residency->registerGroup("game", LoadingPhase::GAME_RESOURCES, true, getImagePaths(gameImages),
+        [this, gameImages]() { loadImages(gameImages); },
+        [this, gameImages]() { unloadTextures(getImagePaths(gameImages)); });
 
-    // ռ
-    std::vector<std::string> sunCollectFrames = {
-        "Images/UI/Sun/sun_collect_01.png",
-        "Images/UI/Sun/sun_collect_02.png",
-        "Images/UI/Sun/sun_collect_03.png"
-    };
-    loadAnimationFrames("sun_collect", sunCollectFrames, 0.1f);
-
-    // ӣըж
-    std::vector<std::string> cherryBombIdleFrames = {
-        "Images/Plants/CherryBomb/cherrybomb_idle_01.png",
-        "Images/Plants/CherryBomb/cherrybomb_idle_02.png",
-        "Images/Plants/CherryBomb/cherrybomb_idle_03.png",
-        "Images/Plants/CherryBomb/cherrybomb_idle_04.png",
-        "Images/Plants/CherryBomb/cherrybomb_idle_05.png",
-        "Images/Plants/CherryBomb/cherrybomb_idle_06.png"
-    };
-    loadAnimationFrames("cherrybomb_idle", cherryBombIdleFrames, 0.15f);
-
-    // ӣըը
-    std::vector<std::string> cherryBombExplodeFrames = {
-        "Images/Plants/CherryBomb/cherrybomb_explode_01.png",
-        "Images/Plants/CherryBomb/cherrybomb_explode_02.png",
-        "Images/Plants/CherryBomb/cherrybomb_explode_03.png",
-        "Images/Plants/CherryBomb/cherrybomb_explode_04.png",
-        "Images/Plants/CherryBomb/cherrybomb_explode_05.png",
-        "Images/Plants/CherryBomb/cherrybomb_explode_06.png",
-        "Images/Plants/CherryBomb/cherrybomb_explode_07.png",
-        "Images/Plants/CherryBomb/cherrybomb_explode_08.png"
-    };
-    loadAnimationFrames("cherrybomb_explode", cherryBombExplodeFrames, 0.07f);
-
-    // ֿж
-    std::vector<std::string> snowpeaIdleFrames = {
-        "Images/Plants/SnowPea/snowpea_idle_01.png",
-        "Images/Plants/SnowPea/snowpea_idle_02.png",
-        "Images/Plants/SnowPea/snowpea_idle_03.png",
-        "Images/Plants/SnowPea/snowpea_idle_04.png",
-        "Images/Plants/SnowPea/snowpea_idle_05.png",
-        "Images/Plants/SnowPea/snowpea_idle_06.png",
-        "Images/Plants/SnowPea/snowpea_idle_07.png",
-        "Images/Plants/SnowPea/snowpea_idle_08.png",
-        "Images/Plants/SnowPea/snowpea_idle_09.png",
-        "Images/Plants/SnowPea/snowpea_idle_10.png",
-        "Images/Plants/SnowPea/snowpea_idle_11.png",
-        "Images/Plants/SnowPea/snowpea_idle_12.png",
-        "Images/Plants/SnowPea/snowpea_idle_13.png",
-        "Images/Plants/SnowPea/snowpea_idle_14.png",
-        "Images/Plants/SnowPea/snowpea_idle_15.png"
-    };
-    loadAnimationFrames("snowpea_idle", snowpeaIdleFrames, 0.2f);
-
-    // ׿жδ״̬
-    std::vector<std::string> potatomineIdleFrames = {
-        "Images/Plants/PotatoMine/potatomine_idle_01.png",
-        "Images/Plants/PotatoMine/potatomine_idle_02.png",
-        "Images/Plants/PotatoMine/potatomine_idle_03.png",
-        "Images/Plants/PotatoMine/potatomine_idle_04.png"
-    };
-    loadAnimationFrames("potatomine_idle", potatomineIdleFrames, 0.3f);
-
-    // ׼
-    std::vector<std::string> potatomineArmedFrames = {
-        "Images/Plants/PotatoMine/potatomine_armed_01.png",
-        "Images/Plants/PotatoMine/potatomine_armed_02.png",
-        "Images/Plants/PotatoMine/potatomine_armed_03.png",
-        "Images/Plants/PotatoMine/potatomine_armed_04.png",
-        "Images/Plants/PotatoMine/potatomine_armed_05.png",
-        "Images/Plants/PotatoMine/potatomine_armed_06.png",
-        "Images/Plants/PotatoMine/potatomine_armed_07.png",
-        "Images/Plants/PotatoMine/potatomine_armed_08.png"
-    };
-    loadAnimationFrames("potatomine_armed", potatomineArmedFrames, 0.2f);
-
-    // ױը
-    std::vector<std::string> potatomineExplodeFrames = {
-        "Images/Plants/PotatoMine/potatomine_explode_01.png",
-        "Images/Plants/PotatoMine/potatomine_explode_02.png",
-        "Images/Plants/PotatoMine/potatomine_explode_03.png",
-        "Images/Plants/PotatoMine/potatomine_explode_04.png",
-        "Images/Plants/PotatoMine/potatomine_explode_05.png",
-        "Images/Plants/PotatoMine/potatomine_explode_06.png"
-    };
-    loadAnimationFrames("potatomine_explode", potatomineExplodeFrames, 1.0f);
+    // 动画帧优先从图集里取，所以图集组的加载 = 加载图集页 + 建该组的动画
+    for (const auto& info : ATLAS_GROUPS)
+    {
+        std::string group = info.name;
+        residency->registerGroup(group, LoadingPhase::GAME_RESOURCES, info.pinned, getAtlasGroupTextures(info.name),
+            [this, group]() {
+                int pageCount = loadAtlasGroup(group.c_str());
+                loadManifestAnimations(group.c_str(), true);
+                // 没有图集时（未运行pack_atlases）按散图加载，结果一样只是draw call多
+                PVZ_LOGD(LogCategory::RESOURCE, "ResourceLoader: atlas group %s loaded, %d pages", group.c_str(), pageCount);
+            },
+            [this, group]() { unloadAtlasGroup(group.c_str()); });
+    }
+}
+
+std::vector<std::string> ResourceLoader::getImagePaths(const std::vector<std::string>& imageNames) const
+{
+    std::vector<std::string> paths;
+    for (const auto& name : imageNames)
+    {
+        auto it = _resourcePaths.find(name);
+        if (it != _resourcePaths.end())
+        {
+            paths.push_back(it->second);
+        }
+    }
+    return paths;
+}
+
+std::vector<std::string> ResourceLoader::getAtlasGroupTextures(const char* group) const
+{
+    auto fileUtils = FileUtils::getInstance();
+    bool useEtc1 = isUsingEtc1(group);
+
+    std::vector<std::string> textures;
+    for (int page = 0; ; page++)
+    {
+        if (!fileUtils->isFileExist(StringUtils::format("Atlases/%s-%d.plist", group, page)))
+        {
+            break;
+        }
+        std::string etcPath = StringUtils::format("Atlases/%s-%d.pkm", group, page);
+        textures.push_back(useEtc1 && fileUtils->isFileExist(etcPath)
+            ? etcPath
+            : StringUtils::format("Atlases/%s-%d.png", group, page));
+    }
+
+    // 没有图集时是清单里该组的散帧
+    if (textures.empty())
+    {
+        for (int i = 0; i < _animationManifest.getAnimationCount(); i++)
+        {
+            const auto& entry = _animationManifest.getAnimation(i);
+            if (strcmp(_animationManifest.getGroup(entry), group) != 0)
+            {
+                continue;
+            }
+            for (int f = 0; f < entry.frameCount; f++)
+            {
+                textures.push_back(_animationManifest.getFrame(entry, f));
+            }
+        }
+    }
+    return textures;
+}
+
+int ResourceLoader::loadAtlasGroup(const char* group)
+{
+    auto fileUtils = FileUtils::getInstance();
+    auto spriteFrameCache = SpriteFrameCache::getInstance();
+    bool useEtc1 = isUsingEtc1(group);
+
+    int page = 0;
+    for (; ; page++)
+    {
+        std::string plistPath = StringUtils::format("Atlases/%s-%d.plist", group, page);
+        if (!fileUtils->isFileExist(plistPath))
+        {
+            break;
+        }
+
+        // 已加载过的plist会直接跳过
+        std::string etcPath = StringUtils::format("Atlases/%s-%d.pkm", group, page);
+        if (useEtc1 && fileUtils->isFileExist(etcPath))
+        {
+            // TextureCache会一并加载 <名字>.pkm@alpha 作为透明通道纹理
+            spriteFrameCache->addSpriteFramesWithFile(plistPath, etcPath);
+        }
+        else
+        {
+            PixelFormatScope format(getPixelFormatForPath(plistPath));
+            spriteFrameCache->addSpriteFramesWithFile(plistPath);
+        }
+    }
+    return page;
+}
+
+Texture2D::PixelFormat ResourceLoader::getPixelFormatForPath(const std::string& path) const
+{
+    int group = _animationManifest.findTextureGroupForPath(path.c_str());
+    return group >= 0
+        ? toTexturePixelFormat(_animationManifest.getTextureGroup(group).pixelFormat)
+        : Texture2D::getDefaultAlphaPixelFormat();
+}
+
+bool ResourceLoader::isUsingEtc1(const char* group) const
+{
+    // 图集分组按图集页路径归入纹理分组（如 Atlases/zombie_normal-0 属于 zombies）
+    int index = _animationManifest.findTextureGroupForPath(StringUtils::format("Atlases/%s-0.plist", group).c_str());
+    return index >= 0 &&
+        _animationManifest.getTextureGroup(index).pixelFormat == AnimationManifest::PIXEL_ETC1 &&
+        Configuration::getInstance()->supportsETC();
+}
+
+std::vector<ResourceLoader::TextureMemoryStat> ResourceLoader::getTextureMemoryStats() const
+{
+    std::vector<TextureMemoryStat> stats(_animationManifest.getTextureGroupCount() + 1);
+    for (int i = 0; i < _animationManifest.getTextureGroupCount(); i++)
+    {
+        stats[i].group = _animationManifest.getName(_animationManifest.getTextureGroup(i));
+    }
+    stats.back().group = "other";
+
+    // TextureCache不提供遍历接口，解析它的调试输出：
+    // "<路径>" rc=1 id=3 256 x 2048 @ 16 bpp => 1024 KB
+    std::istringstream info(Director::getInstance()->getTextureCache()->getCachedTextureInfo());
+    std::string line;
+    while (std::getline(info, line))
+    {
+        size_t quote = line.find('"', 1);
+        unsigned long width = 0, height = 0;
+        long bpp = 0;
+        if (line.empty() || line[0] != '"' || quote == std::string::npos ||
+            sscanf(line.c_str() + quote + 1, " rc=%*u id=%*u %lu x %lu @ %ld bpp", &width, &height, &bpp) != 3)
+        {
+            continue;
+        }
+
+        std::string path = line.substr(1, quote - 1);
+        int group = _animationManifest.findTextureGroupForPath(path.c_str());
+        TextureMemoryStat& stat = group >= 0 ? stats[group] : stats.back();
+        stat.textureCount++;
+        stat.bytes += (size_t)width * height * bpp / 8;
+    }
+    return stats;
+}
+
+void ResourceLoader::reportTextureMemory() const
+{
+    size_t total = 0;
+    PVZ_LOGI(LogCategory::RESOURCE, "Texture memory by group:");
+    for (const auto& stat : getTextureMemoryStats())
+    {
+        int group = _animationManifest.findTextureGroup(stat.group.c_str());
+        const char* format = group >= 0
+            ? AnimationManifest::getPixelFormatName((AnimationManifest::PixelFormat)_animationManifest.getTextureGroup(group).pixelFormat)
+            : "-";
+        PVZ_LOGI(LogCategory::RESOURCE, "  %-12s %-8s %3d textures %8.1f KB",
+            stat.group.c_str(), format, stat.textureCount, stat.bytes / 1024.0);
+        total += stat.bytes;
+    }
+    PVZ_LOGI(LogCategory::RESOURCE, "  total %.2f MB", total / (1024.0 * 1024.0));
+}
+
+void ResourceLoader::unloadAtlasGroup(const char* group)
+{
+    PVZ_PROFILE_ZONE("ResourceLoader::unloadAtlasGroup");
+
+    // 释放该组的动画；场上的僵尸各自持有引用，纹理等它们释放后才回收
+    // （池中空闲僵尸的引用由WaveManager在淘汰通知里释放，隐藏精灵的动画轨道在下面停掉）
+    for (int i = 0; i < _animationManifest.getAnimationCount(); i++)
+    {
+        const auto& entry = _animationManifest.getAnimation(i);
+        if (strcmp(_animationManifest.getGroup(entry), group) != 0)
+        {
+            continue;
+        }
+        AssetId id = hashAssetName(_animationManifest.getName(entry));
+        Animation** animation = _animations.find(id);
+        if (animation)
+        {
+            CC_SAFE_RELEASE(*animation);
+            _animations.erase(id);
+        }
+    }
+
+    auto fileUtils = FileUtils::getInstance();
+    for (int page = 0; ; page++)
+    {
+        std::string plistPath = StringUtils::format("Atlases/%s-%d.plist", group, page);
+        if (!fileUtils->isFileExist(plistPath))
+        {
+            break;
+        }
+        SpriteFrameCache::getInstance()->removeSpriteFramesFromFile(plistPath);
+    }
+
+    unloadTextures(getAtlasGroupTextures(group));
 
-    log("Simple animation config loaded with %d animations", (int)_animations.size());
+    // 隐藏的精灵（池中空闲、播完等待回收）不推进动画，轨道却还持有动画；停掉它们，复用时会重新play
+    SpriteAnimator::getInstance()->stopHidden();
+}
+
+void ResourceLoader::unloadTextures(const std::vector<std::string>& paths)
+{
+    auto textureCache = Director::getInstance()->getTextureCache();
+    for (const auto& path : paths)
+    {
+        Texture2D* texture = textureCache->getTextureForKey(path);
+        if (texture)
+        {
+            textureCache->removeTexture(texture);
+        }
+    }
+}
+
+void ResourceLoader::loadAnimationManifest()
+{
+    PVZ_PROFILE_ZONE("ResourceLoader::loadAnimationManifest");
+
+    auto fileUtils = FileUtils::getInstance();
+
+    // 优先读编译好的二进制索引（proj.headless的compile_animations生成），整块读入只做校验；
+    // 挂载了资源包时直接从映射内存解析
+    AssetPack::View view;
+    Data binary;
+    if (!PackFileUtils::findFile(ANIMATION_INDEX_PATH, &view))
+    {
+        binary = fileUtils->getDataFromFile(ANIMATION_INDEX_PATH);
+        view.data = binary.getBytes();
+        view.size = (size_t)binary.getSize();
+    }
+    if (view.data && _animationManifest.loadBinary(view.data, view.size))
+    {
+        PVZ_LOGI(LogCategory::RESOURCE, "Animation index loaded: %d animations, %d frames",
+            _animationManifest.getAnimationCount(), _animationManifest.getTotalFrameCount());
+        return;
+    }
+
+    // 没有索引或版本不符时解析JSON（开发时改了清单还没重新编译也能跑）
+    std::string text = fileUtils->getStringFromFile(ANIMATION_MANIFEST_PATH);
+    std::string error;
+    if (_animationManifest.loadJson(text.c_str(), text.size(), &error))
+    {
+        PVZ_LOGW(LogCategory::RESOURCE, "%s missing or stale, parsed %s: %d animations",
+            ANIMATION_INDEX_PATH, ANIMATION_MANIFEST_PATH, _animationManifest.getAnimationCount());
+    }
+    else
+    {
+        PVZ_LOGE(LogCategory::RESOURCE, "Failed to load %s: %s", ANIMATION_MANIFEST_PATH, error.c_str());
+    }
+}
+
+void ResourceLoader::loadManifestAnimations(const char* group, bool inGroup)
+{
+    PVZ_PROFILE_ZONE("ResourceLoader::loadManifestAnimations");
+
+    for (int i = 0; i < _animationManifest.getAnimationCount(); i++)
+    {
+        const auto& entry = _animationManifest.getAnimation(i);
+        if ((strcmp(_animationManifest.getGroup(entry), group) == 0) == inGroup)
+        {
+            loadManifestAnimation(entry);
+        }
+    }
+
+    PVZ_LOGI(LogCategory::RESOURCE, "Manifest animations loaded (%s%s), %d cached",
+        inGroup ? "" : "all but ", group, (int)_animations.size());
+}
+
+void ResourceLoader::loadManifestAnimation(const AnimationManifest::Entry& entry)
+{
+    const char* animationName = _animationManifest.getName(entry);
+
+    cocos2d::Vector<cocos2d::SpriteFrame*> spriteFrames(entry.frameCount);
+    std::string framePath;
+    for (int i = 0; i < entry.frameCount; i++)
+    {
+        framePath.assign(_animationManifest.getFrame(entry, i));
+        auto spriteFrame = loadAnimationFrame(framePath);
+        if (spriteFrame)
+        {
+            spriteFrames.pushBack(spriteFrame);
+        }
+    }
+
+    if (spriteFrames.empty())
+    {
+        PVZ_LOGE(LogCategory::RESOURCE, "No frames for animation %s", animationName);
+        return;
+    }
+
+    auto animation = Animation::createWithSpriteFrames(spriteFrames, entry.delay);
+    animation->setRestoreOriginalFrame((entry.flags & AnimationManifest::FLAG_RESTORE) != 0);
+    cacheAnimation(animationName, animation);
+    PVZ_LOGT(LogCategory::RESOURCE, "Manifest animation created: %s with %d frames",
+        animationName, (int)spriteFrames.size());
+}
+
+bool ResourceLoader::isAnimationLooping(const std::string& name) const
+{
+    int index = _animationManifest.findAnimation(name.c_str());
+    return index >= 0 && (_animationManifest.getAnimation(index).flags & AnimationManifest::FLAG_LOOP) != 0;
 }
 
 void ResourceLoader::preloadResources(LoadingPhase phase)
 {
+    PVZ_PROFILE_ZONE("ResourceLoader::preloadResources");
+
+    // 纹理按阶段驻留：加载本阶段的图片和常驻图集，卸载上一阶段的；字体和声音只加载一次
+    auto residency = TextureResidency::getInstance();
+
     switch (phase)
     {
     case LoadingPhase::MENU_RESOURCES:
+        residency->enterPhase(phase);
         if (!_isMenuResourcesLoaded)
         {
-            // ز˵ͼƬ
-            std::vector<std::string> menuImages = {
-                "menu_background",
-                "start_button_normal",
-                "start_button_pressed",
-                "menu_logo"
-            };
-            loadImages(menuImages);
-
-            // 
+            // 加载字体
             std::vector<std::string> fonts = {
                 "font_main",
                 "font_score"
             };
             loadFonts(fonts);
 
-            // Ч
+            // 加载音效
             std::vector<std::string> sounds = {
                 "sound_button_click",
             };
             loadSoundEffects(sounds);
 
-            // ر
+            // 加载背景音乐
             std::vector<std::string> bgm = {
                 "sound_menu_bgm"
             };
@@ -380,26 +525,26 @@ void ResourceLoader::preloadResources(LoadingPhase phase)
         break;
 
     case LoadingPhase::GAME_RESOURCES:
+        residency->enterPhase(phase);
         if (!_isGameResourcesLoaded)
         {
-            // ϷͼƬ
-            std::vector<std::string> gameImages = {
-                "game_background",
-                "card_bar_bg"
-            };
-            loadImages(gameImages);
-
-            // ϷЧ
+            // 加载游戏音效：关卡里会播放的全部预先解码，战斗中第一次播放不卡顿
             std::vector<std::string> gameSounds = {
                 "sound_shoot",
                 "sound_explosion",
+                "sound_cherrybomb",
                 "sound_sun_produced",
                 "sound_sun_collected",
-                "sound_plant_planted"
+                "sound_plant_planted",
+                "sound_plant_fail",
+                "sound_wave_start",
+                "sound_seed_select",
+                "sound_seed_unavailable",
+                "sound_seed_ready"
             };
             loadSoundEffects(gameSounds);
 
-            // ϷBGM       
+            // 加载游戏BGM       
             std::vector<std::string> gameBgm = {
                 "sound_game_bgm"
             };
@@ -412,6 +557,7 @@ void ResourceLoader::preloadResources(LoadingPhase phase)
     case LoadingPhase::ALL_RESOURCES:
         preloadResources(LoadingPhase::MENU_RESOURCES);
         preloadResources(LoadingPhase::GAME_RESOURCES);
+        residency->enterPhase(phase);
         break;
     }
 }
@@ -426,8 +572,8 @@ void ResourceLoader::loadImages(const std::vector<std::string>& imageFiles)
         if (it != _resourcePaths.end())
         {
             textureCache->addImageAsync(it->second, [](Texture2D* texture) {
-                // ɻص
-                log("Texture loaded: %s", texture->getPath().c_str());
+                // 纹理加载完成回调
+                PVZ_LOGD(LogCategory::RESOURCE, "Texture loaded: %s", texture->getPath().c_str());
                 });
         }
     }
@@ -442,33 +588,33 @@ void ResourceLoader::loadSpriteSheets(const std::vector<std::pair<std::string, s
         const std::string& plistPath = sheet.first;
         const std::string& texturePath = sheet.second;
 
-        // ȼ
+        // 先加载纹理
         auto textureCache = Director::getInstance()->getTextureCache();
         textureCache->addImageAsync(texturePath, [plistPath, spriteFrameCache](Texture2D* texture) {
-            // Ȼplistļ
+            // 然后加载plist文件
             spriteFrameCache->addSpriteFramesWithFile(plistPath, texture);
-            log("Sprite sheet loaded: %s", plistPath.c_str());
+            PVZ_LOGD(LogCategory::RESOURCE, "Sprite sheet loaded: %s", plistPath.c_str());
             });
     }
 }
 
 void ResourceLoader::loadFonts(const std::vector<std::string>& fontFiles)
 {
-    // Cocos2d-xԶϵͳ
-    // Ҫȷļ
+    // Cocos2d-x会自动加载系统字体
+    // 这里主要是确保字体文件存在
     for (const auto& fontName : fontFiles)
     {
         auto it = _resourcePaths.find(fontName);
         if (it != _resourcePaths.end())
         {
-            // ļǷ
+            // 检查字体文件是否存在
             if (FileUtils::getInstance()->isFileExist(it->second))
             {
-                log("Font found: %s", it->second.c_str());
+                PVZ_LOGD(LogCategory::RESOURCE, "Font found: %s", it->second.c_str());
             }
             else
             {
-                log("Warning: Font not found: %s", it->second.c_str());
+                PVZ_LOGW(LogCategory::RESOURCE, "Font not found: %s", it->second.c_str());
             }
         }
     }
@@ -476,32 +622,32 @@ void ResourceLoader::loadFonts(const std::vector<std::string>& fontFiles)
 
 void ResourceLoader::loadSoundEffects(const std::vector<std::string>& soundFiles)
 {
-    auto audioEngine = CocosDenshion::SimpleAudioEngine::getInstance();
+    auto audioManager = AudioManager::getInstance();
 
     for (const auto& soundName : soundFiles)
     {
         auto it = _resourcePaths.find(soundName);
         if (it != _resourcePaths.end())
         {
-            // ԤЧ
-            audioEngine->preloadEffect(it->second.c_str());
-            log("Sound effect preloaded: %s", it->second.c_str());
+            // 预加载音效（AudioEngine解码成PCM缓存，第一次播放不再解码）
+            audioManager->preloadSoundEffect(it->second);
+            PVZ_LOGI(LogCategory::RESOURCE, "Sound effect preloaded: %s", it->second.c_str());
         }
     }
 }
 
 void ResourceLoader::loadBackgroundMusic(const std::vector<std::string>& musicFiles)
 {
-    auto audioEngine = CocosDenshion::SimpleAudioEngine::getInstance();
+    auto audioManager = AudioManager::getInstance();
 
     for (const auto& musicName : musicFiles)
     {
         auto it = _resourcePaths.find(musicName);
         if (it != _resourcePaths.end())
         {
-            // Ԥر
-            audioEngine->preloadBackgroundMusic(it->second.c_str());
-            log("Background music preloaded: %s", it->second.c_str());
+            // 预加载背景音乐
+            audioManager->preloadBackgroundMusic(it->second);
+            PVZ_LOGI(LogCategory::RESOURCE, "Background music preloaded: %s", it->second.c_str());
         }
     }
 }
@@ -514,7 +660,7 @@ SpriteFrame* ResourceLoader::getSpriteFrame(const std::string& name)
         return it->second;
     }
 
-    // ڻУԴSpriteFrameCacheȡ
+    // 如果不在缓存中，尝试从SpriteFrameCache获取
     auto spriteFrameCache = SpriteFrameCache::getInstance();
     auto spriteFrame = spriteFrameCache->getSpriteFrameByName(name);
     if (spriteFrame)
@@ -582,11 +728,10 @@ void ResourceLoader::clearUnusedResources()
 
     _spriteFrames.clear();
 
-    // 
-    for (auto& pair : _animations)
-    {
-        CC_SAFE_RELEASE(pair.second);
-    }
+    // 清理动画缓存
+    _animations.forEach([](AssetId, Animation* animation) {
+        CC_SAFE_RELEASE(animation);
+    });
     _animations.clear();
 }
 
@@ -594,37 +739,23 @@ void ResourceLoader::loadAnimationFrames(const std::string& animationName,
     const std::vector<std::string>& framePaths,
     float delayPerFrame)
 {
+    PVZ_PROFILE_ZONE("ResourceLoader::loadAnimationFrames");
+
     if (framePaths.empty())
     {
-        log("Error: No frames for animation %s", animationName.c_str());
+        PVZ_LOGE(LogCategory::RESOURCE, "No frames for animation %s", animationName.c_str());
         return;
     }
 
-    log("Loading animation: %s", animationName.c_str());
+    PVZ_LOGD(LogCategory::RESOURCE, "Loading animation: %s", animationName.c_str());
 
-    // ûAnimationHelperֱӴ
     cocos2d::Vector<cocos2d::SpriteFrame*> spriteFrames;
-    auto textureCache = Director::getInstance()->getTextureCache();
-
     for (const auto& framePath : framePaths)
     {
-        // zļǷ
-        if (!FileUtils::getInstance()->isFileExist(framePath)) {
-            log("ERROR: File not found: %s", framePath.c_str());
-        }
-
-        // ͬ
-        auto texture = textureCache->addImage(framePath);
-        if (texture)
+        auto spriteFrame = loadAnimationFrame(framePath);
+        if (spriteFrame)
         {
-            auto spriteFrame = SpriteFrame::createWithTexture(
-                texture,
-                Rect(0, 0, texture->getContentSize().width, texture->getContentSize().height)
-            );
-            if (spriteFrame)
-            {
-                spriteFrames.pushBack(spriteFrame);
-            }
+            spriteFrames.pushBack(spriteFrame);
         }
     }
 
@@ -632,30 +763,63 @@ void ResourceLoader::loadAnimationFrames(const std::string& animationName,
     {
         auto animation = Animation::createWithSpriteFrames(spriteFrames, delayPerFrame);
         cacheAnimation(animationName, animation);
-        log("PNG sequence animation created: %s with %d frames",
+        PVZ_LOGD(LogCategory::RESOURCE, "PNG sequence animation created: %s with %d frames",
             animationName.c_str(), (int)spriteFrames.size());
     }
     
 }
 
+SpriteFrame* ResourceLoader::loadAnimationFrame(const std::string& framePath)
+{
+    // 图集里有这一帧时直接用（同一组的帧共用一张纹理，可以合批）
+    auto atlasFrame = SpriteFrameCache::getInstance()->getSpriteFrameByName(framePath);
+    if (atlasFrame)
+    {
+        return atlasFrame;
+    }
+
+    // 已由AssetPipeline预先解码上传的直接命中缓存，不再检查文件、同步解码
+    auto textureCache = Director::getInstance()->getTextureCache();
+    auto texture = textureCache->getTextureForKey(framePath);
+    if (!texture)
+    {
+        // 檢查文件是否存在
+        if (!FileUtils::getInstance()->isFileExist(framePath)) {
+            PVZ_LOGE(LogCategory::RESOURCE, "File not found: %s", framePath.c_str());
+        }
+
+        // 同步加载纹理（按所属纹理分组的像素格式）
+        PixelFormatScope format(getPixelFormatForPath(framePath));
+        texture = textureCache->addImage(framePath);
+    }
+    if (!texture)
+    {
+        return nullptr;
+    }
+    return SpriteFrame::createWithTexture(
+        texture,
+        Rect(0, 0, texture->getContentSize().width, texture->getContentSize().height)
+    );
+}
+
 void ResourceLoader::loadPNGFramesToTextureCache(const std::vector<std::string>& framePaths)
 {
     auto textureCache = Director::getInstance()->getTextureCache();
 
     for (const auto& framePath : framePaths)
     {
-        // 첽
+        // 异步加载纹理
         if (!textureCache->getTextureForKey(framePath))
         {
             textureCache->addImageAsync(framePath, [framePath](Texture2D* texture) {
                 if (texture)
                 {
-                    log("PNG frame loaded: %s, size: %.0fx%.0f",
+                    PVZ_LOGT(LogCategory::RESOURCE, "PNG frame loaded: %s, size: %.0fx%.0f",
                         framePath.c_str(), texture->getContentSize().width, texture->getContentSize().height);
                 }
                 else
                 {
-                    log("Error: Failed to load PNG frame: %s", framePath.c_str());
+                    PVZ_LOGE(LogCategory::RESOURCE, "Failed to load PNG frame: %s", framePath.c_str());
                 }
                 });
         }
@@ -664,12 +828,13 @@ void ResourceLoader::loadPNGFramesToTextureCache(const std::vector<std::string>&
 
 Animation* ResourceLoader::getCachedAnimation(const std::string& name)
 {
-    auto it = _animations.find(name);
-    if (it != _animations.end())
-    {
-        return it->second;
-    }
-    return nullptr;
+    return getCachedAnimation(hashAssetName(name));
+}
+
+Animation* ResourceLoader::getCachedAnimation(AssetId id) const
+{
+    Animation* const* animation = _animations.find(id);
+    return animation ? *animation : nullptr;
 }
 
 void ResourceLoader::cacheAnimation(const std::string& name, Animation* animation)
@@ -677,12 +842,45 @@ void ResourceLoader::cacheAnimation(const std::string& name, Animation* animatio
     if (animation)
     {
         animation->retain();
-        _animations[name] = animation;
+        Animation*& slot = _animations[registerAssetName(name)];
+        CC_SAFE_RELEASE(slot);
+        slot = animation;
     }
 }
 
+AssetId ResourceLoader::registerAssetName(const std::string& name)
+{
+    AssetId id = hashAssetName(name);
+    std::string& registered = _assetNames[id];
+    if (registered.empty())
+    {
+        registered = name;
+    }
+    else if (registered != name)
+    {
+        // FNV-1a 32位在几百个名字里几乎不会冲突，真冲突时改名即可
+        PVZ_LOGE(LogCategory::RESOURCE, "Asset id collision: %s and %s (0x%08x)", registered.c_str(), name.c_str(), id);
+    }
+    return id;
+}
+
+const char* ResourceLoader::getAssetName(AssetId id) const
+{
+    const std::string* name = _assetNames.find(id);
+    return name ? name->c_str() : "?";
+}
+
+const std::string& ResourceLoader::getResourcePath(AssetId id) const
+{
+    static const std::string empty;
+    const std::string* path = _resourcePathIds.find(id);
+    return path ? *path : empty;
+}
+
 void ResourceLoader::loadAnimations(const std::vector<std::pair<std::string, std::string>>& animations)
 {
+    PVZ_PROFILE_ZONE("ResourceLoader::loadAnimations");
+
     auto spriteFrameCache = SpriteFrameCache::getInstance();
 
     for (const auto& anim : animations)
@@ -690,14 +888,14 @@ void ResourceLoader::loadAnimations(const std::vector<std::pair<std::string, std
         const std::string& plistPath = anim.first;
         const std::string& texturePath = anim.second;
 
-        // ȼ
+        // 先加载纹理
         auto textureCache = Director::getInstance()->getTextureCache();
         textureCache->addImageAsync(texturePath, [plistPath, spriteFrameCache, this](Texture2D* texture) {
-            // plistļ
+            // 加载plist文件
             spriteFrameCache->addSpriteFramesWithFile(plistPath, texture);
-            log("Animation resource loaded: %s", plistPath.c_str());
+            PVZ_LOGD(LogCategory::RESOURCE, "Animation resource loaded: %s", plistPath.c_str());
 
-            // Զ
+            // 自动创建动画并缓存
             createAndCacheAnimations(plistPath);
             });
     }
@@ -705,21 +903,21 @@ void ResourceLoader::loadAnimations(const std::vector<std::pair<std::string, std
 
 void ResourceLoader::createAndCacheAnimations(const std::string& plistPath)
 {
-    // plist·Զ
+    // 根据plist路径自动创建动画
     std::string baseName = plistPath.substr(plistPath.find_last_of("/") + 1);
     baseName = baseName.substr(0, baseName.find_last_of("."));
 
     auto spriteFrameCache = SpriteFrameCache::getInstance();
 
-    // ԴֿܵĶ
+    // 尝试创建各种可能的动画
     std::vector<std::string> animNames = { "idle", "attack", "walk", "damage", "death", "fly", "hit" };
 
     for (const auto& animName : animNames)
     {
         cocos2d::Vector<SpriteFrame*> frames;
 
-        // Լ֡
-        for (int i = 1; i <= 30; i++) // 30֡
+        // 尝试加载帧序列
+        for (int i = 1; i <= 30; i++) // 假设最多30帧
         {
             char frameName[256];
             sprintf(frameName, "%s_%s_%02d.png", baseName.c_str(), animName.c_str(), i);
@@ -731,7 +929,7 @@ void ResourceLoader::createAndCacheAnimations(const std::string& plistPath)
             }
             else
             {
-                if (i == 1) // һ֡ûУ˵
+                if (i == 1) // 第一帧都没有，说明这个动画不存在
                 {
                     break;
                 }
@@ -740,7 +938,7 @@ void ResourceLoader::createAndCacheAnimations(const std::string& plistPath)
 
         if (!frames.empty())
         {
-            float delay = 0.1f; // Ĭӳ
+            float delay = 0.1f; // 默认延迟
             if (animName == "idle") delay = 0.2f;
             else if (animName == "attack") delay = 0.05f;
             else if (animName == "walk") delay = 0.15f;
@@ -750,166 +948,62 @@ void ResourceLoader::createAndCacheAnimations(const std::string& plistPath)
             auto animation = Animation::createWithSpriteFrames(frames, delay);
             std::string cacheKey = baseName + "_" + animName;
             cacheAnimation(cacheKey, animation);
-            log("Animation created and cached: %s", cacheKey.c_str());
+            PVZ_LOGD(LogCategory::RESOURCE, "Animation created and cached: %s", cacheKey.c_str());
         }
     }
 }
 
 void ResourceLoader::printCachedAnimations()
 {
-    log("=== Cached Animations ===");
-    log("Total animations: %d", (int)_animations.size());
+    PVZ_LOGI(LogCategory::RESOURCE, "=== Cached Animations ===");
+    PVZ_LOGI(LogCategory::RESOURCE, "Total animations: %d", (int)_animations.size());
+
+    _animations.forEach([this](AssetId id, Animation*) {
+        PVZ_LOGD(LogCategory::RESOURCE, "  Animation: %s (0x%08x)", getAssetName(id), id);
+    });
+    PVZ_LOGI(LogCategory::RESOURCE, "=========================");
+}
+
+bool ResourceLoader::hasAnimation(const std::string& name)
+{
+    return _animations.find(hashAssetName(name)) != nullptr;
+}
+
+void ResourceLoader::getZombieResourceGroups(ZombieType type, std::vector<const char*>& groups) const
+{
+    // 路障、铁桶僵尸的死亡动画用普通僵尸的帧
+    switch (type)
+    {
+    case ZombieType::CONEHEAD:
+        groups.push_back("zombie_conehead");
+        groups.push_back("zombie_normal");
+        break;
+    case ZombieType::BUCKETHEAD:
+        groups.push_back("zombie_buckethead");
+        groups.push_back("zombie_normal");
+        break;
+    default:
+        groups.push_back("zombie_normal");
+        break;
+    }
+}
 
-    for (const auto& pair : _animations)
+void ResourceLoader::acquireZombieResources(ZombieType type)
+{
+    std::vector<const char*> groups;
+    getZombieResourceGroups(type, groups);
+    for (const char* group : groups)
     {
-        log("  Animation: %s", pair.first.c_str());
+        TextureResidency::getInstance()->acquire(group);
     }
-    log("=========================");
 }
 
-bool ResourceLoader::hasAnimation(const std::string& name)
+void ResourceLoader::prefetchZombieResources(ZombieType type)
 {
-    return _animations.find(name) != _animations.end();
-}
-
-void ResourceLoader::preloadZombieResources()
-{
-    // Ԥͨʬ
-    std::vector<std::string> zombieWalkFrames = {
-        "Images/Zombies/Normal/walk_01.png",
-        "Images/Zombies/Normal/walk_02.png",
-        "Images/Zombies/Normal/walk_03.png",
-        "Images/Zombies/Normal/walk_04.png",
-        "Images/Zombies/Normal/walk_05.png",
-        "Images/Zombies/Normal/walk_06.png",
-        "Images/Zombies/Normal/walk_07.png",
-        "Images/Zombies/Normal/walk_08.png",
-        "Images/Zombies/Normal/walk_09.png",
-        "Images/Zombies/Normal/walk_10.png",
-        "Images/Zombies/Normal/walk_11.png",
-        "Images/Zombies/Normal/walk_12.png",
-        "Images/Zombies/Normal/walk_13.png",
-        "Images/Zombies/Normal/walk_14.png",
-        "Images/Zombies/Normal/walk_15.png",
-        "Images/Zombies/Normal/walk_16.png",
-        "Images/Zombies/Normal/walk_17.png",
-        "Images/Zombies/Normal/walk_18.png"
-    };
-    loadAnimationFrames("zombie_normal_walk", zombieWalkFrames, 0.2f);
-
-    // Ԥͨʬ
-    std::vector<std::string> zombieAttackFrames = {
-        "Images/Zombies/Normal/attack_01.png",
-        "Images/Zombies/Normal/attack_02.png",
-        "Images/Zombies/Normal/attack_03.png",
-        "Images/Zombies/Normal/attack_04.png",
-        "Images/Zombies/Normal/attack_05.png",
-        "Images/Zombies/Normal/attack_06.png",
-        "Images/Zombies/Normal/attack_07.png",
-        "Images/Zombies/Normal/attack_08.png",
-        "Images/Zombies/Normal/attack_09.png",
-        "Images/Zombies/Normal/attack_10.png",
-        "Images/Zombies/Normal/attack_11.png",
-        "Images/Zombies/Normal/attack_12.png",
-        "Images/Zombies/Normal/attack_13.png",
-        "Images/Zombies/Normal/attack_14.png",
-        "Images/Zombies/Normal/attack_15.png",
-        "Images/Zombies/Normal/attack_16.png",
-        "Images/Zombies/Normal/attack_17.png",
-        "Images/Zombies/Normal/attack_18.png",
-        "Images/Zombies/Normal/attack_19.png",
-        "Images/Zombies/Normal/attack_20.png",
-        "Images/Zombies/Normal/attack_21.png"
-    };
-    loadAnimationFrames("zombie_normal_attack", zombieAttackFrames, 0.3f);
-
-    // Ԥͨʬ
-    std::vector<std::string> zombieDeathFrames = {
-        "Images/Zombies/Normal/death_01.png",
-        "Images/Zombies/Normal/death_02.png",
-        "Images/Zombies/Normal/death_03.png",
-        "Images/Zombies/Normal/death_04.png",
-        "Images/Zombies/Normal/death_05.png",
-        "Images/Zombies/Normal/death_06.png",
-        "Images/Zombies/Normal/death_07.png",
-        "Images/Zombies/Normal/death_08.png",
-        "Images/Zombies/Normal/death_09.png",
-        "Images/Zombies/Normal/death_10.png"
-    };
-    loadAnimationFrames("zombie_normal_death", zombieDeathFrames, 0.3f);
-
-    // Ԥ·ϽʬҪͼƬԴ
-    std::vector<std::string> coneheadWalkFrames = {
-        "Images/Zombies/Conehead/walk_01.png",
-        "Images/Zombies/Conehead/walk_02.png",
-        "Images/Zombies/Conehead/walk_03.png",
-        "Images/Zombies/Conehead/walk_04.png",
-        "Images/Zombies/Conehead/walk_05.png",
-        "Images/Zombies/Conehead/walk_06.png",
-        "Images/Zombies/Conehead/walk_07.png",
-        "Images/Zombies/Conehead/walk_08.png",
-        "Images/Zombies/Conehead/walk_09.png",
-        "Images/Zombies/Conehead/walk_10.png",
-        "Images/Zombies/Conehead/walk_11.png",
-        "Images/Zombies/Conehead/walk_12.png",
-        "Images/Zombies/Conehead/walk_13.png",
-        "Images/Zombies/Conehead/walk_14.png",
-        "Images/Zombies/Conehead/walk_15.png",
-        "Images/Zombies/Conehead/walk_16.png",
-        "Images/Zombies/Conehead/walk_17.png",
-        "Images/Zombies/Conehead/walk_18.png",
-        "Images/Zombies/Conehead/walk_19.png",
-        "Images/Zombies/Conehead/walk_20.png",
-    };
-    loadAnimationFrames("zombie_conehead_walk", coneheadWalkFrames, 0.2f);
-
-    std::vector<std::string> coneheadAttackFrames = {
-        "Images/Zombies/Conehead/attack_01.png",
-        "Images/Zombies/Conehead/attack_02.png",
-        "Images/Zombies/Conehead/attack_03.png",
-        "Images/Zombies/Conehead/attack_04.png",
-        "Images/Zombies/Conehead/attack_05.png",
-        "Images/Zombies/Conehead/attack_06.png",
-        "Images/Zombies/Conehead/attack_07.png",
-        "Images/Zombies/Conehead/attack_08.png",
-        "Images/Zombies/Conehead/attack_09.png",
-        "Images/Zombies/Conehead/attack_10.png",
-        "Images/Zombies/Conehead/attack_11.png"
-    };
-    loadAnimationFrames("zombie_conehead_attack", coneheadAttackFrames, 0.3f);
-
-    // ԤͰʬҪͼƬԴ
-    std::vector<std::string> bucketheadWalkFrames = {
-        "Images/Zombies/Buckethead/walk_01.png",
-        "Images/Zombies/Buckethead/walk_02.png",
-        "Images/Zombies/Buckethead/walk_03.png",
-        "Images/Zombies/Buckethead/walk_04.png",
-        "Images/Zombies/Buckethead/walk_05.png",
-        "Images/Zombies/Buckethead/walk_06.png",
-        "Images/Zombies/Buckethead/walk_07.png",
-        "Images/Zombies/Buckethead/walk_08.png",
-        "Images/Zombies/Buckethead/walk_09.png",
-        "Images/Zombies/Buckethead/walk_10.png",
-        "Images/Zombies/Buckethead/walk_11.png",
-        "Images/Zombies/Buckethead/walk_12.png",
-        "Images/Zombies/Buckethead/walk_13.png",
-        "Images/Zombies/Buckethead/walk_14.png",
-        "Images/Zombies/Buckethead/walk_15.png"
-    };
-    loadAnimationFrames("zombie_buckethead_walk", bucketheadWalkFrames, 0.2f);
-
-    std::vector<std::string> bucketheadAttackFrames = {
-        "Images/Zombies/Buckethead/attack_01.png",
-        "Images/Zombies/Buckethead/attack_02.png",
-        "Images/Zombies/Buckethead/attack_03.png",
-        "Images/Zombies/Buckethead/attack_04.png",
-        "Images/Zombies/Buckethead/attack_05.png",
-        "Images/Zombies/Buckethead/attack_06.png",
-        "Images/Zombies/Buckethead/attack_07.png",
-        "Images/Zombies/Buckethead/attack_08.png",
-        "Images/Zombies/Buckethead/attack_09.png",
-        "Images/Zombies/Buckethead/attack_10.png",
-        "Images/Zombies/Buckethead/attack_11.png"
-    };
-    loadAnimationFrames("zombie_buckethead_attack", bucketheadAttackFrames, 0.3f);
-}
\ No newline at end of file
+    std::vector<const char*> groups;
+    getZombieResourceGroups(type, groups);
+    for (const char* group : groups)
+    {
+        TextureResidency::getInstance()->prefetch(group);
+    }
+}
@@ -1,37 +1,43 @@
-// ResourceLoader.h - 򻯰汾ƳJSON
+// ResourceLoader.h - 资源加载，动画定义来自 Configs/animations.json
 #ifndef RESOURCE_LOADER_H
 #define RESOURCE_LOADER_H
 
 #include "cocos2d.h"
+#include "AnimationManifest.h"
+#include "AssetId.h"
 #include <string>
 #include <map>
 #include <vector>
 
-// ǰ ZombieType^ļ
-enum class ZombieType;  // @
+// 前向聲明 ZombieType（避免包含完整頭文件）
+enum class ZombieType;  // 添加這行
 
 class ResourceLoader : public cocos2d::Ref
 {
 public:
 
-    // AdYԴ
-    void preloadZombieResources();
+    // 某种僵尸出场需要的图集组：acquire同步加载并标记使用，prefetch交给AssetPipeline后台解码
+    void acquireZombieResources(ZombieType type);
+    void prefetchZombieResources(ZombieType type);
 
-    // ƄӮQx
+    // 殭屍動畫名稱（可選）
     std::string getZombieWalkAnimationName(ZombieType type) const;
     std::string getZombieAttackAnimationName(ZombieType type) const;
     std::string getZombieDeathAnimationName(ZombieType type) const;
 
-    // 
+    // 单例访问
     static ResourceLoader* getInstance();
 
-    // ԣӡлĶ
+    // 调试：打印所有缓存的动画
     void printCachedAnimations();
 
-    // 鶯Ƿ
+    // 检查动画是否存在
     bool hasAnimation(const std::string& name);
 
-    // Դ
+    // 清单里该动画是否标记为循环播放
+    bool isAnimationLooping(const std::string& name) const;
+
+    // 资源类型
     enum class ResourceType
     {
         IMAGE,
@@ -41,7 +47,7 @@ public:
         BACKGROUND_MUSIC
     };
 
-    // ؽ׶
+    // 加载阶段
     enum class LoadingPhase
     {
         MENU_RESOURCES,
@@ -49,98 +55,162 @@ public:
         ALL_RESOURCES
     };
 
-    // ԤԴ
+    // 预加载资源
     void preloadResources(LoadingPhase phase);
 
-    // ȡ֡
+    // 路径所属纹理分组（清单的textureGroups）的像素格式，不属于任何分组时为全局默认
+    cocos2d::Texture2D::PixelFormat getPixelFormatForPath(const std::string& path) const;
+
+    // 按纹理分组统计TextureCache里的纹理内存（最后一项为不属于任何分组的"other"）
+    struct TextureMemoryStat
+    {
+        std::string group;
+        int textureCount = 0;
+        size_t bytes = 0;
+    };
+    std::vector<TextureMemoryStat> getTextureMemoryStats() const;
+
+    // 把各分组的纹理内存写到日志
+    void reportTextureMemory() const;
+
+    // 获取精灵帧
     cocos2d::SpriteFrame* getSpriteFrame(const std::string& name);
 
-    // ȡ
+    // 获取动画
     cocos2d::Animation* getAnimation(const std::string& name);
 
-    // ȡPNG֡
+    // 获取PNG序列帧动画
     cocos2d::Animation* getPNGAnimation(const std::string& name);
 
-    // ȡ·
+    // 获取字体路径
     std::string getFontPath(const std::string& fontName);
 
-    // ȡЧ·
+    // 获取音效路径
     std::string getSoundEffectPath(const std::string& soundName);
 
-    // ȡ·
+    // 获取背景音乐路径
     std::string getBackgroundMusicPath(const std::string& musicName);
 
-    // ȡ
+    // 获取纹理
     cocos2d::Texture2D* getTexture(const std::string& textureName);
 
-    // δʹԴ
+    // 清理未使用资源
     void clearUnusedResources();
 
-    // PNG֡
+    // 加载PNG序列帧动画
     void loadAnimationFrames(const std::string& animationName,
         const std::vector<std::string>& framePaths,
         float delayPerFrame = 0.1f);
 
-    // PNG֡
+    // 加载PNG序列帧到纹理缓存
     void loadPNGFramesToTextureCache(const std::vector<std::string>& framePaths);
 
-    // ȡĶ
+    // 获取缓存的动画：热路径用PVZ_ASSET_ID("名字")，按字符串查的先算哈希
     cocos2d::Animation* getCachedAnimation(const std::string& name);
+    cocos2d::Animation* getCachedAnimation(AssetId id) const;
 
-    // 涯
+    // 逻辑名ID对应的路径（如PVZ_ASSET_ID("sound_shoot")），没有时为空串
+    const std::string& getResourcePath(AssetId id) const;
+
+    // 登记过的资源名（日志、调试用），未登记返回"?"
+    const char* getAssetName(AssetId id) const;
+
+    // 缓存动画
     void cacheAnimation(const std::string& name, cocos2d::Animation* animation);
 
-    // ضԴ
+    // 加载动画资源
     void loadAnimations(const std::vector<std::pair<std::string, std::string>>& animations);
 
 private:
     ResourceLoader();
     virtual ~ResourceLoader();
 
-    // ֹ
+    // 禁止拷贝
     ResourceLoader(const ResourceLoader&) = delete;
     ResourceLoader& operator=(const ResourceLoader&) = delete;
 
-    // ʼ
+    // 初始化
     bool init();
 
-    // Դ
+    // 加载资源配置
     void loadResourceConfig();
 
-    // ؼ򻯵ĶãӲ룩
-    void loadSimpleAnimationConfig();
+    // 把菜单/游戏散图和各图集分组登记到TextureResidency
+    void registerResidencyGroups();
+
+    // 加载一组图集（proj.headless的pack_atlases生成，帧名为原PNG路径）的所有页，返回页数；
+    // 分组格式为ETC1且设备支持时优先加载.pkm页
+    int loadAtlasGroup(const char* group);
+
+    // 卸载一组图集：释放该组的动画、图集帧和纹理
+    void unloadAtlasGroup(const char* group);
+
+    // 图集分组的纹理（图集页，没有图集时为该组的散帧）
+    std::vector<std::string> getAtlasGroupTextures(const char* group) const;
 
-    // ͼƬԴ
+    // _resourcePaths中名字对应的路径
+    std::vector<std::string> getImagePaths(const std::vector<std::string>& imageNames) const;
+
+    // 把纹理移出TextureCache
+    void unloadTextures(const std::vector<std::string>& paths);
+
+    // 登记资源名并返回它的ID，名字不同而ID相同时报错
+    AssetId registerAssetName(const std::string& name);
+
+    // 某种僵尸用到的图集组
+    void getZombieResourceGroups(ZombieType type, std::vector<const char*>& groups) const;
+
+    // 该纹理分组是否使用ETC1压缩纹理
+    bool isUsingEtc1(const char* group) const;
+
+    // 读入动画清单（animations.bin，没有时解析animations.json）
+    void loadAnimationManifest();
+
+    // 按分组创建并缓存清单里的动画：inGroup为false时加载除该组以外的全部
+    void loadManifestAnimations(const char* group, bool inGroup);
+    void loadManifestAnimation(const AnimationManifest::Entry& entry);
+
+    // 取一帧：优先图集，否则按散图加载
+    cocos2d::SpriteFrame* loadAnimationFrame(const std::string& framePath);
+
+    // 加载图片资源
     void loadImages(const std::vector<std::string>& imageFiles);
 
-    // ؾ
+    // 加载精灵表
     void loadSpriteSheets(const std::vector<std::pair<std::string, std::string>>& spriteSheets);
 
-    // 
+    // 加载字体
     void loadFonts(const std::vector<std::string>& fontFiles);
 
-    // Ч
+    // 加载音效
     void loadSoundEffects(const std::vector<std::string>& soundFiles);
 
-    // ر
+    // 加载背景音乐
     void loadBackgroundMusic(const std::vector<std::string>& musicFiles);
 
-    // plist·Զ
+    // 根据plist路径自动创建动画并缓存
     void createAndCacheAnimations(const std::string& plistPath);
 
 private:
     static ResourceLoader* _instance;
 
-    // Դ·ӳ
+    // 资源路径映射
     std::map<std::string, std::string> _resourcePaths;
 
-    // Ѽصľ֡
+    // 已加载的精灵帧缓存
     std::map<std::string, cocos2d::SpriteFrame*> _spriteFrames;
 
-    // ѼصĶ
-    std::map<std::string, cocos2d::Animation*> _animations;
+    // 已加载的动画缓存（按名字的AssetId）
+    AssetIdMap<cocos2d::Animation*> _animations;
+
+    // AssetId -> 名字（冲突检查、日志）；逻辑名ID -> 路径
+    AssetIdMap<std::string> _assetNames;
+    AssetIdMap<std::string> _resourcePathIds;
+
+    // 动画清单（名字、帧路径、帧间隔、循环标记）
+    AnimationManifest _animationManifest;
 
-    // Դ״̬
+    // 资源加载状态
     bool _isMenuResourcesLoaded;
     bool _isGameResourcesLoaded;
 };
@@ -0,0 +1,289 @@
+#include "TextureResidency.h"
+#include "AssetPipeline.h"
+#include "./Game/Logger.h"
+#include "./Game/FrameProfiler.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+namespace {
+    // 默认预算：游戏阶段的全部纹理（RGBA4444图集）约5MB，留出新增僵尸种类的余量；内存紧的设备调小
+    const size_t DEFAULT_BUDGET = 16 * 1024 * 1024;
+
+    const char* getPhaseName(ResourceLoader::LoadingPhase phase)
+    {
+        switch (phase)
+        {
+        case ResourceLoader::LoadingPhase::MENU_RESOURCES: return "menu";
+        case ResourceLoader::LoadingPhase::GAME_RESOURCES: return "game";
+        default:                                           return "all";
+        }
+    }
+}
+
+TextureResidency* TextureResidency::_instance = nullptr;
+
+TextureResidency* TextureResidency::getInstance()
+{
+    if (_instance == nullptr)
+    {
+        _instance = new TextureResidency();
+    }
+    return _instance;
+}
+
+TextureResidency::TextureResidency()
+    : _phase(LoadingPhase::MENU_RESOURCES)
+    , _budget(DEFAULT_BUDGET)
+    , _useClock(0)
+    , _evictionCount(0)
+{
+}
+
+void TextureResidency::registerGroup(const std::string& name, LoadingPhase phase, bool pinned,
+    const std::vector<std::string>& textures, const GroupCallback& load, const GroupCallback& unload)
+{
+    Group* group = findGroup(name);
+    if (!group)
+    {
+        _groups.push_back(Group());
+        group = &_groups.back();
+        group->name = name;
+        group->loaded = false;
+        group->lastUse = 0;
+    }
+    group->phase = phase;
+    group->pinned = pinned;
+    group->textures = textures;
+    group->load = load;
+    group->unload = unload;
+}
+
+TextureResidency::Group* TextureResidency::findGroup(const std::string& name)
+{
+    for (auto& group : _groups)
+    {
+        if (group.name == name)
+        {
+            return &group;
+        }
+    }
+    return nullptr;
+}
+
+const TextureResidency::Group* TextureResidency::findGroup(const std::string& name) const
+{
+    return const_cast<TextureResidency*>(this)->findGroup(name);
+}
+
+bool TextureResidency::isPinned(const Group& group) const
+{
+    return group.pinned && (_phase == LoadingPhase::ALL_RESOURCES || group.phase == _phase);
+}
+
+void TextureResidency::enterPhase(LoadingPhase phase)
+{
+    PVZ_PROFILE_ZONE("TextureResidency::enterPhase");
+
+    _phase = phase;
+
+    // 先卸载其他阶段的组（如进入游戏时的菜单图），再加载本阶段的常驻组
+    for (auto& group : _groups)
+    {
+        if (group.loaded && phase != LoadingPhase::ALL_RESOURCES && group.phase != phase)
+        {
+            evictGroup(group);
+        }
+    }
+    for (auto& group : _groups)
+    {
+        if (isPinned(group))
+        {
+            loadGroup(group);
+        }
+    }
+    trim();
+
+    PVZ_LOGI(LogCategory::RESOURCE, "TextureResidency: entered %s phase, %.2f / %.2f MB resident",
+        getPhaseName(phase), getResidentBytes() / (1024.0 * 1024.0), _budget / (1024.0 * 1024.0));
+}
+
+bool TextureResidency::acquire(const std::string& name)
+{
+    Group* group = findGroup(name);
+    if (!group)
+    {
+        PVZ_LOGW(LogCategory::RESOURCE, "TextureResidency: unknown group %s", name.c_str());
+        return false;
+    }
+
+    bool wasLoaded = group->loaded;
+    loadGroup(*group);
+    if (!wasLoaded)
+    {
+        // 新加载的组刚被标记为最近使用，不会被这次淘汰
+        trim();
+    }
+    return true;
+}
+
+void TextureResidency::prefetch(const std::string& name)
+{
+    const Group* group = findGroup(name);
+    if (!group || group->loaded)
+    {
+        return;
+    }
+
+    std::vector<std::string> textures;
+    for (const auto& path : group->textures)
+    {
+        // ETC1页带单独的透明通道纹理，只能由TextureCache同步加载
+        if (FileUtils::getInstance()->getFileExtension(path) == ".pkm")
+        {
+            continue;
+        }
+        textures.push_back(path);
+    }
+    AssetPipeline::getInstance()->enqueueImages(textures);
+    PVZ_LOGD(LogCategory::RESOURCE, "TextureResidency: prefetching %s (%d textures)",
+        name.c_str(), (int)textures.size());
+}
+
+bool TextureResidency::isResident(const std::string& name) const
+{
+    const Group* group = findGroup(name);
+    return group && group->loaded;
+}
+
+void TextureResidency::collectPhaseTextures(LoadingPhase phase, std::vector<std::string>& textures) const
+{
+    auto textureCache = Director::getInstance()->getTextureCache();
+    for (const auto& group : _groups)
+    {
+        if ((group.phase != phase && phase != LoadingPhase::ALL_RESOURCES) || !group.pinned)
+        {
+            continue;
+        }
+        for (const auto& path : group.textures)
+        {
+            if (FileUtils::getInstance()->getFileExtension(path) != ".pkm" && !textureCache->getTextureForKey(path))
+            {
+                textures.push_back(path);
+            }
+        }
+    }
+}
+
+void TextureResidency::setBudget(size_t bytes)
+{
+    _budget = bytes;
+    trim();
+}
+
+size_t TextureResidency::computeGroupBytes(const Group& group) const
+{
+    auto textureCache = Director::getInstance()->getTextureCache();
+    size_t bytes = 0;
+    for (const auto& path : group.textures)
+    {
+        Texture2D* texture = textureCache->getTextureForKey(path);
+        if (texture)
+        {
+            bytes += (size_t)texture->getPixelsWide() * texture->getPixelsHigh() * texture->getBitsPerPixelForFormat() / 8;
+        }
+    }
+    return bytes;
+}
+
+size_t TextureResidency::getResidentBytes() const
+{
+    size_t bytes = 0;
+    for (const auto& group : _groups)
+    {
+        bytes += computeGroupBytes(group);
+    }
+    return bytes;
+}
+
+size_t TextureResidency::getGroupBytes(const std::string& name) const
+{
+    const Group* group = findGroup(name);
+    return group ? computeGroupBytes(*group) : 0;
+}
+
+void TextureResidency::loadGroup(Group& group)
+{
+    group.lastUse = ++_useClock;
+    if (group.loaded)
+    {
+        return;
+    }
+
+    PVZ_PROFILE_ZONE("TextureResidency::loadGroup");
+    if (group.load)
+    {
+        group.load();
+    }
+    group.loaded = true;
+    PVZ_LOGD(LogCategory::RESOURCE, "TextureResidency: loaded %s (%.1f KB)",
+        group.name.c_str(), computeGroupBytes(group) / 1024.0);
+}
+
+void TextureResidency::evictGroup(Group& group)
+{
+    size_t bytes = computeGroupBytes(group);
+    if (group.unload)
+    {
+        group.unload();
+    }
+    group.loaded = false;
+    _evictionCount.set(_evictionCount.get() + 1);
+    PVZ_LOGI(LogCategory::RESOURCE, "TextureResidency: evicted %s (%.1f KB)", group.name.c_str(), bytes / 1024.0);
+}
+
+void TextureResidency::trim()
+{
+    size_t residentBytes = getResidentBytes();
+    while (residentBytes > _budget)
+    {
+        // 最久未使用的可淘汰组；预取了纹理但还没加载的组也算（它的纹理同样占显存）
+        Group* victim = nullptr;
+        size_t victimBytes = 0;
+        for (auto& group : _groups)
+        {
+            if (isPinned(group) || (victim && group.lastUse >= victim->lastUse))
+            {
+                continue;
+            }
+            size_t bytes = computeGroupBytes(group);
+            if (bytes > 0 || group.loaded)
+            {
+                victim = &group;
+                victimBytes = bytes;
+            }
+        }
+        if (!victim)
+        {
+            PVZ_LOGW(LogCategory::RESOURCE, "TextureResidency: %.2f MB pinned exceeds budget %.2f MB",
+                residentBytes / (1024.0 * 1024.0), _budget / (1024.0 * 1024.0));
+            break;
+        }
+
+        evictGroup(*victim);
+        residentBytes -= victimBytes;
+    }
+}
+
+void TextureResidency::logStats() const
+{
+    PVZ_LOGI(LogCategory::RESOURCE, "TextureResidency: phase %s, %.2f / %.2f MB, %d evictions",
+        getPhaseName(_phase), getResidentBytes() / (1024.0 * 1024.0), _budget / (1024.0 * 1024.0), _evictionCount.get());
+    for (const auto& group : _groups)
+    {
+        PVZ_LOGI(LogCategory::RESOURCE, "  %-18s %-4s %-8s %8.1f KB  last use %u",
+            group.name.c_str(), getPhaseName(group.phase),
+            isPinned(group) ? "pinned" : (group.loaded ? "loaded" : "-"),
+            computeGroupBytes(group) / 1024.0, group.lastUse);
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#ifndef __TEXTURE_RESIDENCY_H__
+#define __TEXTURE_RESIDENCY_H__
+
+#include "cocos2d.h"
+#include "ResourceLoader.h"
+#include "Game/Observable.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+// TextureResidency - 纹理驻留管理
+// 资源按组登记（菜单散图、游戏散图、每个图集分组，僵尸每种一组），每组记录所属加载阶段和纹理路径。
+// 切换阶段时卸载其他阶段的组、加载本阶段的常驻组；本阶段按需加载的组（僵尸图集）在驻留纹理超出预算时
+// 按最近最少使用淘汰，可以在需要前预取（交给AssetPipeline后台解码）。
+// 组的加载/卸载由登记时的回调完成（ResourceLoader负责解析图集、建动画、释放缓存），这里只管什么时候做。
+// 卸载只是把纹理移出TextureCache，仍被精灵/动画引用的纹理要等引用释放后才真正回收显存。
+class TextureResidency
+{
+public:
+    typedef ResourceLoader::LoadingPhase LoadingPhase;
+    typedef std::function<void()> GroupCallback;
+
+    static TextureResidency* getInstance();
+
+    // 登记资源组；pinned为true时在所属阶段内常驻，否则按需acquire，超预算时可被淘汰
+    void registerGroup(const std::string& name, LoadingPhase phase, bool pinned,
+        const std::vector<std::string>& textures, const GroupCallback& load, const GroupCallback& unload);
+
+    // 进入阶段：卸载其他阶段的组，加载本阶段的常驻组，然后按预算淘汰
+    void enterPhase(LoadingPhase phase);
+    LoadingPhase getPhase() const { return _phase; }
+
+    // 确保组已加载（同步）并标记为最近使用；未登记的组返回false
+    bool acquire(const std::string& name);
+
+    // 提前把组的纹理交给AssetPipeline后台解码上传，之后acquire时直接命中缓存
+    void prefetch(const std::string& name);
+
+    bool isResident(const std::string& name) const;
+
+    // 某阶段常驻组里还不在TextureCache中的纹理（LoadingScene交给AssetPipeline解码；按需加载的组等出场前再预取）
+    void collectPhaseTextures(LoadingPhase phase, std::vector<std::string>& textures) const;
+
+    // 驻留纹理预算（字节）；常驻组不会被淘汰，超出部分只能从按需加载的组里腾出
+    void setBudget(size_t bytes);
+    size_t getBudget() const { return _budget; }
+
+    // 已登记组在TextureCache里的纹理字节数（宽 x 高 x 每像素位数）
+    size_t getResidentBytes() const;
+    size_t getGroupBytes(const std::string& name) const;
+    int getEvictionCount() const { return _evictionCount.get(); }
+    // 每淘汰/卸载一组加一（精灵仍可能引用被移出缓存的纹理，EntityLayers据此重建纹理序号）
+    Observable<int>& getEvictionObservable() { return _evictionCount; }
+
+    // 超出预算时按最近最少使用淘汰可淘汰的组，直到回到预算内或没有可淘汰的组
+    void trim();
+
+    // 把各组状态写到日志
+    void logStats() const;
+
+private:
+    TextureResidency();
+
+    TextureResidency(const TextureResidency&) = delete;
+    TextureResidency& operator=(const TextureResidency&) = delete;
+
+    struct Group
+    {
+        std::string name;
+        LoadingPhase phase;
+        bool pinned;                        // 所属阶段内常驻
+        std::vector<std::string> textures;  // 组内纹理（图集页或散图），用于统计和预取
+        GroupCallback load;
+        GroupCallback unload;
+        bool loaded;
+        unsigned int lastUse;               // 最近一次acquire的序号
+    };
+
+    Group* findGroup(const std::string& name);
+    const Group* findGroup(const std::string& name) const;
+    size_t computeGroupBytes(const Group& group) const;
+    bool isPinned(const Group& group) const;
+    void loadGroup(Group& group);
+    void evictGroup(Group& group);
+
+    static TextureResidency* _instance;
+
+    std::vector<Group> _groups;
+    LoadingPhase _phase;
+    size_t _budget;
+    unsigned int _useClock;
+    Observable<int> _evictionCount;
+};
+
+#endif // __TEXTURE_RESIDENCY_H__
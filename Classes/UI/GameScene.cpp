@@ -9,11 +9,11 @@ Scene* GameScene::createScene() {
 bool GameScene::init() {
     if (!Scene::init()) return false;
 
-    // ʼι
+    // 初始化波次管理器
     _waveManager = WaveManager::create();
     if (_waveManager) {
         this->addChild(_waveManager);
-        _waveManager->startWaves(); // ʼɽʬ
+        _waveManager->startWaves(); // 开始生成僵尸波
     }
 
     return true;
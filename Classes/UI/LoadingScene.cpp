@@ -0,0 +1,108 @@
+#include "LoadingScene.h"
+#include "./Game/GameManager.h"
+#include "./Resources/AssetPipeline.h"
+#include "./Resources/ResourceLoader.h"
+#include "./Resources/TextureResidency.h"
+#include "./Game/Logger.h"
+
+USING_NS_CC;
+
+namespace {
+    const float BAR_WIDTH = 400.0f;
+    const float BAR_HEIGHT = 20.0f;
+}
+
+Scene* LoadingScene::createScene()
+{
+    return LoadingScene::create();
+}
+
+bool LoadingScene::init()
+{
+    if (!Scene::init())
+    {
+        return false;
+    }
+
+    _progressBar = nullptr;
+    _progressLabel = nullptr;
+    _finished = false;
+
+    initUI();
+
+    // 游戏阶段常驻组（散图、常驻图集页）的纹理交给后台线程解码；僵尸图集由WaveManager在出场前预取
+    std::vector<std::string> images;
+    TextureResidency::getInstance()->collectPhaseTextures(ResourceLoader::LoadingPhase::GAME_RESOURCES, images);
+    AssetPipeline::getInstance()->enqueueImages(images);
+    PVZ_LOGI(LogCategory::RESOURCE, "LoadingScene: %d images requested, %d queued",
+        (int)images.size(), AssetPipeline::getInstance()->getTotalCount());
+
+    return true;
+}
+
+void LoadingScene::onEnterTransitionDidFinish()
+{
+    Scene::onEnterTransitionDidFinish();
+
+    // 解码在过渡期间已经开始，这里只开始轮询进度
+    this->scheduleUpdate();
+}
+
+void LoadingScene::initUI()
+{
+    auto visibleSize = Director::getInstance()->getVisibleSize();
+    Vec2 origin = Director::getInstance()->getVisibleOrigin();
+
+    // 背景沿用菜单背景（已在菜单阶段加载）
+    auto background = Sprite::create("Images/Backgrounds/menu_bg.png");
+    if (background)
+    {
+        background->setPosition(Vec2(visibleSize.width / 2 + origin.x, visibleSize.height / 2 + origin.y));
+        background->setScale(visibleSize.width / background->getContentSize().width,
+            visibleSize.height / background->getContentSize().height);
+        this->addChild(background, 0);
+    }
+
+    _barRect = Rect(origin.x + (visibleSize.width - BAR_WIDTH) / 2, origin.y + visibleSize.height * 0.2f,
+        BAR_WIDTH, BAR_HEIGHT);
+
+    _progressBar = DrawNode::create();
+    this->addChild(_progressBar, 1);
+
+    _progressLabel = Label::createWithTTF("Loading... 0%", "fonts/Marker Felt.ttf", 24);
+    _progressLabel->setPosition(Vec2(_barRect.getMidX(), _barRect.getMaxY() + 24));
+    this->addChild(_progressLabel, 1);
+
+    updateProgressBar(0.0f);
+}
+
+void LoadingScene::updateProgressBar(float progress)
+{
+    _progressBar->clear();
+    _progressBar->drawSolidRect(_barRect.origin, Vec2(_barRect.getMaxX(), _barRect.getMaxY()),
+        Color4F(0.0f, 0.0f, 0.0f, 0.6f));
+    _progressBar->drawSolidRect(_barRect.origin,
+        Vec2(_barRect.getMinX() + _barRect.size.width * progress, _barRect.getMaxY()),
+        Color4F(0.4f, 0.8f, 0.2f, 1.0f));
+
+    _progressLabel->setString(StringUtils::format("Loading... %d%%", (int)(progress * 100)));
+}
+
+void LoadingScene::update(float delta)
+{
+    if (_finished)
+    {
+        return;
+    }
+
+    auto pipeline = AssetPipeline::getInstance();
+    updateProgressBar(pipeline->getProgress());
+
+    if (pipeline->isIdle())
+    {
+        _finished = true;
+        PVZ_LOGI(LogCategory::RESOURCE, "LoadingScene: %d images ready", pipeline->getCompletedCount());
+        ResourceLoader::getInstance()->reportTextureMemory();
+        GameManager::getInstance()->goToGameScene();
+    }
+}
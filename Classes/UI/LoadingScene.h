@@ -0,0 +1,40 @@
+#ifndef LOADING_SCENE_H
+#define LOADING_SCENE_H
+
+#include "cocos2d.h"
+
+// 加载场景：菜单进入游戏之间显示进度条
+// 把游戏场景要用的图片交给AssetPipeline在后台解码、分帧上传，全部完成后切到GameScene，
+// GameScene初始化时这些纹理已在缓存里，不再同步解码。
+class LoadingScene : public cocos2d::Scene
+{
+public:
+    // 创建场景的静态方法
+    static cocos2d::Scene* createScene();
+
+    // 初始化
+    virtual bool init() override;
+
+    // 过渡动画结束后才开始检查进度（避免过渡中再次切换场景）
+    virtual void onEnterTransitionDidFinish() override;
+
+    // 更新进度，加载完成后切换场景
+    void update(float delta) override;
+
+    // 创建方法
+    CREATE_FUNC(LoadingScene);
+
+private:
+    // 初始化UI
+    void initUI();
+
+    // 按进度重画进度条
+    void updateProgressBar(float progress);
+
+    cocos2d::DrawNode* _progressBar;
+    cocos2d::Label* _progressLabel;
+    cocos2d::Rect _barRect;
+    bool _finished;
+};
+
+#endif // LOADING_SCENE_H
@@ -2,6 +2,7 @@
 #include "./Game/GameManager.h"
 #include "./Resources/AudioManager.h"
 #include "./Resources/ResourceLoader.h"
+#include "./Game/Logger.h"
 
 USING_NS_CC;
 using namespace ui;
@@ -31,9 +32,7 @@ bool MenuScene::init()
     // 初始化UI
     initUI();
 /*
-    AudioManager::getInstance()->playSoundEffect(
-        ResourceLoader::getInstance()->getSoundEffectPath("sound_menu_bgm")
-    );
+    AudioManager::getInstance()->playSoundEffect(PVZ_ASSET_ID("sound_menu_bgm"));
  */
     
     // 播放背景音乐
@@ -143,9 +142,7 @@ void MenuScene::onStartButtonClicked(Ref* sender, Widget::TouchEventType type)
     if (type == Widget::TouchEventType::ENDED)
     {
         // 播放按钮点击音效
-        AudioManager::getInstance()->playSoundEffect(
-            ResourceLoader::getInstance()->getSoundEffectPath("sound_button_click")
-        );
+        AudioManager::getInstance()->playSoundEffect(PVZ_ASSET_ID("sound_button_click"));
 
         // 播放按钮动画
         playButtonAnimation(static_cast<Button*>(sender));
@@ -166,9 +163,7 @@ void MenuScene::onSettingsButtonClicked(Ref* sender, Widget::TouchEventType type
     if (type == Widget::TouchEventType::ENDED)
     {
         // 播放按钮点击音效
-        AudioManager::getInstance()->playSoundEffect(
-            ResourceLoader::getInstance()->getSoundEffectPath("sound_button_click")
-        );
+        AudioManager::getInstance()->playSoundEffect(PVZ_ASSET_ID("sound_button_click"));
 
         // 播放按钮动画
         playButtonAnimation(static_cast<Button*>(sender));
@@ -180,7 +175,7 @@ void MenuScene::onSettingsButtonClicked(Ref* sender, Widget::TouchEventType type
             _settingsLayer->show();
         }
 
-        log("Settings button clicked - 显示设置界面");
+        PVZ_LOGD(LogCategory::UI, "Settings button clicked - 显示设置界面");
         */
     }
 }
@@ -190,9 +185,7 @@ void MenuScene::onExitButtonClicked(Ref* sender, Widget::TouchEventType type)
     if (type == Widget::TouchEventType::ENDED)
     {
         // 播放按钮点击音效
-        AudioManager::getInstance()->playSoundEffect(
-            ResourceLoader::getInstance()->getSoundEffectPath("sound_button_click")
-        );
+        AudioManager::getInstance()->playSoundEffect(PVZ_ASSET_ID("sound_button_click"));
 
         // 播放按钮动画
         playButtonAnimation(static_cast<Button*>(sender));
@@ -7,20 +7,20 @@
 class MenuScene : public cocos2d::Scene
 {
 public:
-    // ľ̬
+    // 创建场景的静态方法
     static cocos2d::Scene* createScene();
 
-    // ʼ
+    // 初始化
     virtual bool init() override;
 
-    // º
+    // 更新函数
     void update(float delta) override;
 
-    // 
+    // 创建方法
     CREATE_FUNC(MenuScene);
 
 private:
-    // UIԪ
+    // UI元素
     cocos2d::ui::Button* _startButton;
     cocos2d::ui::Button* _settingsButton;
     cocos2d::ui::Button* _exitButton;
@@ -28,18 +28,18 @@ private:
     cocos2d::Sprite* _background;
     cocos2d::Sprite* _logo;
 
-    // ʼUI
+    // 初始化UI
     void initUI();
 
-    // ťص
+    // 按钮回调
     void onStartButtonClicked(cocos2d::Ref* sender, cocos2d::ui::Widget::TouchEventType type);
     void onSettingsButtonClicked(cocos2d::Ref* sender, cocos2d::ui::Widget::TouchEventType type);
     void onExitButtonClicked(cocos2d::Ref* sender, cocos2d::ui::Widget::TouchEventType type);
 
-    // Ч
+    // 动画效果
     void playButtonAnimation(cocos2d::ui::Button* button);
 
-    // Դ
+    // 资源加载
     void preloadResources();
 };
 
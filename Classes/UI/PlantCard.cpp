@@ -2,6 +2,7 @@
 #include "./Entities/Plants/PlantFactory.h"
 #include <Resources/AudioManager.h>
 #include "Resources/ResourceLoader.h"
+#include "./Game/Logger.h"
 
 USING_NS_CC;
 
@@ -29,34 +30,34 @@ bool PlantCard::init(PlantType plantType)
     _cooldown = PlantFactory::getCooldown(plantType);
     _cooldownTimer = 0.0f;
     _isAvailable = false;
-    _isCoolingDown = false;
+    _coolingDown.set(false);
 
-    // ÿƴС
+    // 设置卡牌大小
     this->setContentSize(Size(60, 80));
     this->setScale9Enabled(true);
     this->setCapInsets(Rect(10, 10, 50, 70));
 
-    // ÿƱɫֲͣ
+    // 设置卡牌背景颜色（根据植物类型）
     Color3B cardColor;
     switch (plantType) {
     case PlantType::SUNFLOWER:
-        cardColor = Color3B(255, 255, 0); // ɫ
+        cardColor = Color3B(255, 255, 0); // 黄色
         break;
     case PlantType::PEASHOOTER:
-        cardColor = Color3B(0, 200, 0); // ɫ
+        cardColor = Color3B(0, 200, 0); // 绿色
         break;
     case PlantType::WALLNUT:
-        cardColor = Color3B(139, 69, 19); // ɫ
+        cardColor = Color3B(139, 69, 19); // 棕色
         break;
     default:
-        cardColor = Color3B(200, 200, 200); // ɫ
+        cardColor = Color3B(200, 200, 200); // 灰色
         break;
     }
 
     this->setColor(cardColor);
     this->setOpacity(200);
 
-    // ֲƱǩ
+    // 添加植物名称标签
     int plantPrice = PlantFactory::getSunCost(plantType);
     auto nameLabel = Label::createWithTTF(StringUtils::toString(plantPrice), "fonts/Marker Felt.ttf", 20);
     nameLabel->setPosition(Vec2(this->getContentSize().width / 2, 15));
@@ -65,7 +66,7 @@ bool PlantCard::init(PlantType plantType)
     this->addChild(nameLabel);
 
     /*
-    // ıǩ
+    // 添加阳光消耗标签
     _sunCostLabel = Label::createWithTTF(StringUtils::toString(_sunCost),
         "fonts/Marker Felt.ttf", 18);
     _sunCostLabel->setPosition(Vec2(this->getContentSize().width / 2, 20));
@@ -74,10 +75,10 @@ bool PlantCard::init(PlantType plantType)
     this->addChild(_sunCostLabel);
     */
 
-    // ʹԴֲһͼƬΪƱ
+    // 使用资源加载器加载植物第一张图片作为卡牌背景
     auto resourceLoader = ResourceLoader::getInstance();
 
-    // ֲͻȡӦĵһͼƬ
+    // 根据植物类型获取对应的第一张图片
     std::string imagePath;
 
     switch (this->getPlantType()) {
@@ -103,34 +104,42 @@ bool PlantCard::init(PlantType plantType)
         imagePath = "Images/UI/card_default.png";
     }
 
-    // ԤͼƬ
-    resourceLoader->loadPNGFramesToTextureCache({ imagePath });
-
-    // ֲͼƬΪƱ
-    auto plantSprite = Sprite::create(imagePath);
+    // 创建植物图片精灵作为卡牌背景（优先用图集帧，和场上的植物共用纹理）
+    Sprite* plantSprite = nullptr;
+    auto atlasFrame = SpriteFrameCache::getInstance()->getSpriteFrameByName(imagePath);
+    if (atlasFrame)
+    {
+        plantSprite = Sprite::createWithSpriteFrame(atlasFrame);
+    }
+    else
+    {
+        // 预加载图片
+        resourceLoader->loadPNGFramesToTextureCache({ imagePath });
+        plantSprite = Sprite::create(imagePath);
+    }
     if (plantSprite) {
-        // СӦ
+        // 调整大小以适应卡牌
         plantSprite->setScale(0.8f);
         plantSprite->setPosition(this->getContentSize().width / 2,
             this->getContentSize().height / 2 + 10);
-        plantSprite->setOpacity(200); // ͸
-        this->addChild(plantSprite, -1); // ײΪ
+        plantSprite->setOpacity(200); // 半透明
+        this->addChild(plantSprite, -1); // 放在最底层作为背景
     }
 
     /*
-    // ͼ
+    // 添加阳光图标
     auto sunIcon = Sprite::create();
     sunIcon->setTextureRect(Rect(0, 0, 20, 20));
     sunIcon->setColor(Color3B(255, 255, 0));
     sunIcon->setPosition(Vec2(this->getContentSize().width / 2, 45));
     this->addChild(sunIcon);
 
-    // ͼ궯
+    // 添加阳光图标动画
     auto rotateAction = RepeatForever::create(RotateBy::create(2.0f, 360));
     sunIcon->runAction(rotateAction);
     */
 
-    // ʼȴ
+    // 初始化冷却遮罩
     _cooldownOverlay = DrawNode::create();
     _cooldownOverlay->drawSolidRect(
         Vec2::ZERO,
@@ -140,34 +149,34 @@ bool PlantCard::init(PlantType plantType)
     _cooldownOverlay->setVisible(false);
     this->addChild(_cooldownOverlay, 1);
 
-    // óʼ״̬
+    // 设置初始状态
     updateCardState(0);
 
-    // ô¼
+    // 设置触摸事件
     this->addTouchEventListener([this](Ref* sender, ui::Widget::TouchEventType type) {
         if (type == ui::Widget::TouchEventType::ENDED)
         {
-            if (_isAvailable && !_isCoolingDown)
+            if (_isAvailable && !isCoolingDown())
             {
-                // ѡЧ
+                // 播放选择音效
                 auto audioManager = AudioManager::getInstance();
                 if (audioManager)
                 {
-                    audioManager->playSoundEffect("Sounds/SFX/seed_select.mp3");
+                    audioManager->playSoundEffect(PVZ_ASSET_ID("sound_seed_select"));
                 }
 
-                log("PlantCard: Selected %s", PlantFactory::getPlantName(_plantType).c_str());
+                PVZ_LOGD(LogCategory::UI, "PlantCard: Selected %s", PlantFactory::getPlantName(_plantType).c_str());
             }
             else
             {
-                // ŲЧ
+                // 播放不可用音效
                 auto audioManager = AudioManager::getInstance();
                 if (audioManager)
                 {
-                    audioManager->playSoundEffect("Sounds/SFX/seed_unavailable.mp3");
+                    audioManager->playSoundEffect(PVZ_ASSET_ID("sound_seed_unavailable"));
                 }
 
-                log("PlantCard: Card unavailable or cooling down");
+                PVZ_LOGD(LogCategory::UI, "PlantCard: Card unavailable or cooling down");
             }
         }
         });
@@ -178,62 +187,49 @@ bool PlantCard::init(PlantType plantType)
 void PlantCard::updateCardState(int currentSun)
 {
     bool canAfford = (currentSun >= _sunCost);
+    _isAvailable = canAfford && !isCoolingDown();
 
-    if (canAfford && !_isCoolingDown)
+    if (_cooldownOverlay->isVisible() != isCoolingDown())
     {
-        _isAvailable = true;
-        this->setOpacity(255); // ȫʾ
-        //_sunCostLabel->setColor(Color3B::BLACK);
+        _cooldownOverlay->setVisible(isCoolingDown());
+        _cooldownOverlay->setScaleY(1.0f);
     }
-    else
+
+    // 只在可用状态切换时改透明度（阳光变化但没跨过价格时不动，避免重复设置颜色）
+    GLubyte opacity = _isAvailable ? 255 : 150; // 完全显示 / 半透明
+    if (this->getOpacity() != opacity)
     {
-        _isAvailable = false;
-        this->setOpacity(150); // ͸
-        //_sunCostLabel->setColor(Color3B::GRAY);
+        this->setOpacity(opacity);
+        //_sunCostLabel->setColor(_isAvailable ? Color3B::BLACK : Color3B::GRAY);
     }
 }
 
 void PlantCard::startCooldown()
 {
-    if (_isCoolingDown)
+    if (isCoolingDown())
     {
         return;
     }
 
-    _isCoolingDown = true;
+    // 冷却效果和透明度由订阅者调用updateCardState刷新
     _cooldownTimer = _cooldown;
-    _isAvailable = false;
-
-    // ʾȴЧ
-    _cooldownOverlay->setVisible(true);
-
-    this->setOpacity(150);
-    //_sunCostLabel->setColor(Color3B::GRAY);
-
-    // ʼȴʱ
-    this->schedule(CC_SCHEDULE_SELECTOR(PlantCard::updateCoolingDown), 0.1f);
+    _coolingDown.set(true);
 
-    log("PlantCard: Started cooldown for %s (%.1f seconds)",
+    PVZ_LOGD(LogCategory::UI, "PlantCard: Started cooldown for %s (%.1f seconds)",
         PlantFactory::getPlantName(_plantType).c_str(), _cooldown);
 }
 
 void PlantCard::resetCooldown()
 {
-    _isCoolingDown = false;
     _cooldownTimer = 0.0f;
+    _coolingDown.set(false);
 
-    // ȴЧ
-    _cooldownOverlay->setVisible(false);
-
-    // ֹͣʱ
-    this->unschedule(CC_SCHEDULE_SELECTOR(PlantCard::updateCoolingDown));
-
-    log("PlantCard: Cooldown reset for %s", PlantFactory::getPlantName(_plantType).c_str());
+    PVZ_LOGD(LogCategory::UI, "PlantCard: Cooldown reset for %s", PlantFactory::getPlantName(_plantType).c_str());
 }
 
-void PlantCard::updateCoolingDown(float delta)
+void PlantCard::updateCooldown(float delta)
 {
-    if (!_isCoolingDown)
+    if (!isCoolingDown())
     {
         return;
     }
@@ -241,23 +237,20 @@ void PlantCard::updateCoolingDown(float delta)
     _cooldownTimer -= delta;
     _cooldownOverlay->setScaleY(_cooldownTimer / _cooldown);
 
-    // ʾʣʱ
+    // 显示剩余时间
     if (_cooldownTimer <= 0.0f)
     {
-        // ȴ
-        _isCoolingDown = false;
-        _cooldownOverlay->setVisible(false);
+        // 冷却完成（阳光数量不变时也会通知订阅者刷新卡牌）
+        _cooldownTimer = 0.0f;
+        _coolingDown.set(false);
 
-        // ȴЧ
+        // 播放冷却完成音效
         auto audioManager = AudioManager::getInstance();
         if (audioManager)
         {
-            audioManager->playSoundEffect("Sounds/SFX/seed_ready.mp3");
+            audioManager->playSoundEffect(PVZ_ASSET_ID("sound_seed_ready"));
         }
 
-        // ֹͣʱ
-        this->unschedule(CC_SCHEDULE_SELECTOR(PlantCard::updateCoolingDown));
-
-        log("PlantCard: Cooldown finished for %s", PlantFactory::getPlantName(_plantType).c_str());
+        PVZ_LOGD(LogCategory::UI, "PlantCard: Cooldown finished for %s", PlantFactory::getPlantName(_plantType).c_str());
     }
 }
\ No newline at end of file
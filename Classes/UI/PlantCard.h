@@ -4,53 +4,57 @@
 #include "cocos2d.h"
 #include "ui/CocosGUI.h"
 #include "Entities/Plants/Plant.h"
+#include "Game/Observable.h"
 
 class PlantCard : public cocos2d::ui::Button {
 public:
-    // ֲ￨
+    // 创建植物卡牌
     static PlantCard* create(PlantType plantType);
 
-    // ʼ
+    // 初始化
     virtual bool init(PlantType plantType);
 
-    // ״̬
+    // 更新状态（阳光数量或冷却状态变化时由场景调用；只在可用状态切换时改外观）
     void updateCardState(int currentSun);
 
-    // ȡֲ
+    // 获取植物类型
     PlantType getPlantType() const { return _plantType; }
 
-    // ȡ
+    // 获取阳光消耗
     int getSunCost() const { return _sunCost; }
 
-    // ȡȴʱ
+    // 获取冷却时间
     float getCooldown() const { return _cooldown; }
 
-    // Ƿ
+    // 检查是否可用
     bool isAvailable() const { return _isAvailable; }
 
-    // Ƿȴ
-    bool isCoolingDown() const { return _isCoolingDown; }
+    // 检查是否冷却中
+    bool isCoolingDown() const { return _coolingDown.get(); }
 
-    // ʼȴ
+    // 冷却开始/结束的通知（HUD订阅后刷新卡牌外观，与阳光数量的订阅方式相同）
+    Observable<bool>& getCooldownObservable() { return _coolingDown; }
+
+    // 开始冷却
     void startCooldown();
 
-    // ȴ
+    // 重置冷却
     void resetCooldown();
 
+    // 推进冷却（由GameScene每个逻辑步调用，倍速时同步加快，暂停时停止）
+    void updateCooldown(float delta);
+
 private:
     PlantType _plantType;
     int _sunCost;
     float _cooldown;
     float _cooldownTimer;
     bool _isAvailable;
-    bool _isCoolingDown;
+    Observable<bool> _coolingDown;
 
-    // UIԪ
+    // UI元素
     cocos2d::Label* _sunCostLabel;
     cocos2d::DrawNode* _cooldownOverlay;
-
-    // ȴ
-    void updateCoolingDown(float delta);
 };
 
 #endif // __PLANT_CARD_H__
\ No newline at end of file
@@ -21,20 +21,20 @@ private:
     cocos2d::LayerColor* _background;
     cocos2d::ui::Button* _closeButton;
 
-    // 
+    // 音量控制
     cocos2d::ui::Slider* _bgmSlider;
     cocos2d::ui::Slider* _sfxSlider;
     cocos2d::Label* _bgmLabel;
     cocos2d::Label* _sfxLabel;
     cocos2d::ui::CheckBox* _muteCheckBox;
 
-    // ǰֵʾ
+    // 当前音量值显示
     cocos2d::Label* _bgmValueLabel;
     cocos2d::Label* _sfxValueLabel;
 
-    // ¼
+    // 触摸事件监听器
     cocos2d::EventListenerTouchOneByOne* _touchListener;
-    bool _isListenerAdded;  // ǼǷ
+    bool _isListenerAdded;  // 标记监听器是否已添加
 
     void initUI();
     void onCloseButtonClicked(cocos2d::Ref* sender, cocos2d::ui::Widget::TouchEventType type);
@@ -43,10 +43,10 @@ private:
     void onMuteCheckBoxChanged(cocos2d::Ref* sender, cocos2d::ui::CheckBox::EventType type);
     void updateVolumeLabels();
 
-    // Ч
+    // 滑动条渐变效果
     void showSliderChangeEffect(cocos2d::Node* target, float fromScale, float toScale);
 
-    // /Ƴ
+    // 添加/移除触摸监听器
     void addTouchListener();
     void removeTouchListener();
 };
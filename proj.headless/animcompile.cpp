@@ -0,0 +1,121 @@
+// 动画清单编译器
+// 把Resources/Configs/animations.json编译成运行时直接读入的二进制索引animations.bin
+// （驻留的字符串表 + 帧区间 + 帧间隔 + 纹理分组格式），启动时不再解析JSON。
+// 给出--resources时顺带检查每一帧的文件是否存在（只警告，不影响输出）。
+// 用法: pvz_animc <animations.json> <animations.bin> [--resources DIR]
+
+#include "Resources/AnimationManifest.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool readFile(const char* path, std::string& out)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    char buffer[8192];
+    size_t count = 0;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        out.append(buffer, count);
+    }
+    fclose(file);
+    return true;
+}
+
+bool fileExists(const std::string& path)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file) {
+        fclose(file);
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* inputPath = nullptr;
+    const char* outputPath = nullptr;
+    std::string resourcesDir;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--resources") == 0 && i + 1 < argc) {
+            resourcesDir = argv[++i];
+        } else if (!inputPath) {
+            inputPath = argv[i];
+        } else if (!outputPath) {
+            outputPath = argv[i];
+        } else {
+            inputPath = nullptr;
+            break;
+        }
+    }
+    if (!inputPath || !outputPath) {
+        fprintf(stderr, "usage: pvz_animc <animations.json> <animations.bin> [--resources DIR]\n");
+        return 1;
+    }
+
+    std::string text;
+    if (!readFile(inputPath, text)) {
+        fprintf(stderr, "cannot open %s\n", inputPath);
+        return 1;
+    }
+
+    AnimationManifest manifest;
+    std::string error;
+    if (!manifest.loadJson(text.data(), text.size(), &error)) {
+        fprintf(stderr, "%s: %s\n", inputPath, error.c_str());
+        return 1;
+    }
+
+    int missing = 0;
+    if (!resourcesDir.empty()) {
+        for (int i = 0; i < manifest.getAnimationCount(); i++) {
+            const AnimationManifest::Entry& entry = manifest.getAnimation(i);
+            for (int f = 0; f < entry.frameCount; f++) {
+                const char* frame = manifest.getFrame(entry, f);
+                if (!fileExists(resourcesDir + "/" + frame)) {
+                    fprintf(stderr, "warning: %s: missing frame %s\n", manifest.getName(entry), frame);
+                    missing++;
+                }
+            }
+        }
+    }
+
+    std::vector<uint8_t> binary = manifest.toBinary();
+    FILE* file = fopen(outputPath, "wb");
+    if (!file || fwrite(binary.data(), 1, binary.size(), file) != binary.size()) {
+        fprintf(stderr, "cannot write %s\n", outputPath);
+        if (file) {
+            fclose(file);
+        }
+        return 1;
+    }
+    fclose(file);
+
+    // 回读一遍，保证运行时的加载路径能接受这个文件
+    AnimationManifest check;
+    if (!check.loadBinary(binary.data(), binary.size()) || check.getAnimationCount() != manifest.getAnimationCount()) {
+        fprintf(stderr, "%s: round-trip check failed\n", outputPath);
+        return 1;
+    }
+
+    for (int i = 0; i < manifest.getTextureGroupCount(); i++) {
+        const AnimationManifest::TextureGroup& group = manifest.getTextureGroup(i);
+        printf("texture group %-12s %-8s %d path prefixes\n", manifest.getName(group),
+            AnimationManifest::getPixelFormatName((AnimationManifest::PixelFormat)group.pixelFormat), group.prefixCount);
+    }
+
+    printf("%s: %d animations, %d frames, %zu bytes of strings -> %zu bytes (json %zu bytes)%s\n",
+        outputPath, manifest.getAnimationCount(), manifest.getTotalFrameCount(),
+        manifest.getStringTableSize(), binary.size(), text.size(),
+        missing ? ", some frames missing" : "");
+    return 0;
+}
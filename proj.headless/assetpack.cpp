@@ -0,0 +1,145 @@
+// 资源打包工具
+// 把资源根目录下的所有文件（图片、声音、字体、配置）写进一个资源包，运行时由PackFileUtils整体内存映射，
+// 启动时不再逐个文件查找、打开。包内路径相对资源根目录，与游戏里FileUtils用的路径一致。
+// 写完后重新映射一遍，逐个比对内容。
+// 用法: pvz_assetpack <资源根目录> <输出文件> [--exclude <扩展名或目录>]...
+//   pvz_assetpack ../Resources ../Resources/assets.pak --exclude .json
+
+#include "Resources/AssetPack.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool endsWith(const std::string& text, const std::string& suffix)
+{
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+bool isDirectory(const std::string& path)
+{
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+// 排除项以'.'开头按扩展名匹配，否则按目录（相对资源根目录）匹配
+bool isExcluded(const std::string& path, const std::vector<std::string>& excludes)
+{
+    for (const auto& exclude : excludes) {
+        if (exclude[0] == '.' ? endsWith(path, exclude) : path.compare(0, exclude.size() + 1, exclude + "/") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void collectFiles(const std::string& root, const std::string& relative,
+    const std::vector<std::string>& excludes, std::vector<std::string>& out)
+{
+    std::string directory = relative.empty() ? root : root + "/" + relative;
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+        fprintf(stderr, "cannot open directory %s\n", directory.c_str());
+        return;
+    }
+
+    std::vector<std::string> entries;
+    while (dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            entries.push_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end());
+
+    for (const auto& entry : entries) {
+        std::string path = relative.empty() ? entry : relative + "/" + entry;
+        if (isExcluded(path, excludes)) {
+            continue;
+        }
+        if (isDirectory(root + "/" + path)) {
+            collectFiles(root, path, excludes, out);
+        } else {
+            out.push_back(path);
+        }
+    }
+}
+
+bool sameContents(const std::string& path, const AssetPack::View& view)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    std::vector<uint8_t> data(view.size + 1);
+    size_t count = fread(data.data(), 1, data.size(), file);
+    fclose(file);
+    return count == view.size && memcmp(data.data(), view.data, view.size) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* rootPath = nullptr;
+    const char* outputPath = nullptr;
+    // 资源包本身不打进去
+    std::vector<std::string> excludes = { ".pak" };
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--exclude") == 0 && i + 1 < argc) {
+            excludes.push_back(argv[++i]);
+        } else if (!rootPath) {
+            rootPath = argv[i];
+        } else if (!outputPath) {
+            outputPath = argv[i];
+        } else {
+            rootPath = nullptr;
+            break;
+        }
+    }
+    if (!rootPath || !outputPath) {
+        fprintf(stderr, "usage: pvz_assetpack <resources dir> <output.pak> [--exclude .ext|dir]...\n");
+        return 1;
+    }
+
+    std::string root = rootPath;
+    std::vector<std::string> paths;
+    collectFiles(root, "", excludes, paths);
+
+    std::vector<std::pair<std::string, std::string>> files;
+    for (const auto& path : paths) {
+        files.push_back(std::make_pair(path, root + "/" + path));
+    }
+
+    std::string error;
+    if (!AssetPack::write(outputPath, files, &error)) {
+        fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    // 回读校验
+    AssetPack pack;
+    if (!pack.open(outputPath, &error)) {
+        fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    size_t dataBytes = 0;
+    for (const auto& file : files) {
+        AssetPack::View view;
+        if (!pack.find(file.first.c_str(), &view) || !sameContents(file.second, view)) {
+            fprintf(stderr, "%s: verification failed for %s\n", outputPath, file.first.c_str());
+            return 1;
+        }
+        dataBytes += view.size;
+    }
+
+    printf("%s: %d files, %.2f MB of data -> %.2f MB pack\n", outputPath, pack.getEntryCount(),
+        dataBytes / (1024.0 * 1024.0), pack.getMappedSize() / (1024.0 * 1024.0));
+    return 0;
+}
@@ -0,0 +1,465 @@
+// 纹理图集打包工具
+// 把每个资源组（一个或多个目录下的PNG序列帧）裁掉透明边后打进2048x2048以内的图集页，
+// 输出 <组名>-<页号>.png 和 cocos2d 可直接加载的 plist（format 2，帧名为相对资源根目录的原路径，
+// 如 Images/Zombies/Normal/walk_01.png），ResourceLoader按原路径从SpriteFrameCache取帧。
+// 不是PNG的文件（扩展名是.png的GIF/JPEG）跳过，游戏里仍按散图加载。
+// 用法: pvz_atlas_packer <资源根目录> <输出目录> <组名>=<目录>[,<目录>...] ...
+//   pvz_atlas_packer ../Resources ../Resources/Atlases zombies=Images/Zombies plants=Images/Plants
+
+#include <png.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int MAX_PAGE_SIZE = 2048;
+const int PADDING = 2;      // 帧之间的间隔，其中1像素用边缘像素外扩，避免线性过滤时采到相邻帧
+
+struct Image {
+    std::string name;           // 帧名（相对资源根目录）
+    int sourceWidth = 0;
+    int sourceHeight = 0;
+    int trimX = 0;              // 裁剪后的区域在原图中的位置
+    int trimY = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<uint32_t> pixels;   // 裁剪后的RGBA
+    int page = -1;
+    int x = 0;
+    int y = 0;
+};
+
+struct Page {
+    int maxWidth = MAX_PAGE_SIZE;
+    int usedWidth = 0;
+    int usedHeight = 0;
+    // 货架式装箱：当前行的位置和高度
+    int shelfX = 0;
+    int shelfY = 0;
+    int shelfHeight = 0;
+};
+
+bool endsWith(const std::string& text, const char* suffix)
+{
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+bool isDirectory(const std::string& path)
+{
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+void collectPngFiles(const std::string& root, const std::string& relative, std::vector<std::string>& out)
+{
+    DIR* dir = opendir((root + "/" + relative).c_str());
+    if (!dir) {
+        fprintf(stderr, "cannot open directory %s/%s\n", root.c_str(), relative.c_str());
+        return;
+    }
+
+    std::vector<std::string> entries;
+    while (dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            entries.push_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end());
+
+    for (const auto& entry : entries) {
+        std::string path = relative + "/" + entry;
+        if (isDirectory(root + "/" + path)) {
+            collectPngFiles(root, path, out);
+        } else if (endsWith(entry, ".png")) {
+            out.push_back(path);
+        }
+    }
+}
+
+bool hasPngSignature(const std::string& path)
+{
+    unsigned char header[8] = {};
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    size_t read = fread(header, 1, sizeof(header), file);
+    fclose(file);
+    return read == sizeof(header) && png_sig_cmp(header, 0, sizeof(header)) == 0;
+}
+
+bool loadImage(const std::string& root, const std::string& name, Image& image)
+{
+    std::string path = root + "/" + name;
+    if (!hasPngSignature(path)) {
+        printf("  skip %s (not a PNG)\n", name.c_str());
+        return false;
+    }
+
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&png, path.c_str())) {
+        fprintf(stderr, "  skip %s (%s)\n", name.c_str(), png.message);
+        return false;
+    }
+    png.format = PNG_FORMAT_RGBA;
+
+    std::vector<uint32_t> source(png.width * png.height);
+    if (!png_image_finish_read(&png, nullptr, source.data(), 0, nullptr)) {
+        fprintf(stderr, "  skip %s (%s)\n", name.c_str(), png.message);
+        png_image_free(&png);
+        return false;
+    }
+
+    int width = (int)png.width;
+    int height = (int)png.height;
+
+    // 裁掉全透明的边
+    int left = width;
+    int top = height;
+    int right = -1;
+    int bottom = -1;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const uint8_t* rgba = (const uint8_t*)&source[y * width + x];
+            if (rgba[3] != 0) {
+                left = std::min(left, x);
+                right = std::max(right, x);
+                top = std::min(top, y);
+                bottom = std::max(bottom, y);
+            }
+        }
+    }
+    if (right < 0) {
+        // 整张透明，保留1x1
+        left = top = right = bottom = 0;
+    }
+
+    image.name = name;
+    image.sourceWidth = width;
+    image.sourceHeight = height;
+    image.trimX = left;
+    image.trimY = top;
+    image.width = right - left + 1;
+    image.height = bottom - top + 1;
+    image.pixels.resize(image.width * image.height);
+    for (int y = 0; y < image.height; y++) {
+        memcpy(&image.pixels[y * image.width], &source[(top + y) * width + left], image.width * sizeof(uint32_t));
+    }
+    return true;
+}
+
+bool placeOnPage(Page& page, Image& image)
+{
+    int w = image.width + PADDING;
+    int h = image.height + PADDING;
+    if (w > page.maxWidth || h > MAX_PAGE_SIZE) {
+        return false;
+    }
+
+    // 当前行放不下就换行
+    if (page.shelfX + w > page.maxWidth) {
+        page.shelfY += page.shelfHeight;
+        page.shelfX = 0;
+        page.shelfHeight = 0;
+    }
+    if (page.shelfY + h > MAX_PAGE_SIZE) {
+        return false;
+    }
+
+    // 左上留1像素给外扩
+    image.x = page.shelfX + 1;
+    image.y = page.shelfY + 1;
+    page.shelfX += w;
+    page.shelfHeight = std::max(page.shelfHeight, h);
+    page.usedWidth = std::max(page.usedWidth, page.shelfX);
+    page.usedHeight = std::max(page.usedHeight, page.shelfY + page.shelfHeight);
+    return true;
+}
+
+// 按给定页宽把所有帧依次装进若干页，有帧比页还大时返回false
+bool packPages(std::vector<Image>& images, int pageWidth, std::vector<Page>& pages)
+{
+    pages.assign(1, Page());
+    pages.back().maxWidth = pageWidth;
+    for (auto& image : images) {
+        if (!placeOnPage(pages.back(), image)) {
+            pages.emplace_back();
+            pages.back().maxWidth = pageWidth;
+            if (!placeOnPage(pages.back(), image)) {
+                return false;
+            }
+        }
+        image.page = (int)pages.size() - 1;
+    }
+    return true;
+}
+
+int nextPowerOfTwo(int value)
+{
+    int result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+void blitWithExtrude(std::vector<uint32_t>& canvas, int canvasWidth, int canvasHeight, const Image& image)
+{
+    for (int y = -1; y <= image.height; y++) {
+        int sy = std::min(std::max(y, 0), image.height - 1);
+        int dy = image.y + y;
+        if (dy < 0 || dy >= canvasHeight) {
+            continue;
+        }
+        for (int x = -1; x <= image.width; x++) {
+            int sx = std::min(std::max(x, 0), image.width - 1);
+            int dx = image.x + x;
+            if (dx < 0 || dx >= canvasWidth) {
+                continue;
+            }
+            canvas[dy * canvasWidth + dx] = image.pixels[sy * image.width + sx];
+        }
+    }
+}
+
+std::string escapeXml(const std::string& text)
+{
+    std::string result;
+    for (char c : text) {
+        switch (c) {
+        case '&': result += "&amp;"; break;
+        case '<': result += "&lt;"; break;
+        case '>': result += "&gt;"; break;
+        default:  result += c; break;
+        }
+    }
+    return result;
+}
+
+bool writePlist(const std::string& path, const std::string& textureName, int width, int height,
+    const std::vector<const Image*>& frames)
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+
+    fprintf(file,
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n"
+        "<plist version=\"1.0\">\n"
+        "<dict>\n"
+        "    <key>frames</key>\n"
+        "    <dict>\n");
+
+    for (const Image* image : frames) {
+        // offset是裁剪区域中心相对原图中心的偏移（y轴向上）
+        float offsetX = image->trimX + image->width * 0.5f - image->sourceWidth * 0.5f;
+        float offsetY = image->sourceHeight * 0.5f - (image->trimY + image->height * 0.5f);
+        fprintf(file,
+            "        <key>%s</key>\n"
+            "        <dict>\n"
+            "            <key>frame</key>\n"
+            "            <string>{{%d,%d},{%d,%d}}</string>\n"
+            "            <key>offset</key>\n"
+            "            <string>{%g,%g}</string>\n"
+            "            <key>rotated</key>\n"
+            "            <false/>\n"
+            "            <key>sourceColorRect</key>\n"
+            "            <string>{{%d,%d},{%d,%d}}</string>\n"
+            "            <key>sourceSize</key>\n"
+            "            <string>{%d,%d}</string>\n"
+            "        </dict>\n",
+            escapeXml(image->name).c_str(),
+            image->x, image->y, image->width, image->height,
+            offsetX, offsetY,
+            image->trimX, image->trimY, image->width, image->height,
+            image->sourceWidth, image->sourceHeight);
+    }
+
+    fprintf(file,
+        "    </dict>\n"
+        "    <key>metadata</key>\n"
+        "    <dict>\n"
+        "        <key>format</key>\n"
+        "        <integer>2</integer>\n"
+        "        <key>realTextureFileName</key>\n"
+        "        <string>%s</string>\n"
+        "        <key>size</key>\n"
+        "        <string>{%d,%d}</string>\n"
+        "        <key>textureFileName</key>\n"
+        "        <string>%s</string>\n"
+        "    </dict>\n"
+        "</dict>\n"
+        "</plist>\n",
+        textureName.c_str(), width, height, textureName.c_str());
+
+    fclose(file);
+    return true;
+}
+
+bool packGroup(const std::string& root, const std::string& outDir, const std::string& group,
+    const std::vector<std::string>& dirs)
+{
+    printf("group %s\n", group.c_str());
+
+    std::vector<std::string> files;
+    for (const auto& dir : dirs) {
+        collectPngFiles(root, dir, files);
+    }
+
+    std::vector<Image> images;
+    for (const auto& name : files) {
+        Image image;
+        if (loadImage(root, name, image)) {
+            images.push_back(std::move(image));
+        }
+    }
+    if (images.empty()) {
+        fprintf(stderr, "  no images\n");
+        return false;
+    }
+
+    // 先放高的，货架利用率更高
+    std::sort(images.begin(), images.end(), [](const Image& a, const Image& b) {
+        if (a.height != b.height) {
+            return a.height > b.height;
+        }
+        if (a.width != b.width) {
+            return a.width > b.width;
+        }
+        return a.name < b.name;
+    });
+
+    // 页宽从小到大逐个试：先保证页数最少（页数就是该组最少的draw call数），再取总面积（每页补到2的幂）最小的方案
+    std::vector<Page> pages;
+    long long bestArea = -1;
+    size_t bestPages = 0;
+    int bestWidth = 0;
+    for (int width = 64; width <= MAX_PAGE_SIZE; width <<= 1) {
+        std::vector<Page> trial;
+        if (!packPages(images, width, trial)) {
+            continue;
+        }
+        long long area = 0;
+        for (const auto& page : trial) {
+            area += (long long)nextPowerOfTwo(page.usedWidth) * nextPowerOfTwo(page.usedHeight);
+        }
+        if (bestArea < 0 || trial.size() < bestPages || (trial.size() == bestPages && area < bestArea)) {
+            bestArea = area;
+            bestPages = trial.size();
+            bestWidth = width;
+        }
+    }
+    if (bestArea < 0) {
+        fprintf(stderr, "  some image is larger than %dx%d\n", MAX_PAGE_SIZE, MAX_PAGE_SIZE);
+        return false;
+    }
+    packPages(images, bestWidth, pages);
+
+    long long sourcePixels = 0;
+    long long pagePixels = 0;
+    for (size_t index = 0; index < pages.size(); index++) {
+        int width = nextPowerOfTwo(pages[index].usedWidth);
+        int height = nextPowerOfTwo(pages[index].usedHeight);
+
+        std::vector<uint32_t> canvas(width * height, 0);
+        std::vector<const Image*> frames;
+        for (const auto& image : images) {
+            if (image.page == (int)index) {
+                blitWithExtrude(canvas, width, height, image);
+                frames.push_back(&image);
+                sourcePixels += (long long)image.sourceWidth * image.sourceHeight;
+            }
+        }
+        // plist里按帧名排序，方便比对生成结果
+        std::sort(frames.begin(), frames.end(), [](const Image* a, const Image* b) {
+            return a->name < b->name;
+        });
+        pagePixels += (long long)width * height;
+
+        std::string baseName = group + "-" + std::to_string(index);
+        std::string texturePath = outDir + "/" + baseName + ".png";
+
+        png_image png;
+        memset(&png, 0, sizeof(png));
+        png.version = PNG_IMAGE_VERSION;
+        png.width = width;
+        png.height = height;
+        png.format = PNG_FORMAT_RGBA;
+        if (!png_image_write_to_file(&png, texturePath.c_str(), 0, canvas.data(), 0, nullptr)) {
+            fprintf(stderr, "  cannot write %s (%s)\n", texturePath.c_str(), png.message);
+            return false;
+        }
+        if (!writePlist(outDir + "/" + baseName + ".plist", baseName + ".png", width, height, frames)) {
+            fprintf(stderr, "  cannot write %s.plist\n", baseName.c_str());
+            return false;
+        }
+        printf("  %s: %dx%d, %d frames\n", baseName.c_str(), width, height, (int)frames.size());
+    }
+
+    // 删除上次打包多出来的页
+    for (size_t index = pages.size(); ; index++) {
+        std::string baseName = outDir + "/" + group + "-" + std::to_string(index);
+        bool removed = remove((baseName + ".png").c_str()) == 0;
+        removed = remove((baseName + ".plist").c_str()) == 0 || removed;
+        if (!removed) {
+            break;
+        }
+    }
+
+    printf("  %d frames, %d page(s), source %lld px -> atlas %lld px\n",
+        (int)images.size(), (int)pages.size(), sourcePixels, pagePixels);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 4) {
+        fprintf(stderr, "usage: pvz_atlas_packer <resource root> <output dir> <group>=<dir>[,<dir>...] ...\n");
+        return 1;
+    }
+
+    std::string root = argv[1];
+    std::string outDir = argv[2];
+    mkdir(outDir.c_str(), 0755);
+
+    bool ok = true;
+    for (int i = 3; i < argc; i++) {
+        std::string spec = argv[i];
+        size_t equals = spec.find('=');
+        if (equals == std::string::npos || equals == 0) {
+            fprintf(stderr, "bad group spec: %s\n", spec.c_str());
+            return 1;
+        }
+
+        std::string group = spec.substr(0, equals);
+        std::vector<std::string> dirs;
+        size_t start = equals + 1;
+        while (start <= spec.size()) {
+            size_t comma = spec.find(',', start);
+            if (comma == std::string::npos) {
+                comma = spec.size();
+            }
+            if (comma > start) {
+                dirs.push_back(spec.substr(start, comma - start));
+            }
+            start = comma + 1;
+        }
+
+        ok = packGroup(root, outDir, group, dirs) && ok;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,229 @@
+// 子弹碰撞检测微基准
+// 对比旧路径（每颗子弹遍历所有僵尸，每对都重新计算两侧的包围盒仿射变换）
+// 与LaneBroadphase（按行分桶 + 排序扫描 + 扫掠区间）在 1000 子弹 x 500 僵尸下的耗时。
+// 用法: pvz_collision_bench [--projectiles N] [--zombies N] [--frames N] [--dt SECONDS]
+
+#include "Game/LaneBroadphase.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const int LANE_COUNT = 5;
+const float LANE_HEIGHT = 130.0f;
+const float LANE_ORIGIN_Y = 25.0f;
+
+// 与cocos2d::Node::getBoundingBox等价的计算：由位置/锚点/缩放/旋转得到仿射变换，
+// 再变换内容矩形的四个角取外接矩形
+struct NodeRect {
+    float x, y;
+    float width, height;
+    float anchorX, anchorY;
+    float scaleX, scaleY;
+    float rotation;   // 角度
+
+    void boundingBox(float& minX, float& minY, float& maxX, float& maxY) const
+    {
+        float radians = -rotation * 3.14159265f / 180.0f;
+        float c = std::cos(radians);
+        float s = std::sin(radians);
+
+        float a = c * scaleX;
+        float b = s * scaleX;
+        float cc = -s * scaleY;
+        float d = c * scaleY;
+        float ax = anchorX * width;
+        float ay = anchorY * height;
+        float tx = x - (a * ax + cc * ay);
+        float ty = y - (b * ax + d * ay);
+
+        const float cornersX[4] = { 0.0f, width, 0.0f, width };
+        const float cornersY[4] = { 0.0f, 0.0f, height, height };
+        minX = minY = 1e30f;
+        maxX = maxY = -1e30f;
+        for (int i = 0; i < 4; i++) {
+            float px = a * cornersX[i] + cc * cornersY[i] + tx;
+            float py = b * cornersX[i] + d * cornersY[i] + ty;
+            minX = std::fmin(minX, px);
+            maxX = std::fmax(maxX, px);
+            minY = std::fmin(minY, py);
+            maxY = std::fmax(maxY, py);
+        }
+    }
+};
+
+struct BenchZombie {
+    NodeRect node;
+    int row;
+};
+
+struct BenchProjectile {
+    NodeRect node;
+    int row;
+    float velocityX;
+};
+
+uint32_t g_rng = 12345u;
+
+float randomRange(float lo, float hi)
+{
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return lo + (hi - lo) * ((g_rng >> 8) * (1.0f / 16777216.0f));
+}
+
+NodeRect makeZombieNode(float x, int row)
+{
+    NodeRect node = { x, LANE_ORIGIN_Y + row * LANE_HEIGHT + 50.0f, 60.0f, 100.0f, 0.3f, 0.3f, 1.0f, 1.0f, 0.0f };
+    return node;
+}
+
+NodeRect makePeaNode(float x, int row)
+{
+    NodeRect node = { x, LANE_ORIGIN_Y + row * LANE_HEIGHT + 130.0f / 3 + 55.0f, 15.0f, 8.0f, 0.5f, 0.5f, 1.0f, 1.0f, 0.0f };
+    return node;
+}
+
+// 旧路径：Projectile::checkZombieCollisions
+int oldPath(std::vector<BenchProjectile>& projectiles, const std::vector<BenchZombie>& zombies, float dt)
+{
+    int hits = 0;
+    for (auto& projectile : projectiles) {
+        projectile.node.x += projectile.velocityX * dt;
+
+        float pMinX, pMinY, pMaxX, pMaxY;
+        projectile.node.boundingBox(pMinX, pMinY, pMaxX, pMaxY);
+
+        for (const auto& zombie : zombies) {
+            float zMinX, zMinY, zMaxX, zMaxY;
+            zombie.node.boundingBox(zMinX, zMinY, zMaxX, zMaxY);
+            if (pMaxX >= zMinX && zMaxX >= pMinX && pMaxY >= zMinY && zMaxY >= pMinY) {
+                hits++;
+                break;
+            }
+        }
+    }
+    return hits;
+}
+
+// 新路径：GameManager::resolveProjectileCollisions
+int newPath(std::vector<BenchProjectile>& projectiles, const std::vector<BenchZombie>& zombies,
+    float dt, LaneBroadphase& broadphase)
+{
+    broadphase.reset(LANE_COUNT);
+
+    for (size_t i = 0; i < zombies.size(); i++) {
+        float minX, minY, maxX, maxY;
+        zombies[i].node.boundingBox(minX, minY, maxX, maxY);
+        broadphase.addBody(zombies[i].row, minX, maxX, static_cast<uint32_t>(i));
+    }
+
+    for (size_t i = 0; i < projectiles.size(); i++) {
+        BenchProjectile& projectile = projectiles[i];
+        float fromX = projectile.node.x;
+        projectile.node.x += projectile.velocityX * dt;
+
+        float minX, minY, maxX, maxY;
+        projectile.node.boundingBox(minX, minY, maxX, maxY);
+        broadphase.addSweep(projectile.row, fromX, projectile.node.x, (maxX - minX) * 0.5f,
+            static_cast<uint32_t>(i));
+    }
+
+    // 每颗子弹只算第一次命中
+    const auto& result = broadphase.solve();
+    int hits = 0;
+    uint32_t lastSweep = 0xFFFFFFFFu;
+    for (const auto& hit : result) {
+        if (hit.sweepId != lastSweep) {
+            hits++;
+            lastSweep = hit.sweepId;
+        }
+    }
+    return hits;
+}
+
+void buildScene(int projectileCount, int zombieCount,
+    std::vector<BenchProjectile>& projectiles, std::vector<BenchZombie>& zombies)
+{
+    g_rng = 12345u;
+    zombies.clear();
+    projectiles.clear();
+
+    for (int i = 0; i < zombieCount; i++) {
+        BenchZombie zombie;
+        zombie.row = static_cast<int>(randomRange(0.0f, LANE_COUNT - 0.001f));
+        zombie.node = makeZombieNode(randomRange(300.0f, 1000.0f), zombie.row);
+        zombies.push_back(zombie);
+    }
+    for (int i = 0; i < projectileCount; i++) {
+        BenchProjectile projectile;
+        projectile.row = static_cast<int>(randomRange(0.0f, LANE_COUNT - 0.001f));
+        projectile.node = makePeaNode(randomRange(200.0f, 1000.0f), projectile.row);
+        projectile.velocityX = 200.0f;
+        projectiles.push_back(projectile);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int projectileCount = 1000;
+    int zombieCount = 500;
+    int frames = 200;
+    float dt = 1.0f / 60.0f;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--projectiles") == 0 && hasValue) {
+            projectileCount = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--zombies") == 0 && hasValue) {
+            zombieCount = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+            frames = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--dt") == 0 && hasValue) {
+            dt = static_cast<float>(atof(argv[++i]));
+        }
+        else {
+            printf("Usage: %s [--projectiles N] [--zombies N] [--frames N] [--dt SECONDS]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<BenchProjectile> projectiles;
+    std::vector<BenchZombie> zombies;
+    LaneBroadphase broadphase;
+
+    // 两条路径都从同一场景开始；子弹每帧前进，命中不移除，保证每帧工作量一致
+    buildScene(projectileCount, zombieCount, projectiles, zombies);
+    long long oldHits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        oldHits += oldPath(projectiles, zombies, dt);
+    }
+    double oldMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    buildScene(projectileCount, zombieCount, projectiles, zombies);
+    long long newHits = 0;
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        newHits += newPath(projectiles, zombies, dt, broadphase);
+    }
+    double newMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    printf("projectiles: %d  zombies: %d  frames: %d  dt: %.4f\n", projectileCount, zombieCount, frames, dt);
+    printf("old (all pairs, per-pair bbox): %9.3f ms total  %8.4f ms/frame  hits %lld\n",
+        oldMs, oldMs / frames, oldHits);
+    printf("new (lane sweep and prune):     %9.3f ms total  %8.4f ms/frame  hits %lld\n",
+        newMs, newMs / frames, newHits);
+    printf("speedup: %.1fx\n", newMs > 0.0 ? oldMs / newMs : 0.0);
+    return 0;
+}
@@ -0,0 +1,160 @@
+// 二进制日志解码器
+// 把游戏写出的Logger二进制日志还原成文本，可按最低级别和模块过滤。
+// 用法: pvz_logdecode <file> [--level TRACE|DEBUG|INFO|WARN|ERROR] [--category NAME]
+
+#include "Game/Logger.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct DecodeOptions {
+    const char* path = nullptr;
+    int minLevel = PVZ_LOG_LEVEL_TRACE;
+    std::string category;
+};
+
+template <typename T>
+bool readPod(FILE* file, T& value)
+{
+    return fread(&value, sizeof(T), 1, file) == 1;
+}
+
+bool readBytes(FILE* file, std::string& out, size_t length)
+{
+    out.resize(length);
+    return length == 0 || fread(&out[0], 1, length, file) == length;
+}
+
+int parseLevel(const char* name)
+{
+    for (int level = PVZ_LOG_LEVEL_TRACE; level <= PVZ_LOG_LEVEL_ERROR; level++) {
+        if (strcmp(name, Logger::getLevelName(level)) == 0) {
+            return level;
+        }
+    }
+    return atoi(name);
+}
+
+bool parseArgs(int argc, char** argv, DecodeOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--level") == 0 && hasValue) {
+            options.minLevel = parseLevel(argv[++i]);
+        } else if (strcmp(arg, "--category") == 0 && hasValue) {
+            options.category = argv[++i];
+        } else if (arg[0] != '-' && !options.path) {
+            options.path = arg;
+        } else {
+            return false;
+        }
+    }
+    return options.path != nullptr;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    DecodeOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        fprintf(stderr, "usage: pvz_logdecode <file> [--level TRACE|DEBUG|INFO|WARN|ERROR] [--category NAME]\n");
+        return 1;
+    }
+
+    FILE* file = fopen(options.path, "rb");
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", options.path);
+        return 1;
+    }
+
+    char magic[8];
+    uint32_t version = 0;
+    uint32_t categoryCount = 0;
+    if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+        memcmp(magic, Logger::FILE_MAGIC, sizeof(magic)) != 0 ||
+        !readPod(file, version) || version != Logger::FILE_VERSION ||
+        !readPod(file, categoryCount)) {
+        fprintf(stderr, "%s: not a log file or unsupported version\n", options.path);
+        fclose(file);
+        return 1;
+    }
+
+    std::vector<std::string> categories(categoryCount);
+    for (auto& name : categories) {
+        uint8_t length = 0;
+        if (!readPod(file, length) || !readBytes(file, name, length)) {
+            fprintf(stderr, "%s: truncated header\n", options.path);
+            fclose(file);
+            return 1;
+        }
+    }
+    uint64_t startUnixMs = 0;
+    readPod(file, startUnixMs);
+    printf("# log started at unix time %llu.%03llu\n",
+        (unsigned long long)(startUnixMs / 1000), (unsigned long long)(startUnixMs % 1000));
+
+    std::vector<std::string> formats;
+    std::string payload;
+    uint64_t messages = 0;
+    uint64_t dropped = 0;
+
+    uint8_t block = 0;
+    while (readPod(file, block)) {
+        if (block == Logger::BLOCK_FORMAT) {
+            uint32_t id = 0;
+            uint16_t length = 0;
+            std::string text;
+            if (!readPod(file, id) || !readPod(file, length) || !readBytes(file, text, length)) {
+                break;
+            }
+            if (formats.size() <= id) {
+                formats.resize(id + 1);
+            }
+            formats[id] = text;
+        } else if (block == Logger::BLOCK_MESSAGE) {
+            uint32_t formatId = 0;
+            uint64_t timestamp = 0;
+            uint8_t level = 0;
+            uint8_t category = 0;
+            uint32_t threadId = 0;
+            uint16_t size = 0;
+            if (!readPod(file, formatId) || !readPod(file, timestamp) || !readPod(file, level) ||
+                !readPod(file, category) || !readPod(file, threadId) || !readPod(file, size) ||
+                !readBytes(file, payload, size)) {
+                break;
+            }
+            messages++;
+
+            const std::string& categoryName = category < categories.size() ? categories[category] : std::string("?");
+            if (level < options.minLevel ||
+                (!options.category.empty() && options.category != categoryName)) {
+                continue;
+            }
+
+            const char* format = formatId < formats.size() ? formats[formatId].c_str() : "<unknown format>";
+            std::string text = Logger::formatMessage(format, (const uint8_t*)payload.data(), payload.size());
+            printf("[%12.6f] %-5s %-10s T%-2u %s\n", timestamp / 1e9, Logger::getLevelName(level),
+                categoryName.c_str(), threadId, text.c_str());
+        } else if (block == Logger::BLOCK_DROPPED) {
+            uint32_t count = 0;
+            if (!readPod(file, count)) {
+                break;
+            }
+            dropped += count;
+            printf("# %u messages dropped (ring buffer full)\n", count);
+        } else {
+            fprintf(stderr, "%s: unknown block 0x%02x, stopping\n", options.path, block);
+            break;
+        }
+    }
+
+    fclose(file);
+    printf("# %llu messages, %llu dropped\n", (unsigned long long)messages, (unsigned long long)dropped);
+    return 0;
+}
@@ -0,0 +1,453 @@
+// 无头模拟运行器
+// 用脚本化的种植策略批量跑SimWorld对局，输出胜负统计和吞吐量（局/秒）。
+// 相当于不限速（UNCAPPED）模式：按固定步长连续推进，不等待帧时间。
+// 用法: pvz_headless [--matches N] [--seed S] [--waves W] [--dt SECONDS]
+//                    [--min-win-rate R] [--max-win-rate R] [--verbose] [--log FILE] [--trace FILE]
+// 有超时的对局时返回2；跑满100局以上时胜率超出[min, max]返回3（默认范围对应默认配置，改了--waves等参数时要一起给）
+// --log把每局结果写进二进制日志（用pvz_logdecode查看）
+// --trace记录SimWorld各阶段耗时，结束时导出Chrome trace（只保留最后的EVENT_CAPACITY个区段）
+
+#include "Game/SimWorld.h"
+#include "Game/FixedStepClock.h"
+#include "Game/Logger.h"
+#include "Game/FrameProfiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct RunnerOptions {
+    int matches = 100;
+    uint32_t seed = 1;
+    int waves = 10;
+    float dt = FixedStepClock::DEFAULT_STEP;   // 与游戏内的逻辑步长一致
+    float maxTime = 3600.0f;   // 单局最长模拟时间，防止死循环
+    // 胜率的预期范围：脚本策略在默认配置下约74%，超出范围说明数值或模拟逻辑的改动影响了平衡
+    float minWinRate = 0.55f;
+    float maxWinRate = 0.9f;
+    int minMatchesForWinRate = 100;   // 局数太少时胜率没有意义，不检查
+    bool verbose = false;
+    const char* logPath = nullptr;
+    const char* tracePath = nullptr;
+};
+
+// 脚本策略用到的数值（与SimWorld一致）和参数
+const float PEA_DPS = 15.0f / 4.0f;       // 单个射手的输出
+const float ZOMBIE_SPEED = 20.0f;
+const float MINE_ARM_TIME = 20.0f;
+const int MINE_DAMAGE = 200;
+const float CHERRY_FUSE = 1.5f;
+const float CHERRY_RANGE = 150.0f;
+const float WALLNUT_STALL = 20.0f;        // 坚果能拖住一只僵尸的时间
+
+const int MINE_COL = 3;                   // 提前埋雷的列
+const int FIRST_SHOOTER_COL = 2;          // 0、1列留给向日葵
+const int LAST_SHOOTER_COL = 4;
+const float SHOOTER_CLEARANCE = 60.0f;    // 射手至少要在最前面的僵尸左边这么远
+const int CHERRY_CLUSTER_HEALTH = 300;    // 一颗樱桃炸弹至少要炸掉这么多血量才种
+const float CHERRY_TIME = 5.0f;           // 僵尸离防线不到这么久时用樱桃炸弹救急
+
+struct BuildStep {
+    PlantType type;
+    int perLane;
+};
+
+const BuildStep BUILD_ORDER[] = {
+    { PlantType::SUNFLOWER, 1 },
+    { PlantType::PEASHOOTER, 1 },
+    { PlantType::SUNFLOWER, 2 },
+    { PlantType::PEASHOOTER, 2 },
+    { PlantType::PEASHOOTER, 3 },
+};
+
+// 每行的局势：射手、最靠前的防线植物、地雷，以及按从近到远排好的僵尸
+struct LaneState {
+    int shooters = 0;
+    int sunflowers = 0;
+    int frontPlantCol = -1;   // 不算地雷
+    bool hasWallnut = false;
+    int mines = 0;            // 僵尸到达前能激活的地雷数
+    std::vector<std::pair<float, int>> zombies;   // x, 血量（含护甲）
+    float frontZombieX = 1e9f;
+};
+
+void collectLanes(const SimWorld& world, std::vector<LaneState>& lanes)
+{
+    lanes.assign(world.getConfig().rows, LaneState());
+    for (const auto& zombie : world.getZombies()) {
+        if (!zombie.alive) {
+            continue;
+        }
+        LaneState& lane = lanes[zombie.row];
+        lane.zombies.emplace_back(zombie.x, zombie.health + zombie.armor);
+        lane.frontZombieX = std::min(lane.frontZombieX, zombie.x);
+    }
+    for (auto& lane : lanes) {
+        std::sort(lane.zombies.begin(), lane.zombies.end());
+    }
+    for (const auto& plant : world.getPlants()) {
+        if (!plant.alive) {
+            continue;
+        }
+        LaneState& lane = lanes[plant.row];
+        switch (plant.type) {
+        case PlantType::PEASHOOTER:
+        case PlantType::SNOW_PEA:
+            lane.shooters++;
+            break;
+        case PlantType::SUNFLOWER:
+            lane.sunflowers++;
+            break;
+        case PlantType::WALLNUT:
+            lane.hasWallnut = true;
+            break;
+        case PlantType::POTATO_MINE:
+            if (plant.armed || plant.x + (MINE_ARM_TIME - plant.fuseTimer) * ZOMBIE_SPEED < lane.frontZombieX) {
+                lane.mines++;
+            }
+            continue;
+        case PlantType::CHERRY_BOMB:
+            continue;
+        }
+        lane.frontPlantCol = std::max(lane.frontPlantCol, plant.col);
+    }
+}
+
+// 现有的射手、地雷和坚果挡不住时返回第一只会突破防线的僵尸还有多久走到防线，挡得住时返回负数
+float timeToBreach(const SimWorld& world, const LaneState& lane)
+{
+    float defenseX = world.cellCenterX(std::max(lane.frontPlantCol, 0));
+    float stall = lane.hasWallnut ? WALLNUT_STALL : 0.0f;
+    int health = 0;
+    for (const auto& zombie : lane.zombies) {
+        health += zombie.second;
+        float time = std::max((zombie.first - defenseX) / ZOMBIE_SPEED, 0.0f);
+        if (health > lane.shooters * PEA_DPS * (time + stall) + lane.mines * MINE_DAMAGE) {
+            return time;
+        }
+    }
+    return -1.0f;
+}
+
+// 种一个射手（豌豆射手冷却中时用寒冰射手）
+bool plantShooter(SimWorld& world, int row, const LaneState& lane, int firstCol, int lastCol)
+{
+    for (int col = firstCol; col <= lastCol; col++) {
+        // 种在僵尸身后没有用
+        if (world.cellCenterX(col) + SHOOTER_CLEARANCE > lane.frontZombieX) {
+            return false;
+        }
+        if (!world.canPlantAt(row, col)) {
+            continue;
+        }
+        return world.placePlant(PlantType::PEASHOOTER, row, col) ||
+            world.placePlant(PlantType::SNOW_PEA, row, col);
+    }
+    return false;
+}
+
+// 埋在防线前面、僵尸走到之前来得及激活的最近的格子里
+bool plantMine(SimWorld& world, int row, const LaneState& lane)
+{
+    const SimConfig& config = world.getConfig();
+    for (int col = lane.frontPlantCol + 1; col < config.cols; col++) {
+        if (world.cellCenterX(col) + MINE_ARM_TIME * ZOMBIE_SPEED >= lane.frontZombieX) {
+            break;
+        }
+        if (world.placePlant(PlantType::POTATO_MINE, row, col)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 樱桃炸弹能炸到上下相邻的行：找炸到的僵尸总血量最多的空格子，够多时才种
+bool plantCherryOnCluster(SimWorld& world, int minHealth)
+{
+    if (world.getCooldownRemaining(PlantType::CHERRY_BOMB) > 0.0f ||
+        world.getSunCount() < SimWorld::plantSunCost(PlantType::CHERRY_BOMB)) {
+        return false;
+    }
+
+    const SimConfig& config = world.getConfig();
+    int bestHealth = 0;
+    int bestRow = -1;
+    int bestCol = -1;
+    for (int row = 0; row < config.rows; row++) {
+        for (int col = 0; col < config.cols; col++) {
+            if (!world.canPlantAt(row, col)) {
+                continue;
+            }
+            float x = world.cellCenterX(col);
+            float y = world.cellCenterY(row);
+            int health = 0;
+            for (const auto& zombie : world.getZombies()) {
+                // 引信燃烧期间僵尸还会往前走
+                float dx = zombie.x - CHERRY_FUSE * ZOMBIE_SPEED - x;
+                float dy = zombie.y - y;
+                if (zombie.alive && dx * dx + dy * dy <= CHERRY_RANGE * CHERRY_RANGE) {
+                    health += zombie.health + zombie.armor;
+                }
+            }
+            if (health > bestHealth) {
+                bestHealth = health;
+                bestRow = row;
+                bestCol = col;
+            }
+        }
+    }
+    return bestHealth >= minHealth && world.placePlant(PlantType::CHERRY_BOMB, bestRow, bestCol);
+}
+
+bool plantCherry(SimWorld& world, int row, const LaneState& lane)
+{
+    int zombieRow = 0;
+    int zombieCol = 0;
+    return world.worldToGrid(lane.frontZombieX, world.cellCenterY(row), zombieRow, zombieCol) &&
+        world.placePlant(PlantType::CHERRY_BOMB, row, zombieCol);
+}
+
+// 地雷最划算，冷却一好就埋：优先埋在地雷还没覆盖的僵尸最多的行，没有僵尸时给还没有地雷的行提前埋一颗
+bool plantMines(SimWorld& world, const std::vector<LaneState>& lanes)
+{
+    if (world.getCooldownRemaining(PlantType::POTATO_MINE) > 0.0f ||
+        world.getSunCount() < SimWorld::plantSunCost(PlantType::POTATO_MINE)) {
+        return false;
+    }
+
+    const SimConfig& config = world.getConfig();
+    std::vector<std::pair<int, int>> targets;
+    for (int row = 0; row < config.rows; row++) {
+        const LaneState& lane = lanes[row];
+        int health = -lane.mines * MINE_DAMAGE;
+        for (const auto& zombie : lane.zombies) {
+            health += zombie.second;
+        }
+        if (!lane.zombies.empty() && health > 0) {
+            targets.emplace_back(health, row);
+        }
+    }
+    std::sort(targets.rbegin(), targets.rend());
+    for (const auto& target : targets) {
+        if (plantMine(world, target.second, lanes[target.second])) {
+            return true;
+        }
+    }
+
+    for (int row = 0; row < config.rows; row++) {
+        const LaneState& lane = lanes[row];
+        if (lane.zombies.empty() && lane.mines == 0 &&
+            world.placePlant(PlantType::POTATO_MINE, row, std::max(lane.frontPlantCol + 1, MINE_COL))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 现有防御挡不住的行按突破时间从早到晚处理：没有射手先种射手，再放坚果拖时间、补射手，快突破时用樱桃炸弹。
+// 需要种但阳光不够时返回true（先攒着，不做别的种植）
+bool defendLanes(SimWorld& world, const std::vector<LaneState>& lanes)
+{
+    const SimConfig& config = world.getConfig();
+    std::vector<std::pair<float, int>> threats;
+    for (int row = 0; row < config.rows; row++) {
+        float time = timeToBreach(world, lanes[row]);
+        if (time >= 0.0f) {
+            threats.emplace_back(time, row);
+        }
+    }
+    std::sort(threats.begin(), threats.end());
+
+    for (const auto& threat : threats) {
+        float time = threat.first;
+        int row = threat.second;
+        const LaneState& lane = lanes[row];
+
+        if (lane.shooters == 0 && plantShooter(world, row, lane, FIRST_SHOOTER_COL, LAST_SHOOTER_COL)) {
+            return true;
+        }
+        if (!lane.hasWallnut && lane.shooters > 0 && lane.frontPlantCol + 1 < config.cols &&
+            lane.frontZombieX > world.cellCenterX(lane.frontPlantCol + 1) &&
+            world.placePlant(PlantType::WALLNUT, row, lane.frontPlantCol + 1)) {
+            return true;
+        }
+        if (plantShooter(world, row, lane, FIRST_SHOOTER_COL, LAST_SHOOTER_COL)) {
+            return true;
+        }
+        if (time < CHERRY_TIME && plantCherry(world, row, lane)) {
+            return true;
+        }
+        return true;
+    }
+    return false;
+}
+
+// 脚本策略：樱桃炸弹清成群的僵尸，地雷冷却好就埋，然后守住挡不住的行，最后按建造顺序种向日葵和射手
+void playScriptedTurn(SimWorld& world)
+{
+    const SimConfig& config = world.getConfig();
+
+    std::vector<LaneState> lanes;
+    collectLanes(world, lanes);
+
+    if (plantCherryOnCluster(world, CHERRY_CLUSTER_HEALTH) || plantMines(world, lanes) || defendLanes(world, lanes)) {
+        return;
+    }
+
+    // 按建造顺序补齐：每一步要求每行都达到目标数量后才进入下一步，阳光不够时等着
+    for (const auto& step : BUILD_ORDER) {
+        for (int row = 0; row < config.rows; row++) {
+            const LaneState& lane = lanes[row];
+            if (world.getSunCount() < SimWorld::plantSunCost(step.type)) {
+                return;
+            }
+            if (step.type == PlantType::SUNFLOWER) {
+                if (lane.sunflowers < step.perLane) {
+                    world.placePlant(PlantType::SUNFLOWER, row, lane.sunflowers);
+                    return;
+                }
+            }
+            else if (lane.shooters < step.perLane) {
+                plantShooter(world, row, lane, FIRST_SHOOTER_COL, LAST_SHOOTER_COL);
+                return;
+            }
+        }
+    }
+}
+
+bool parseOptions(int argc, char** argv, RunnerOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (strcmp(arg, "--matches") == 0 && hasValue) {
+            options.matches = atoi(argv[++i]);
+        }
+        else if (strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(arg, "--waves") == 0 && hasValue) {
+            options.waves = atoi(argv[++i]);
+        }
+        else if (strcmp(arg, "--dt") == 0 && hasValue) {
+            options.dt = static_cast<float>(atof(argv[++i]));
+        }
+        else if (strcmp(arg, "--min-win-rate") == 0 && hasValue) {
+            options.minWinRate = static_cast<float>(atof(argv[++i]));
+        }
+        else if (strcmp(arg, "--max-win-rate") == 0 && hasValue) {
+            options.maxWinRate = static_cast<float>(atof(argv[++i]));
+        }
+        else if (strcmp(arg, "--verbose") == 0) {
+            options.verbose = true;
+        }
+        else if (strcmp(arg, "--log") == 0 && hasValue) {
+            options.logPath = argv[++i];
+        }
+        else if (strcmp(arg, "--trace") == 0 && hasValue) {
+            options.tracePath = argv[++i];
+        }
+        else {
+            printf("Usage: %s [--matches N] [--seed S] [--waves W] [--dt SECONDS]\n"
+                "       [--min-win-rate R] [--max-win-rate R] [--verbose] [--log FILE] [--trace FILE]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.matches > 0 && options.dt > 0.0f;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    RunnerOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    if (options.logPath && !Logger::getInstance()->start(options.logPath)) {
+        return 1;
+    }
+
+    FrameProfiler::getInstance()->setEnabled(options.tracePath != nullptr);
+
+    SimConfig config;
+    config.totalWaves = options.waves;
+    SimWorld world(config);
+
+    int wins = 0;
+    int losses = 0;
+    int timeouts = 0;
+    uint64_t totalTicks = 0;
+    double totalSimTime = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int match = 0; match < options.matches; match++) {
+        world.reset(options.seed + match);
+
+        while (world.getOutcome() == SimOutcome::RUNNING && world.getTime() < options.maxTime) {
+            playScriptedTurn(world);
+            world.tick(options.dt);
+        }
+
+        switch (world.getOutcome()) {
+        case SimOutcome::WON:  wins++; break;
+        case SimOutcome::LOST: losses++; break;
+        default:               timeouts++; break;
+        }
+        totalTicks += world.getTickCount();
+        totalSimTime += world.getTime();
+
+        PVZ_LOGI(LogCategory::GAME, "match %d seed %u: %s wave %d kills %d time %.1fs",
+            match, options.seed + match,
+            world.getOutcome() == SimOutcome::WON ? "WON" :
+            world.getOutcome() == SimOutcome::LOST ? "LOST" : "TIMEOUT",
+            world.getCurrentWave(), world.getZombiesKilled(), world.getTime());
+
+        if (options.verbose) {
+            printf("match %d seed %u: %s wave %d kills %d time %.1fs\n",
+                match, options.seed + match,
+                world.getOutcome() == SimOutcome::WON ? "WON" :
+                world.getOutcome() == SimOutcome::LOST ? "LOST" : "TIMEOUT",
+                world.getCurrentWave(), world.getZombiesKilled(), world.getTime());
+        }
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (elapsed <= 0.0) {
+        elapsed = 1e-9;
+    }
+
+    float winRate = static_cast<float>(wins) / options.matches;
+    printf("matches: %d  won: %d  lost: %d  timeout: %d\n", options.matches, wins, losses, timeouts);
+    printf("win rate: %.1f%%  expected: %.1f%% - %.1f%%\n",
+        winRate * 100.0f, options.minWinRate * 100.0f, options.maxWinRate * 100.0f);
+    printf("ticks: %llu  simulated: %.1fs  wall: %.3fs\n",
+        static_cast<unsigned long long>(totalTicks), totalSimTime, elapsed);
+    printf("throughput: %.1f matches/s  %.2fx realtime\n",
+        options.matches / elapsed, totalSimTime / elapsed);
+
+    if (options.tracePath && !FrameProfiler::getInstance()->writeChromeTrace(options.tracePath)) {
+        fprintf(stderr, "cannot write %s\n", options.tracePath);
+    }
+
+    Logger::getInstance()->shutdown();
+
+    // 有超时说明模拟卡死，胜率超出预期范围说明平衡变了，都作为CI失败处理
+    if (timeouts > 0) {
+        return 2;
+    }
+    if (options.matches >= options.minMatchesForWinRate &&
+        (winRate < options.minWinRate || winRate > options.maxWinRate)) {
+        fprintf(stderr, "win rate %.1f%% outside expected range\n", winRate * 100.0f);
+        return 3;
+    }
+    return 0;
+}